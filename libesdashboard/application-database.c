@@ -27,11 +27,14 @@
 #endif
 
 #include <glib/gi18n-lib.h>
+#include <glib/gstdio.h>
+#include <errno.h>
 
 #include <libesdashboard/application-database.h>
 #include <libesdashboard/desktop-app-info.h>
 #include <libesdashboard/compat.h>
 #include <libesdashboard/debug.h>
+#include <libesdashboard/marshal.h>
 
 
 /* Define this class in GObject system */
@@ -45,9 +48,20 @@ struct _EsdashboardApplicationDatabasePrivate
 
 	MarkonMenu			*appsMenu;
 	guint				appsMenuReloadRequiredID;
+	GCancellable		*appsMenuLoadCancellable;
 
 	GHashTable			*applications;
 	GList				*appDirMonitors;
+
+	GHashTable			*pendingChanges;
+	guint				pendingChangesID;
+	gint64				pendingChangesSince;
+
+	GHashTable			*searchIndex;
+	GHashTable			*searchIndexEntries;
+	GPtrArray			*searchIndexEntriesByID;
+	guint				searchIndexDeadEntries;
+	GHashTable			*suffixIndex;
 };
 
 G_DEFINE_TYPE_WITH_PRIVATE(EsdashboardApplicationDatabase,
@@ -73,6 +87,7 @@ enum
 
 	SIGNAL_APPLICATION_ADDED,
 	SIGNAL_APPLICATION_REMOVED,
+	SIGNAL_APPLICATIONS_CHANGED,
 
 	SIGNAL_LAST
 };
@@ -92,8 +107,78 @@ struct _EsdashboardApplicationDatabaseFileMonitorData
 	guint				changedID;
 };
 
+typedef struct _EsdashboardApplicationDatabaseScan				EsdashboardApplicationDatabaseScan;
+struct _EsdashboardApplicationDatabaseScan
+{
+	EsdashboardApplicationDatabase		*self;
+	GThreadPool							*pool;
+
+	GMutex								lock;
+	GCond								finishedCond;
+	guint								pendingJobs;
+	GError								*error;
+
+	GPtrArray							*results;		/* One hash-table of desktop app infos per search path */
+	GPtrArray							*directories;	/* Directories scanned to monitor and to cache */
+
+	GHashTable							*cache;			/* Records of directories found in cache */
+	gboolean							cacheChanged;
+};
+
+typedef struct _EsdashboardApplicationDatabaseScanDirectoryData	EsdashboardApplicationDatabaseScanDirectoryData;
+struct _EsdashboardApplicationDatabaseScanDirectoryData
+{
+	guint								searchPathIndex;
+	GFile								*directory;
+	gchar								*path;
+	gint64								modificationTime;
+
+	GVariant							*cachedRecord;		/* Set if directory was taken from cache unmodified */
+	GPtrArray							*subdirectories;
+	GPtrArray							*entries;
+};
+
+typedef struct _EsdashboardApplicationDatabaseScanJob			EsdashboardApplicationDatabaseScanJob;
+struct _EsdashboardApplicationDatabaseScanJob
+{
+	guint								searchPathIndex;
+	GFile								*topLevelPath;
+
+	/* Either a directory to enumerate or a batch of desktop files to parse */
+	GFile								*directory;
+	GPtrArray							*files;
+	EsdashboardApplicationDatabaseScanDirectoryData	*directoryData;
+};
+
+#define ESDASHBOARD_APPLICATION_DATABASE_SCAN_BATCH_SIZE			32
+
+#define ESDASHBOARD_APPLICATION_DATABASE_CHANGES_DELAY				250		/* Quiet time in ms before pending changes are processed */
+#define ESDASHBOARD_APPLICATION_DATABASE_CHANGES_MAX_DELAY			2000	/* Maximum time in ms changes are deferred */
+
+#define ESDASHBOARD_APPLICATION_DATABASE_CACHE_FILE					"applications.cache"
+#define ESDASHBOARD_APPLICATION_DATABASE_CACHE_VERSION				3
+#define ESDASHBOARD_APPLICATION_DATABASE_CACHE_ENTRY_TYPE			"(ssm" ESDASHBOARD_DESKTOP_APP_INFO_CACHE_DATA_TYPE_STRING ")"
+#define ESDASHBOARD_APPLICATION_DATABASE_CACHE_RECORD_TYPE			"(usxasa" ESDASHBOARD_APPLICATION_DATABASE_CACHE_ENTRY_TYPE ")"
+#define ESDASHBOARD_APPLICATION_DATABASE_CACHE_TYPE					"(uasasa" ESDASHBOARD_APPLICATION_DATABASE_CACHE_RECORD_TYPE ")"
+
+#define ESDASHBOARD_APPLICATION_DATABASE_SEARCH_INDEX_MAX_NGRAM		3
+#define ESDASHBOARD_APPLICATION_DATABASE_SEARCH_INDEX_SEPARATOR		'\n'
+#define ESDASHBOARD_APPLICATION_DATABASE_SEARCH_INDEX_MIN_DEAD_ENTRIES	64		/* Minimum number of removed entries before IDs are compacted */
+
+G_LOCK_DEFINE_STATIC(_esdashboard_application_database_search_index_lock);
+
+typedef struct _EsdashboardApplicationDatabaseSearchIndexEntry	EsdashboardApplicationDatabaseSearchIndexEntry;
+struct _EsdashboardApplicationDatabaseSearchIndexEntry
+{
+	guint				id;
+	GAppInfo			*appInfo;
+	gchar				*text;
+};
+
 /* Forward declarations */
 static gboolean _esdashboard_application_database_load_application_menu(EsdashboardApplicationDatabase *self, GError **outError);
+static void _esdashboard_application_database_load_application_menu_async(EsdashboardApplicationDatabase *self);
+static void _esdashboard_application_database_remove_cache(EsdashboardApplicationDatabase *self);
 
 /* Callback function for hash table iterator to add each value to a list of type GList */
 static void _esdashboard_application_database_add_hashtable_item_to_list(gpointer inKey,
@@ -110,31 +195,459 @@ static void _esdashboard_application_database_add_hashtable_item_to_list(gpointe
 	*applicationsList=g_list_prepend(*applicationsList, g_object_ref(G_OBJECT(inValue)));
 }
 
+/* Build n-gram key for search index. The length of n-gram is stored in highest
+ * byte so n-grams of different lengths never share the same key.
+ */
+#define ESDASHBOARD_APPLICATION_DATABASE_NGRAM_KEY(inText, inLength) \
+	(((guint)(inLength)<<24) | \
+		((guint)(guchar)(inText)[0]<<16) | \
+		((inLength)>1 ? (guint)(guchar)(inText)[1]<<8 : 0) | \
+		((inLength)>2 ? (guint)(guchar)(inText)[2] : 0))
+
+/* Get case-folded text of application to index. The searchable fields of the
+ * application are separated by a character which never occurs in search terms,
+ * so no n-gram spans multiple fields.
+ */
+static gchar* _esdashboard_application_database_search_index_get_text(GAppInfo *inAppInfo)
+{
+	GString									*text;
+	const gchar								*value;
+	GList									*iter;
+	gchar									*foldedText;
+
+	g_return_val_if_fail(G_IS_APP_INFO(inAppInfo), NULL);
+
+	/* Collect all searchable fields */
+	text=g_string_new(NULL);
+
+	value=g_app_info_get_display_name(inAppInfo);
+	if(value) g_string_append_printf(text, "%s%c", value, ESDASHBOARD_APPLICATION_DATABASE_SEARCH_INDEX_SEPARATOR);
+
+	value=g_app_info_get_description(inAppInfo);
+	if(value) g_string_append_printf(text, "%s%c", value, ESDASHBOARD_APPLICATION_DATABASE_SEARCH_INDEX_SEPARATOR);
+
+	value=g_app_info_get_executable(inAppInfo);
+	if(value) g_string_append_printf(text, "%s%c", value, ESDASHBOARD_APPLICATION_DATABASE_SEARCH_INDEX_SEPARATOR);
+
+	if(ESDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo))
+	{
+		for(iter=esdashboard_desktop_app_info_get_keywords(ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo)); iter; iter=g_list_next(iter))
+		{
+			if(iter->data) g_string_append_printf(text, "%s%c", (const gchar*)iter->data, ESDASHBOARD_APPLICATION_DATABASE_SEARCH_INDEX_SEPARATOR);
+		}
+	}
+
+	/* Fold text in the same way as search terms are folded */
+	foldedText=g_utf8_strdown(text->str, text->len);
+
+	/* Release allocated resources */
+	g_string_free(text, TRUE);
+
+	/* Return folded text */
+	return(foldedText);
+}
+
+/* Add or remove an application's ID to or from list of IDs of each n-gram in text */
+static void _esdashboard_application_database_search_index_update_ngrams(EsdashboardApplicationDatabase *self,
+																			const gchar *inText,
+																			guint inID,
+																			gboolean inAdd)
+{
+	EsdashboardApplicationDatabasePrivate	*priv;
+	const gchar								*iter;
+	guint									length;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(inText);
+
+	priv=self->priv;
+
+	/* Iterate through text and for each position add or remove the ID to or
+	 * from the n-grams with length from one to three characters at this position.
+	 */
+	for(iter=inText; *iter; iter++)
+	{
+		for(length=1; length<=ESDASHBOARD_APPLICATION_DATABASE_SEARCH_INDEX_MAX_NGRAM; length++)
+		{
+			guint							key;
+			GArray							*ids;
+
+			/* Stop at end of text or at end of current field */
+			if(!iter[length-1] || iter[length-1]==ESDASHBOARD_APPLICATION_DATABASE_SEARCH_INDEX_SEPARATOR) break;
+
+			/* Get list of IDs for n-gram */
+			key=ESDASHBOARD_APPLICATION_DATABASE_NGRAM_KEY(iter, length);
+			ids=(GArray*)g_hash_table_lookup(priv->searchIndex, GUINT_TO_POINTER(key));
+
+			if(inAdd)
+			{
+				/* Create list of IDs for n-gram if it does not exist yet */
+				if(!ids)
+				{
+					ids=g_array_new(FALSE, FALSE, sizeof(guint));
+					g_hash_table_insert(priv->searchIndex, GUINT_TO_POINTER(key), ids);
+				}
+
+				/* IDs are increasing so the list stays sorted when appending.
+				 * It also means that an n-gram occuring more than once in text
+				 * is already added if it is the last ID in list.
+				 */
+				if(ids->len==0 || g_array_index(ids, guint, ids->len-1)!=inID)
+				{
+					g_array_append_val(ids, inID);
+				}
+			}
+				else if(ids)
+				{
+					guint					left, right;
+
+					/* Lookup ID in sorted list with binary search and remove it */
+					left=0;
+					right=ids->len;
+					while(left<right)
+					{
+						guint				middle;
+						guint				middleID;
+
+						middle=left+(right-left)/2;
+						middleID=g_array_index(ids, guint, middle);
+						if(middleID==inID)
+						{
+							g_array_remove_index(ids, middle);
+							break;
+						}
+
+						if(middleID<inID) left=middle+1;
+							else right=middle;
+					}
+
+					/* Remove n-gram from index if no application contains it anymore */
+					if(ids->len==0) g_hash_table_remove(priv->searchIndex, GUINT_TO_POINTER(key));
+				}
+		}
+	}
+}
+
+/* Add application to or remove it from suffix index at each part of its
+ * desktop ID following a dash. A desktop ID of an application located in a
+ * sub-directory of a search path is prefixed with the sub-directory's name
+ * followed by a dash, so this index allows to look up such applications by
+ * the desktop ID they would have without sub-directory. Search index must
+ * be locked.
+ */
+static void _esdashboard_application_database_suffix_index_update(EsdashboardApplicationDatabase *self,
+																	GAppInfo *inAppInfo,
+																	gboolean inAdd)
+{
+	EsdashboardApplicationDatabasePrivate			*priv;
+	const gchar										*desktopID;
+	const gchar										*suffix;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
+
+	priv=self->priv;
+
+	desktopID=g_app_info_get_id(inAppInfo);
+	if(!desktopID) return;
+
+	for(suffix=strchr(desktopID, '-'); suffix; suffix=strchr(suffix+1, '-'))
+	{
+		GPtrArray									*apps;
+
+		if(!*(suffix+1)) continue;
+
+		apps=(GPtrArray*)g_hash_table_lookup(priv->suffixIndex, suffix+1);
+		if(inAdd)
+		{
+			if(!apps)
+			{
+				apps=g_ptr_array_new();
+				g_hash_table_insert(priv->suffixIndex, g_strdup(suffix+1), apps);
+			}
+			g_ptr_array_add(apps, inAppInfo);
+		}
+			else if(apps)
+			{
+				g_ptr_array_remove(apps, inAppInfo);
+				if(apps->len==0) g_hash_table_remove(priv->suffixIndex, suffix+1);
+			}
+	}
+}
+
+/* Remove entry from search index. Search index must be locked. */
+static void _esdashboard_application_database_search_index_remove_entry(EsdashboardApplicationDatabase *self,
+																		EsdashboardApplicationDatabaseSearchIndexEntry *inEntry)
+{
+	EsdashboardApplicationDatabasePrivate			*priv;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(inEntry);
+
+	priv=self->priv;
+
+	/* Remove ID of application from all n-grams of the text it was indexed with */
+	if(inEntry->text) _esdashboard_application_database_search_index_update_ngrams(self, inEntry->text, inEntry->id, FALSE);
+
+	/* Remove application from suffix index */
+	_esdashboard_application_database_suffix_index_update(self, inEntry->appInfo, FALSE);
+
+	/* Remove entry. Its ID is not reused to keep lists of IDs sorted but
+	 * IDs get compacted when too many entries were removed.
+	 */
+	g_ptr_array_index(priv->searchIndexEntriesByID, inEntry->id)=NULL;
+	g_hash_table_remove(priv->searchIndexEntries, inEntry->appInfo);
+	priv->searchIndexDeadEntries++;
+}
+
+/* Compact IDs of search index if more entries were removed than are alive.
+ * Remaining entries keep their order, so each list of IDs stays sorted when
+ * its IDs are replaced by the compacted ones. Search index must be locked.
+ */
+static void _esdashboard_application_database_search_index_compact(EsdashboardApplicationDatabase *self)
+{
+	EsdashboardApplicationDatabasePrivate			*priv;
+	guint											*compactedIDs;
+	guint											liveEntries;
+	guint											i;
+	GHashTableIter									iter;
+	GArray											*ids;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+
+	priv=self->priv;
+
+	/* Check if compaction is needed */
+	if(priv->searchIndexDeadEntries<ESDASHBOARD_APPLICATION_DATABASE_SEARCH_INDEX_MIN_DEAD_ENTRIES ||
+		priv->searchIndexDeadEntries<=g_hash_table_size(priv->searchIndexEntries))
+	{
+		return;
+	}
+
+	/* Move alive entries to the front and remember their new IDs */
+	compactedIDs=g_new(guint, priv->searchIndexEntriesByID->len);
+
+	liveEntries=0;
+	for(i=0; i<priv->searchIndexEntriesByID->len; i++)
+	{
+		EsdashboardApplicationDatabaseSearchIndexEntry	*entry;
+
+		entry=g_ptr_array_index(priv->searchIndexEntriesByID, i);
+		if(!entry) continue;
+
+		compactedIDs[i]=liveEntries;
+		entry->id=liveEntries;
+		g_ptr_array_index(priv->searchIndexEntriesByID, liveEntries)=entry;
+		liveEntries++;
+	}
+
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Compacting search index from %u to %u IDs",
+						priv->searchIndexEntriesByID->len,
+						liveEntries);
+
+	g_ptr_array_set_size(priv->searchIndexEntriesByID, liveEntries);
+	priv->searchIndexDeadEntries=0;
+
+	/* Replace IDs in lists of all n-grams. Removed entries were removed
+	 * from these lists already, so each ID refers to an alive entry.
+	 */
+	g_hash_table_iter_init(&iter, priv->searchIndex);
+	while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&ids))
+	{
+		for(i=0; i<ids->len; i++)
+		{
+			g_array_index(ids, guint, i)=compactedIDs[g_array_index(ids, guint, i)];
+		}
+	}
+
+	/* Release allocated resources */
+	g_free(compactedIDs);
+}
+
+/* Add application to search index or replace it if already indexed */
+static void _esdashboard_application_database_search_index_add(EsdashboardApplicationDatabase *self,
+																GAppInfo *inAppInfo)
+{
+	EsdashboardApplicationDatabasePrivate			*priv;
+	EsdashboardApplicationDatabaseSearchIndexEntry	*entry;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
+
+	priv=self->priv;
+
+	/* Lock for thread-safety */
+	G_LOCK(_esdashboard_application_database_search_index_lock);
+
+	/* Remove application from index if it was indexed before */
+	entry=(EsdashboardApplicationDatabaseSearchIndexEntry*)g_hash_table_lookup(priv->searchIndexEntries, inAppInfo);
+	if(entry) _esdashboard_application_database_search_index_remove_entry(self, entry);
+
+	/* Create entry for application with a new ID */
+	entry=g_new0(EsdashboardApplicationDatabaseSearchIndexEntry, 1);
+	entry->id=priv->searchIndexEntriesByID->len;
+	entry->appInfo=g_object_ref(inAppInfo);
+	entry->text=_esdashboard_application_database_search_index_get_text(inAppInfo);
+
+	g_ptr_array_add(priv->searchIndexEntriesByID, entry);
+	g_hash_table_insert(priv->searchIndexEntries, entry->appInfo, entry);
+
+	/* Add ID of application to all n-grams of its text */
+	if(entry->text) _esdashboard_application_database_search_index_update_ngrams(self, entry->text, entry->id, TRUE);
+
+	/* Add application to suffix index */
+	_esdashboard_application_database_suffix_index_update(self, entry->appInfo, TRUE);
+
+	/* Compact IDs if application replaced an entry too often */
+	_esdashboard_application_database_search_index_compact(self);
+
+	/* Unlock for thread-safety */
+	G_UNLOCK(_esdashboard_application_database_search_index_lock);
+}
+
+/* Remove application from search index */
+static void _esdashboard_application_database_search_index_remove(EsdashboardApplicationDatabase *self,
+																	GAppInfo *inAppInfo)
+{
+	EsdashboardApplicationDatabasePrivate			*priv;
+	EsdashboardApplicationDatabaseSearchIndexEntry	*entry;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
+
+	priv=self->priv;
+
+	/* Lock for thread-safety */
+	G_LOCK(_esdashboard_application_database_search_index_lock);
+
+	/* Lookup entry of application and remove it if it is indexed */
+	entry=(EsdashboardApplicationDatabaseSearchIndexEntry*)g_hash_table_lookup(priv->searchIndexEntries, inAppInfo);
+	if(entry)
+	{
+		_esdashboard_application_database_search_index_remove_entry(self, entry);
+		_esdashboard_application_database_search_index_compact(self);
+	}
+
+	/* Unlock for thread-safety */
+	G_UNLOCK(_esdashboard_application_database_search_index_lock);
+}
+
+/* Clear search index */
+static void _esdashboard_application_database_search_index_clear(EsdashboardApplicationDatabase *self)
+{
+	EsdashboardApplicationDatabasePrivate			*priv;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+
+	priv=self->priv;
+
+	/* Lock for thread-safety */
+	G_LOCK(_esdashboard_application_database_search_index_lock);
+
+	if(priv->searchIndex) g_hash_table_remove_all(priv->searchIndex);
+	if(priv->searchIndexEntries) g_hash_table_remove_all(priv->searchIndexEntries);
+	if(priv->searchIndexEntriesByID) g_ptr_array_set_size(priv->searchIndexEntriesByID, 0);
+	priv->searchIndexDeadEntries=0;
+	if(priv->suffixIndex) g_hash_table_remove_all(priv->suffixIndex);
+
+	/* Unlock for thread-safety */
+	G_UNLOCK(_esdashboard_application_database_search_index_lock);
+}
+
+/* Rebuild search index for all applications in database */
+static void _esdashboard_application_database_search_index_rebuild(EsdashboardApplicationDatabase *self)
+{
+	EsdashboardApplicationDatabasePrivate			*priv;
+	GHashTableIter									iter;
+	GAppInfo										*appInfo;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+
+	priv=self->priv;
+
+	/* Clear search index */
+	_esdashboard_application_database_search_index_clear(self);
+
+	/* Add each application to search index */
+	if(priv->applications)
+	{
+		g_hash_table_iter_init(&iter, priv->applications);
+		while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&appInfo))
+		{
+			_esdashboard_application_database_search_index_add(self, appInfo);
+		}
+	}
+
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Built search index with %u n-grams for %u applications",
+						g_hash_table_size(priv->searchIndex),
+						g_hash_table_size(priv->searchIndexEntries));
+}
+
+/* Free entry of search index */
+static void _esdashboard_application_database_search_index_entry_free(EsdashboardApplicationDatabaseSearchIndexEntry *inEntry)
+{
+	g_return_if_fail(inEntry);
+
+	/* Release allocated resources */
+	if(inEntry->appInfo) g_object_unref(inEntry->appInfo);
+	if(inEntry->text) g_free(inEntry->text);
+	g_free(inEntry);
+}
+
+/* Intersect sorted list of IDs with another sorted list of IDs in-place */
+static void _esdashboard_application_database_search_index_intersect(GArray *ioIDs, GArray *inOtherIDs)
+{
+	guint											i, j, k;
+
+	g_return_if_fail(ioIDs);
+
+	/* If other list does not exist, intersection is empty */
+	if(!inOtherIDs)
+	{
+		g_array_set_size(ioIDs, 0);
+		return;
+	}
+
+	/* Merge both sorted lists and keep only IDs found in both lists */
+	i=j=k=0;
+	while(i<ioIDs->len && j<inOtherIDs->len)
+	{
+		guint										left, right;
+
+		left=g_array_index(ioIDs, guint, i);
+		right=g_array_index(inOtherIDs, guint, j);
+
+		if(left<right) i++;
+			else if(left>right) j++;
+			else
+			{
+				g_array_index(ioIDs, guint, k)=left;
+				k++;
+				i++;
+				j++;
+			}
+	}
+	g_array_set_size(ioIDs, k);
+}
+
 /* Application menu needs to be reloaded */
 static void _esdashboard_application_database_on_application_menu_reload_required(EsdashboardApplicationDatabase *self,
 																					gpointer inUserData)
 {
 	MarkonMenu		*menu;
-	GError			*error;
 
 	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
 	g_return_if_fail(MARKON_IS_MENU(inUserData));
 
 	menu=MARKON_MENU(inUserData);
-	error=NULL;
 
-	/* Reload application menu. This also emits all necessary signals. */
+	/* Reload application menu in background. This also emits all necessary signals. */
 	ESDASHBOARD_DEBUG(self, APPLICATIONS,
 						"Menu '%s' changed and requires a reload of application menu",
 						markon_menu_element_get_name(MARKON_MENU_ELEMENT(menu)));
-	if(!_esdashboard_application_database_load_application_menu(self, &error))
-	{
-		g_critical("Could not reload application menu: %s",
-					error ? error->message : "Unknown error");
-
-		/* Release allocated resources */
-		if(error) g_error_free(error);
-	}
+	_esdashboard_application_database_load_application_menu_async(self);
 }
 
 /* Create a new data structure for file monitor */
@@ -240,45 +753,338 @@ static EsdashboardApplicationDatabaseFileMonitorData* _esdashboard_application_d
 	return(NULL);
 }
 
-/* A directory containing desktop files has changed */
-static void _esdashboard_application_database_on_file_monitor_changed(EsdashboardApplicationDatabase *self,
-																		GFile *inFile,
-																		GFile *inOtherFile,
-																		GFileMonitorEvent inEventType,
-																		gpointer inUserData)
+/* Determine current state of each desktop ID affected by the changed desktop
+ * files collected and emit the differences as one batch.
+ */
+static void _esdashboard_application_database_process_pending_changes(EsdashboardApplicationDatabase *self)
 {
 	EsdashboardApplicationDatabasePrivate				*priv;
-	GFileMonitor										*monitor;
-	EsdashboardApplicationDatabaseFileMonitorData		*monitorData;
-	gchar												*filePath;
+	GHashTable											*pendingFiles;
+	GHashTable											*desktopIDs;
+	GHashTableIter										iter;
+	GFile												*file;
+	const gchar											*desktopID;
+	gpointer											touched;
+	GList												*added;
+	GList												*removed;
+	GList												*changed;
+	GList												*listIter;
 
 	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
-	g_return_if_fail(G_IS_FILE_MONITOR(inUserData));
 
 	priv=self->priv;
-	monitor=G_FILE_MONITOR(inUserData);
 
-	/* Find file monitor data structure of file monitor emitting this signal */
-	monitorData=_esdashboard_application_database_monitor_data_find_by_monitor(self, monitor);
-	if(!monitorData)
+	/* Take pending changes */
+	pendingFiles=priv->pendingChanges;
+	priv->pendingChanges=NULL;
+	priv->pendingChangesSince=0;
+	if(!pendingFiles) return;
+
+	if(!priv->applications)
 	{
-		g_warning("Received event from unknown file monitor");
+		g_hash_table_unref(pendingFiles);
 		return;
 	}
 
-	/* Get file path */
-	filePath=g_file_get_path(inFile);
+	/* Collect desktop IDs affected and remember for each desktop ID if the
+	 * desktop file of its current desktop app info was touched as only then
+	 * it needs to be reloaded.
+	 */
+	desktopIDs=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
 
-	/* Check if a new directory was created */
-	if(inEventType==G_FILE_MONITOR_EVENT_CREATED &&
-		g_file_query_file_type(inFile, G_FILE_QUERY_INFO_NONE, NULL)==G_FILE_TYPE_DIRECTORY)
+	g_hash_table_iter_init(&iter, pendingFiles);
+	while(g_hash_table_iter_next(&iter, (gpointer*)&file, NULL))
 	{
-		EsdashboardApplicationDatabaseFileMonitorData	*fileMonitorData;
-		GError											*error;
-
-		error=NULL;
+		EsdashboardDesktopAppInfo						*appInfo;
+		gchar											*fileDesktopID;
+		gboolean										isTouched;
+
+		fileDesktopID=esdashboard_application_database_get_desktop_id_from_file(file);
+		if(!fileDesktopID) continue;
+
+		isTouched=FALSE;
+		appInfo=g_hash_table_lookup(priv->applications, fileDesktopID);
+		if(appInfo &&
+			esdashboard_desktop_app_info_get_file(appInfo) &&
+			g_file_equal(esdashboard_desktop_app_info_get_file(appInfo), file))
+		{
+			isTouched=TRUE;
+		}
 
-		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+		if(g_hash_table_lookup_extended(desktopIDs, fileDesktopID, NULL, &touched))
+		{
+			if(isTouched) g_hash_table_insert(desktopIDs, fileDesktopID, GINT_TO_POINTER(TRUE));
+				else g_free(fileDesktopID);
+		}
+			else g_hash_table_insert(desktopIDs, fileDesktopID, GINT_TO_POINTER(isTouched));
+	}
+
+	g_hash_table_unref(pendingFiles);
+
+	/* Compare current desktop app info of each desktop ID affected with the
+	 * desktop file which has the highest priority now.
+	 */
+	added=NULL;
+	removed=NULL;
+	changed=NULL;
+
+	g_hash_table_iter_init(&iter, desktopIDs);
+	while(g_hash_table_iter_next(&iter, (gpointer*)&desktopID, &touched))
+	{
+		EsdashboardDesktopAppInfo						*appInfo;
+		gchar											*newDesktopFilename;
+		GFile											*newDesktopFile;
+		gboolean										isValid;
+
+		appInfo=g_hash_table_lookup(priv->applications, desktopID);
+
+		newDesktopFilename=esdashboard_application_database_get_file_from_desktop_id(desktopID);
+		newDesktopFile=newDesktopFilename ? g_file_new_for_path(newDesktopFilename) : NULL;
+
+		if(appInfo &&
+			newDesktopFile &&
+			g_file_equal(esdashboard_desktop_app_info_get_file(appInfo), newDesktopFile) &&
+			!GPOINTER_TO_INT(touched))
+		{
+			/* Only desktop files of lower priority changed for this desktop ID */
+			ESDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Ignoring changes for desktop ID '%s' as desktop file '%s' still has highest priority",
+								desktopID,
+								newDesktopFilename);
+		}
+			else if(appInfo && newDesktopFile)
+			{
+				/* Reload desktop app info if its desktop file was modified or
+				 * set the desktop file replacing it. Both emit the 'changed'
+				 * signal at desktop app info.
+				 */
+				if(GPOINTER_TO_INT(touched) &&
+					g_file_equal(esdashboard_desktop_app_info_get_file(appInfo), newDesktopFile))
+				{
+					ESDASHBOARD_DEBUG(self, APPLICATIONS,
+										"Reloading desktop ID '%s' from modified desktop file '%s'",
+										desktopID,
+										newDesktopFilename);
+
+					isValid=esdashboard_desktop_app_info_reload(appInfo);
+				}
+					else
+					{
+						ESDASHBOARD_DEBUG(self, APPLICATIONS,
+											"Replacing desktop file of known desktop ID '%s' with '%s'",
+											desktopID,
+											newDesktopFilename);
+
+						g_object_set(appInfo, "file", newDesktopFile, NULL);
+						isValid=TRUE;
+					}
+
+				if(isValid && esdashboard_desktop_app_info_is_valid(appInfo))
+				{
+					_esdashboard_application_database_search_index_add(self, G_APP_INFO(appInfo));
+					changed=g_list_prepend(changed, g_object_ref(appInfo));
+				}
+					else
+					{
+						/* Reload failed or desktop app info is invalid now, so
+						 * remove it but keep a reference for signal emission.
+						 */
+						ESDASHBOARD_DEBUG(self, APPLICATIONS,
+											"Removing desktop ID '%s' because desktop file '%s' is invalid",
+											desktopID,
+											newDesktopFilename);
+
+						g_object_ref(appInfo);
+						g_hash_table_remove(priv->applications, desktopID);
+						_esdashboard_application_database_search_index_remove(self, G_APP_INFO(appInfo));
+						removed=g_list_prepend(removed, appInfo);
+					}
+			}
+			else if(appInfo)
+			{
+				/* There is no desktop file for this desktop ID anymore */
+				ESDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Removing desktop ID '%s'",
+									desktopID);
+
+				g_object_ref(appInfo);
+				g_hash_table_remove(priv->applications, desktopID);
+				_esdashboard_application_database_search_index_remove(self, G_APP_INFO(appInfo));
+				removed=g_list_prepend(removed, appInfo);
+			}
+			else if(newDesktopFile)
+			{
+				/* Desktop ID is completely new */
+				appInfo=ESDASHBOARD_DESKTOP_APP_INFO(g_object_new(ESDASHBOARD_TYPE_DESKTOP_APP_INFO,
+																	"desktop-id", desktopID,
+																	"file", newDesktopFile,
+																	NULL));
+				if(esdashboard_desktop_app_info_is_valid(appInfo))
+				{
+					ESDASHBOARD_DEBUG(self, APPLICATIONS,
+										"Adding new desktop ID '%s' for desktop file '%s'",
+										desktopID,
+										newDesktopFilename);
+
+					g_hash_table_insert(priv->applications, g_strdup(desktopID), g_object_ref(appInfo));
+					_esdashboard_application_database_search_index_add(self, G_APP_INFO(appInfo));
+					added=g_list_prepend(added, appInfo);
+				}
+					else
+					{
+						ESDASHBOARD_DEBUG(self, APPLICATIONS,
+											"Ignoring invalid desktop file '%s' for new desktop ID '%s'",
+											newDesktopFilename,
+											desktopID);
+
+						g_object_unref(appInfo);
+					}
+			}
+
+		/* Release allocated resources */
+		if(newDesktopFile) g_object_unref(newDesktopFile);
+		if(newDesktopFilename) g_free(newDesktopFilename);
+	}
+
+	g_hash_table_unref(desktopIDs);
+
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Applications changed: %u added, %u removed, %u changed",
+						g_list_length(added),
+						g_list_length(removed),
+						g_list_length(changed));
+
+	/* Emit signals for each application added or removed and then one signal
+	 * for the whole batch.
+	 */
+	for(listIter=added; listIter; listIter=g_list_next(listIter))
+	{
+		g_signal_emit(self, EsdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_ADDED], 0, listIter->data);
+	}
+
+	for(listIter=removed; listIter; listIter=g_list_next(listIter))
+	{
+		g_signal_emit(self, EsdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_REMOVED], 0, listIter->data);
+	}
+
+	if(added || removed || changed)
+	{
+		g_signal_emit(self, EsdashboardApplicationDatabaseSignals[SIGNAL_APPLICATIONS_CHANGED], 0, added, removed, changed);
+	}
+
+	/* Unset file at removed desktop app infos which causes the 'changed'
+	 * signal to be emitted at them.
+	 */
+	for(listIter=removed; listIter; listIter=g_list_next(listIter))
+	{
+		g_object_set(listIter->data, "file", NULL, NULL);
+	}
+
+	/* Release allocated resources */
+	g_list_free_full(added, g_object_unref);
+	g_list_free_full(removed, g_object_unref);
+	g_list_free_full(changed, g_object_unref);
+}
+
+/* Timeout to process pending changes of desktop files has been reached */
+static gboolean _esdashboard_application_database_on_pending_changes_timeout(gpointer inUserData)
+{
+	EsdashboardApplicationDatabase						*self;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(inUserData), G_SOURCE_REMOVE);
+
+	self=ESDASHBOARD_APPLICATION_DATABASE(inUserData);
+
+	self->priv->pendingChangesID=0;
+	_esdashboard_application_database_process_pending_changes(self);
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* Remember a changed desktop file and (re)schedule processing of all pending
+ * changes. Changes are processed when no further change happened for a short
+ * time but not deferred longer than a maximum time, e.g. while a package
+ * manager installs a lot of desktop files.
+ */
+static void _esdashboard_application_database_queue_change(EsdashboardApplicationDatabase *self, GFile *inFile)
+{
+	EsdashboardApplicationDatabasePrivate				*priv;
+	gint64												now;
+	gint64												elapsed;
+	guint												delay;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(G_IS_FILE(inFile));
+
+	priv=self->priv;
+
+	if(!priv->pendingChanges)
+	{
+		priv->pendingChanges=g_hash_table_new_full(g_file_hash,
+													(GEqualFunc)g_file_equal,
+													g_object_unref,
+													NULL);
+	}
+	g_hash_table_add(priv->pendingChanges, g_object_ref(inFile));
+
+	now=g_get_monotonic_time();
+	if(!priv->pendingChangesSince) priv->pendingChangesSince=now;
+	elapsed=(now-priv->pendingChangesSince)/1000;
+
+	delay=ESDASHBOARD_APPLICATION_DATABASE_CHANGES_DELAY;
+	if(elapsed+delay>ESDASHBOARD_APPLICATION_DATABASE_CHANGES_MAX_DELAY)
+	{
+		delay=(guint)MAX(0, ESDASHBOARD_APPLICATION_DATABASE_CHANGES_MAX_DELAY-elapsed);
+	}
+
+	if(priv->pendingChangesID) g_source_remove(priv->pendingChangesID);
+	priv->pendingChangesID=g_timeout_add(delay, _esdashboard_application_database_on_pending_changes_timeout, self);
+}
+
+/* A directory containing desktop files has changed */
+static void _esdashboard_application_database_on_file_monitor_changed(EsdashboardApplicationDatabase *self,
+																		GFile *inFile,
+																		GFile *inOtherFile,
+																		GFileMonitorEvent inEventType,
+																		gpointer inUserData)
+{
+	EsdashboardApplicationDatabasePrivate				*priv;
+	GFileMonitor										*monitor;
+	EsdashboardApplicationDatabaseFileMonitorData		*monitorData;
+	gchar												*filePath;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(G_IS_FILE_MONITOR(inUserData));
+
+	priv=self->priv;
+	monitor=G_FILE_MONITOR(inUserData);
+
+	/* Find file monitor data structure of file monitor emitting this signal */
+	monitorData=_esdashboard_application_database_monitor_data_find_by_monitor(self, monitor);
+	if(!monitorData)
+	{
+		g_warning("Received event from unknown file monitor");
+		return;
+	}
+
+	/* Get file path */
+	filePath=g_file_get_path(inFile);
+
+	/* Any change invalidates cache as modifying a desktop file in place
+	 * does not change modification time of its directory.
+	 */
+	_esdashboard_application_database_remove_cache(self);
+
+	/* Check if a new directory was created */
+	if(inEventType==G_FILE_MONITOR_EVENT_CREATED &&
+		g_file_query_file_type(inFile, G_FILE_QUERY_INFO_NONE, NULL)==G_FILE_TYPE_DIRECTORY)
+	{
+		EsdashboardApplicationDatabaseFileMonitorData	*fileMonitorData;
+		GError											*error;
+
+		error=NULL;
+
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
 							"Directory '%s' in application search paths was created",
 							filePath);
 
@@ -318,412 +1124,618 @@ static void _esdashboard_application_database_on_file_monitor_changed(Esdashboar
 		priv->appDirMonitors=g_list_prepend(priv->appDirMonitors, fileMonitorData);
 	}
 
-	/* Check if a new desktop file was created */
-	if(inEventType==G_FILE_MONITOR_EVENT_CREATED &&
-		g_file_query_file_type(inFile, G_FILE_QUERY_INFO_NONE, NULL)==G_FILE_TYPE_REGULAR)
+	/* Check if a file or directory was removed.
+	 * The problem here is that we cannot determine if the removed file
+	 * is really a file or a directory because we cannot query the file type
+	 * because it is removed at filesystem. So assume it was a directory
+	 * and remove its file monitor if any. If it was a desktop file it is
+	 * handled below.
+	 */
+	if(inEventType==G_FILE_MONITOR_EVENT_DELETED)
 	{
-		/* Handle only desktop files but that can only be done
-		 * if a hash table exists.
-		 */
-		if(g_str_has_suffix(filePath, ".desktop") &&
-			priv->applications)
-		{
-			gchar										*desktopID;
+		EsdashboardApplicationDatabaseFileMonitorData	*fileMonitorData;
 
+		fileMonitorData=_esdashboard_application_database_monitor_data_find_by_file(self, inFile);
+		if(fileMonitorData)
+		{
 			ESDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Desktop file '%s' in application search paths was created",
+								"Removing file monitor for deleted directory '%s'",
 								filePath);
 
-			/* Get desktop ID to check */
-			desktopID=esdashboard_application_database_get_desktop_id_from_file(inFile);
+			priv->appDirMonitors=g_list_remove_all(priv->appDirMonitors, fileMonitorData);
+			_esdashboard_application_database_monitor_data_free(fileMonitorData);
+			fileMonitorData=NULL;
+		}
+	}
 
-			/* If we found the desktop ID for the desktop file created check
-			 * if it would replace an existing desktop ID in hash table or
-			 * if it is a completely new one.
-			 */
-			if(desktopID)
-			{
-				EsdashboardDesktopAppInfo				*currentDesktopAppInfo;
+	/* A desktop file was created, modified or removed. Do not handle it now
+	 * but collect it, so that all changes of e.g. a package manager
+	 * transaction are processed at once. This can only be done if a hash
+	 * table exists.
+	 */
+	if((inEventType==G_FILE_MONITOR_EVENT_CREATED ||
+			inEventType==G_FILE_MONITOR_EVENT_CHANGED ||
+			inEventType==G_FILE_MONITOR_EVENT_DELETED) &&
+		filePath &&
+		g_str_has_suffix(filePath, ".desktop") &&
+		priv->applications)
+	{
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Desktop file '%s' in application search paths changed",
+							filePath);
 
-				/* Get current desktop app info */
-				if(g_hash_table_lookup_extended(priv->applications, desktopID, NULL, (gpointer*)&currentDesktopAppInfo))
-				{
-					gchar								*newDesktopFilename;
-					GFile								*newDesktopFile;
-
-					/* Check if newly created desktop file would replace current one.
-					 * Now as the desktop file is created and exists we can call the
-					 * function which searches the first matching desktop file for
-					 * this desktop ID. If it is the same as the file created then
-					 * it replaces the current desktop app info. Otherwise ignore this
-					 * newly created file because id does not affect the hash table.
-					 */
-					newDesktopFilename=esdashboard_application_database_get_file_from_desktop_id(desktopID);
-					newDesktopFile=g_file_new_for_path(newDesktopFilename);
-					if(g_file_equal(newDesktopFile, inFile))
-					{
-						/* Newly created desktop file replaces current one. Set
-						 * new file at desktop app info to emit 'changed' signal.
-						 * No need to change anything at hash table.
-						 */
-						g_object_set(currentDesktopAppInfo, "file", newDesktopFile, NULL);
+		_esdashboard_application_database_queue_change(self, inFile);
+	}
 
-						ESDASHBOARD_DEBUG(self, APPLICATIONS,
-											"Replacing known desktop ID '%s' at desktop file '%s' with new desktop file '%s'",
-											desktopID,
-											filePath,
-											newDesktopFilename);
-					}
-						else
-						{
-							ESDASHBOARD_DEBUG(self, APPLICATIONS,
-												"Ignoring new desktop file at '%s' for known desktop ID '%s'",
-												filePath,
-												desktopID);
-						}
+	/* Release allocated resources */
+	if(filePath) g_free(filePath);
+}
 
-					/* Release allocated resources */
-					if(newDesktopFile) g_object_unref(newDesktopFile);
-					if(newDesktopFilename) g_free(newDesktopFilename);
-				}
-					else
-					{
-						EsdashboardDesktopAppInfo		*newDesktopAppInfo;
+/* Get path of cache file for application database */
+static gchar* _esdashboard_application_database_get_cache_filename(void)
+{
+	return(g_build_filename(g_get_user_cache_dir(),
+							"esdashboard",
+							ESDASHBOARD_APPLICATION_DATABASE_CACHE_FILE,
+							NULL));
+}
 
-						/* There is no desktop app info for this desktop ID in
-						 * hash table. So it is completely new. Create a new
-						 * desktop app info, add it to hash table and emit the
-						 * signal for application added.
-						 */
-						newDesktopAppInfo=ESDASHBOARD_DESKTOP_APP_INFO(g_object_new(ESDASHBOARD_TYPE_DESKTOP_APP_INFO,
-																					"desktop-id", desktopID,
-																					"file", inFile,
-																					NULL));
+/* Get key of a directory at a search path in cache */
+static gchar* _esdashboard_application_database_get_cache_key(guint inSearchPathIndex, const gchar *inPath)
+{
+	return(g_strdup_printf("%u:%s", inSearchPathIndex, inPath));
+}
 
-						if(esdashboard_desktop_app_info_is_valid(newDesktopAppInfo))
-						{
-							/* Add desktop app info to hash table because creation
-							 * was successful.
-							 */
-							g_hash_table_insert(priv->applications, g_strdup(desktopID), newDesktopAppInfo);
+/* Load records of directories scanned last time from cache. Returns NULL
+ * if there is no cache or if it was created for other search paths or other
+ * languages.
+ */
+static GHashTable* _esdashboard_application_database_load_cache(EsdashboardApplicationDatabase *self)
+{
+	EsdashboardApplicationDatabasePrivate			*priv;
+	gchar											*filename;
+	GMappedFile										*mappedFile;
+	GBytes											*bytes;
+	GVariant										*cache;
+	GVariant										*searchPaths;
+	GVariant										*languages;
+	GVariant										*records;
+	GVariant										*record;
+	GVariantIter									recordsIter;
+	GHashTable										*cachedRecords;
+	guint32											version;
+	gboolean										isValid;
+	GList											*iter;
+	const gchar* const								*languageNames;
+	gsize											i;
+	GError											*error;
 
-							/* Emit signal that an application has been removed from hash table */
-							g_signal_emit(self, EsdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_ADDED], 0, newDesktopAppInfo);
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self), NULL);
 
-							ESDASHBOARD_DEBUG(self, APPLICATIONS,
-												"Adding new desktop ID '%s' for new desktop file at '%s'",
-												desktopID,
-												filePath);
-						}
-							else
-							{
-								ESDASHBOARD_DEBUG(self, APPLICATIONS,
-													"Adding new desktop ID '%s' for new desktop file '%s' failed",
-													desktopID,
-													filePath);
-
-								/* Release allocated resources */
-								g_object_unref(newDesktopAppInfo);
-							}
-					}
-			}
+	priv=self->priv;
+	error=NULL;
+
+	/* Map cache file into memory */
+	filename=_esdashboard_application_database_get_cache_filename();
+	mappedFile=g_mapped_file_new(filename, FALSE, &error);
+	if(!mappedFile)
+	{
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Could not load application cache from '%s': %s",
+							filename,
+							error ? error->message : "Unknown error");
+
+		/* Release allocated resources */
+		if(error) g_error_free(error);
+		g_free(filename);
+
+		return(NULL);
+	}
+
+	bytes=g_mapped_file_get_bytes(mappedFile);
+	cache=g_variant_ref_sink(g_variant_new_from_bytes(G_VARIANT_TYPE(ESDASHBOARD_APPLICATION_DATABASE_CACHE_TYPE), bytes, FALSE));
+	g_bytes_unref(bytes);
+	g_mapped_file_unref(mappedFile);
+
+	/* Check that cache has the expected version and was created for the
+	 * same search paths in the same order as desktop IDs and their priority
+	 * depend on them.
+	 */
+	g_variant_get_child(cache, 0, "u", &version);
+	isValid=(version==ESDASHBOARD_APPLICATION_DATABASE_CACHE_VERSION);
+
+	searchPaths=g_variant_get_child_value(cache, 1);
+	for(iter=priv->searchPaths, i=0; isValid && iter; iter=g_list_next(iter), i++)
+	{
+		const gchar									*path;
+
+		if(i>=g_variant_n_children(searchPaths))
+		{
+			isValid=FALSE;
+			break;
 		}
+
+		g_variant_get_child(searchPaths, i, "&s", &path);
+		if(g_strcmp0(path, (const gchar*)iter->data)!=0) isValid=FALSE;
 	}
+	if(isValid && i!=g_variant_n_children(searchPaths)) isValid=FALSE;
+	g_variant_unref(searchPaths);
 
-	/* Check if a file was modified */
-	if(inEventType==G_FILE_MONITOR_EVENT_CHANGED &&
-		g_file_query_file_type(inFile, G_FILE_QUERY_INFO_NONE, NULL)==G_FILE_TYPE_REGULAR)
+	/* Check that cache was created for the same languages in the same order
+	 * as names, descriptions and action names stored are localized.
+	 */
+	languageNames=g_get_language_names();
+	languages=g_variant_get_child_value(cache, 2);
+	for(i=0; isValid && languageNames[i]; i++)
 	{
-		/* Handle only desktop files but that can only be done
-		 * if a hash table exists.
-		 */
-		if(g_str_has_suffix(filePath, ".desktop") &&
-			priv->applications)
+		const gchar									*language;
+
+		if(i>=g_variant_n_children(languages))
 		{
-			gchar										*desktopID;
-			EsdashboardDesktopAppInfo					*appInfo;
+			isValid=FALSE;
+			break;
+		}
 
-			ESDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Desktop file '%s' was modified",
-								filePath);
+		g_variant_get_child(languages, i, "&s", &language);
+		if(g_strcmp0(language, languageNames[i])!=0) isValid=FALSE;
+	}
+	if(isValid && i!=g_variant_n_children(languages)) isValid=FALSE;
+	g_variant_unref(languages);
 
-			/* Get desktop ID to check */
-			desktopID=esdashboard_application_database_get_desktop_id_from_file(inFile);
+	if(!isValid)
+	{
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Ignoring outdated application cache at '%s'",
+							filename);
 
-			/* Get current desktop app info in hash table for desktop ID */
-			appInfo=NULL;
-			if(desktopID)
-			{
-				/* We have to check if the modified file is exactly the same
-				 * as the file used by current desktop app info for desktop ID.
-				 * Because a desktop file could be created which overrides
-				 * this desktop ID so the changes are not important anymore
-				 * and we do not need to emit 'changed' signal.
-				 * If a desktop file was added or removed the other handlers
-				 * have or will emit the needed signal to keep them up-to-date.
-				 */
-				if(g_hash_table_lookup_extended(priv->applications, desktopID, NULL, (gpointer*)&appInfo))
-				{
-					GFile								*appInfoFile;
-					gchar								*appInfoFilename;
+		/* Release allocated resources */
+		g_variant_unref(cache);
+		g_free(filename);
 
-					/* Get file of desktop app info found */
-					appInfoFile=esdashboard_desktop_app_info_get_file(appInfo);
-					appInfoFilename=g_file_get_path(appInfoFile);
+		return(NULL);
+	}
 
-					/* If file of desktop app info is the same as the one modified
-					 * then reload desktop app info.
-					 */
-					if(g_file_equal(appInfoFile, inFile))
-					{
-						/* Reload desktop app info but remove desktop app info
-						 * if reload failed or is invalid after reload.
-						 */
-						if(!esdashboard_desktop_app_info_reload(appInfo) ||
-							!esdashboard_desktop_app_info_is_valid(appInfo))
-						{
-							/* Take a extra reference of desktop app info which is
-							 * going to be removed from hash table because when removing
-							 * desktop ID from hash table could release the last reference
-							 * to desktop app info and destroy it. So we are not able
-							 * to send object when emitting signal 'application-removed'.
-							 */
-							g_object_ref(appInfo);
+	/* Collect records of all directories by search path and path */
+	cachedRecords=g_hash_table_new_full(g_str_hash,
+										g_str_equal,
+										g_free,
+										(GDestroyNotify)g_variant_unref);
 
-							/* Remove desktop app info from hash table because either
-							 * reload failed or it is invalid now.
-							 */
-							g_hash_table_remove(priv->applications, desktopID);
+	records=g_variant_get_child_value(cache, 3);
+	g_variant_iter_init(&recordsIter, records);
+	while((record=g_variant_iter_next_value(&recordsIter)))
+	{
+		guint32										searchPathIndex;
+		const gchar									*path;
+
+		g_variant_get_child(record, 0, "u", &searchPathIndex);
+		g_variant_get_child(record, 1, "&s", &path);
+		g_hash_table_insert(cachedRecords,
+							_esdashboard_application_database_get_cache_key(searchPathIndex, path),
+							record);
+	}
+	g_variant_unref(records);
 
-							ESDASHBOARD_DEBUG(self, APPLICATIONS,
-												"Removed desktop ID '%s' with origin desktop file '%s' with modified desktop file '%s' because reload failed or it is invalid",
-												desktopID,
-												filePath,
-												appInfoFilename);
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Loaded %u directories from application cache at '%s'",
+						g_hash_table_size(cachedRecords),
+						filename);
 
-							/* Emit signal that an application has been removed */
-							g_signal_emit(self, EsdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_REMOVED], 0, appInfo);
+	/* Release allocated resources */
+	g_variant_unref(cache);
+	g_free(filename);
 
-							/* Release extra reference we took on desktop app info and
-							 * let object maybe destroyed now because it was the last one.
-							 */
-							g_object_unref(appInfo);
-						}
-							else
-							{
-								ESDASHBOARD_DEBUG(self, APPLICATIONS,
-													"Reloaded desktop ID '%s' with origin desktop file '%s' with modified desktop file '%s'",
-													desktopID,
-													filePath,
-													appInfoFilename);
-							}
-					}
+	return(cachedRecords);
+}
 
-					/* Release allocated resources */
-					if(appInfoFilename) g_free(appInfoFilename);
-				}
-					else
-					{
-						EsdashboardDesktopAppInfo		*newDesktopAppInfo;
+/* Remove cache file, e.g. if a desktop file was modified in place which
+ * does not change the modification time of its directory.
+ */
+static void _esdashboard_application_database_remove_cache(EsdashboardApplicationDatabase *self)
+{
+	gchar											*filename;
 
-						/* We have a valid desktop ID but no app info in hash table
-						 * so try to create a desktop app info for modified file
-						 * and if it is valid add it to hash table and emit the
-						 * signal for application added.
-						 */
-						newDesktopAppInfo=ESDASHBOARD_DESKTOP_APP_INFO(g_object_new(ESDASHBOARD_TYPE_DESKTOP_APP_INFO,
-																					"desktop-id", desktopID,
-																					"file", inFile,
-																					NULL));
-						if(esdashboard_desktop_app_info_is_valid(newDesktopAppInfo))
-						{
-							g_hash_table_insert(priv->applications, g_strdup(desktopID), newDesktopAppInfo);
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
 
-							/* Emit signal that an application has been removed from hash table */
-							g_signal_emit(self, EsdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_ADDED], 0, newDesktopAppInfo);
+	filename=_esdashboard_application_database_get_cache_filename();
+	if(g_unlink(filename)==0)
+	{
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Removed application cache at '%s'",
+							filename);
+	}
+	g_free(filename);
+}
 
-							ESDASHBOARD_DEBUG(self, APPLICATIONS,
-												"Adding new desktop ID '%s' for modified desktop file at '%s'",
-												desktopID,
-												filePath);
-						}
-							else
-							{
-								ESDASHBOARD_DEBUG(self, APPLICATIONS,
-													"Got valid desktop id '%s' but invalid desktop app info for file '%s'",
-													desktopID,
-													filePath);
-								g_object_unref(newDesktopAppInfo);
-							}
-					}
-			}
+/* Get desktop ID for a desktop file found at a search path */
+static gchar* _esdashboard_application_database_get_desktop_id_at_search_path(GFile *inTopLevelPath,
+																				GFile *inFile)
+{
+	gchar											*desktopID;
+	gchar											*iter;
 
-			/* Release allocated resources */
-			if(desktopID) g_free(desktopID);
-		}
+	g_return_val_if_fail(G_IS_FILE(inTopLevelPath), NULL);
+	g_return_val_if_fail(G_IS_FILE(inFile), NULL);
+
+	/* Determine desktop ID for file */
+	desktopID=g_file_get_relative_path(inTopLevelPath, inFile);
+	if(!desktopID) return(NULL);
+
+	iter=desktopID;
+	while(*iter)
+	{
+		/* Replace directory sepearator with dash if needed */
+		if(*iter==G_DIR_SEPARATOR) *iter='-';
+
+		/* Continue with next character in desktop ID */
+		iter++;
 	}
 
-	/* Check if a file or directory was removed.
-	 * The problem here is that we cannot determine if the removed file
-	 * is really a file or a directory because we cannot query the file type
-	 * because it is removed at filesystem. So assume it was both:
-	 * a file and a directory.
-	 */
-	if(inEventType==G_FILE_MONITOR_EVENT_DELETED)
+	/* Return desktop ID */
+	return(desktopID);
+}
+
+/* Create data of a directory scanned at a search path */
+static EsdashboardApplicationDatabaseScanDirectoryData* _esdashboard_application_database_scan_directory_data_new(guint inSearchPathIndex,
+																													GFile *inDirectory,
+																													gint64 inModificationTime)
+{
+	EsdashboardApplicationDatabaseScanDirectoryData	*data;
+
+	g_return_val_if_fail(G_IS_FILE(inDirectory), NULL);
+
+	data=g_new0(EsdashboardApplicationDatabaseScanDirectoryData, 1);
+	data->searchPathIndex=inSearchPathIndex;
+	data->directory=g_object_ref(inDirectory);
+	data->path=g_file_get_path(inDirectory);
+	data->modificationTime=inModificationTime;
+	data->subdirectories=g_ptr_array_new_with_free_func(g_free);
+	data->entries=g_ptr_array_new_with_free_func((GDestroyNotify)g_variant_unref);
+
+	return(data);
+}
+
+/* Free data of a directory scanned */
+static void _esdashboard_application_database_scan_directory_data_free(EsdashboardApplicationDatabaseScanDirectoryData *inData)
+{
+	g_return_if_fail(inData);
+
+	/* Release allocated resources */
+	if(inData->directory) g_object_unref(inData->directory);
+	if(inData->path) g_free(inData->path);
+	if(inData->cachedRecord) g_variant_unref(inData->cachedRecord);
+	if(inData->subdirectories) g_ptr_array_unref(inData->subdirectories);
+	if(inData->entries) g_ptr_array_unref(inData->entries);
+	g_free(inData);
+}
+
+/* Create a scan job for a directory or a batch of desktop files at a search path */
+static EsdashboardApplicationDatabaseScanJob* _esdashboard_application_database_scan_job_new(guint inSearchPathIndex,
+																							GFile *inTopLevelPath,
+																							GFile *inDirectory,
+																							GPtrArray *inFiles,
+																							EsdashboardApplicationDatabaseScanDirectoryData *inDirectoryData)
+{
+	EsdashboardApplicationDatabaseScanJob			*job;
+
+	g_return_val_if_fail(G_IS_FILE(inTopLevelPath), NULL);
+	g_return_val_if_fail((inDirectory!=NULL)!=(inFiles!=NULL), NULL);
+	g_return_val_if_fail(!inFiles || inDirectoryData, NULL);
+
+	job=g_new0(EsdashboardApplicationDatabaseScanJob, 1);
+	job->searchPathIndex=inSearchPathIndex;
+	job->topLevelPath=g_object_ref(inTopLevelPath);
+	if(inDirectory) job->directory=g_object_ref(inDirectory);
+	if(inFiles) job->files=g_ptr_array_ref(inFiles);
+	job->directoryData=inDirectoryData;
+
+	return(job);
+}
+
+/* Free a scan job */
+static void _esdashboard_application_database_scan_job_free(EsdashboardApplicationDatabaseScanJob *inJob)
+{
+	g_return_if_fail(inJob);
+
+	/* Release allocated resources */
+	if(inJob->topLevelPath) g_object_unref(inJob->topLevelPath);
+	if(inJob->directory) g_object_unref(inJob->directory);
+	if(inJob->files) g_ptr_array_unref(inJob->files);
+	g_free(inJob);
+}
+
+/* Queue a scan job to worker pool */
+static void _esdashboard_application_database_scan_push_job(EsdashboardApplicationDatabaseScan *inScan,
+															EsdashboardApplicationDatabaseScanJob *inJob)
+{
+	GError											*error;
+
+	g_return_if_fail(inScan);
+	g_return_if_fail(inJob);
+
+	error=NULL;
+
+	/* Count job as pending before it is queued as it may finish immediately */
+	g_mutex_lock(&inScan->lock);
+	inScan->pendingJobs++;
+	g_mutex_unlock(&inScan->lock);
+
+	if(!g_thread_pool_push(inScan->pool, inJob, &error))
 	{
-		EsdashboardApplicationDatabaseFileMonitorData	*fileMonitorData;
+		/* Record error and count job as finished */
+		g_mutex_lock(&inScan->lock);
+		if(!inScan->error) inScan->error=error;
+			else g_error_free(error);
+		inScan->pendingJobs--;
+		if(inScan->pendingJobs==0) g_cond_signal(&inScan->finishedCond);
+		g_mutex_unlock(&inScan->lock);
+
+		_esdashboard_application_database_scan_job_free(inJob);
+	}
+}
 
-		/* Assume it was a directory so remove file monitor and free
-		 * it's file monitor data structure.
-		 */
-		fileMonitorData=_esdashboard_application_database_monitor_data_find_by_file(self, inFile);
-		if(fileMonitorData)
-		{
-			ESDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Removing file monitor for deleted directory '%s'",
-								filePath);
+/* Add desktop app info to results of search path of directory if it is the
+ * first occurence of this desktop ID at this search path and remember entry
+ * to store in cache. Although desktop file for desktop ID may be invalid,
+ * add it to prevent that a valid desktop file for the same desktop ID will
+ * be found at a search path of lower priority when merging results. The
+ * first entry found - valid or invalid - has the highest priority.
+ */
+static void _esdashboard_application_database_scan_add_result(EsdashboardApplicationDatabaseScan *inScan,
+																EsdashboardApplicationDatabaseScanDirectoryData *inDirectoryData,
+																const gchar *inDesktopID,
+																EsdashboardDesktopAppInfo *inAppInfo,
+																GVariant *inEntry)
+{
+	GHashTable										*desktopAppInfos;
 
-			priv->appDirMonitors=g_list_remove_all(priv->appDirMonitors, fileMonitorData);
-			_esdashboard_application_database_monitor_data_free(fileMonitorData);
-			fileMonitorData=NULL;
-		}
+	g_return_if_fail(inScan);
+	g_return_if_fail(inDirectoryData);
+	g_return_if_fail(inDesktopID && *inDesktopID);
+	g_return_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo));
 
-		/* Assume it was a file so check if it was a desktop file, then check
-		 * if any other desktop file in the other paths in list of search paths
-		 * matches the removed desktop ID. If so replace desktop app info and
-		 * emit signal. Otherwise remove desktop app info from hash table and
-		 * emit signal. Check can only be performed if a hash table exists.
-		 */
-		if(g_str_has_suffix(filePath, ".desktop") &&
-			priv->applications)
-		{
-			gchar										*desktopID;
+	desktopAppInfos=(GHashTable*)g_ptr_array_index(inScan->results, inDirectoryData->searchPathIndex);
 
-			ESDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Desktop file '%s' was removed",
-								filePath);
+	g_mutex_lock(&inScan->lock);
+	if(!g_hash_table_lookup_extended(desktopAppInfos, inDesktopID, NULL, NULL))
+	{
+		g_hash_table_insert(desktopAppInfos, g_strdup(inDesktopID), g_object_ref(inAppInfo));
+	}
+	if(inEntry) g_ptr_array_add(inDirectoryData->entries, g_variant_ref(inEntry));
+	g_mutex_unlock(&inScan->lock);
+}
 
-			/* Get desktop ID to check */
-			desktopID=esdashboard_application_database_get_desktop_id_from_file(inFile);
+/* Create desktop app infos for a batch of desktop files */
+static void _esdashboard_application_database_scan_parse_files(EsdashboardApplicationDatabaseScan *inScan,
+																GFile *inTopLevelPath,
+																EsdashboardApplicationDatabaseScanDirectoryData *inDirectoryData,
+																GPtrArray *inFiles)
+{
+	guint											i;
 
-			/* If we found the desktop ID for the desktop file removed, check if
-			 * another desktop file in search paths could replace desktop ID or
-			 * if it was removed completely.
-			 */
-			if(desktopID)
-			{
-				EsdashboardDesktopAppInfo				*currentDesktopAppInfo;
+	g_return_if_fail(inScan);
+	g_return_if_fail(G_IS_FILE(inTopLevelPath));
+	g_return_if_fail(inDirectoryData);
+	g_return_if_fail(inFiles);
 
-				/* Get current desktop app info */
-				if(g_hash_table_lookup_extended(priv->applications, desktopID, NULL, (gpointer*)&currentDesktopAppInfo))
-				{
-					/* Check if there is another desktop file which could
-					 * replace the desktop ID.
-					 */
-					gchar								*newDesktopFilename;
+	for(i=0; i<inFiles->len; i++)
+	{
+		GFile										*file;
+		gchar										*desktopID;
+		gchar										*filename;
+		EsdashboardDesktopAppInfo					*appInfo;
+		GVariant									*cacheData;
+		GVariant									*entry;
+
+		file=G_FILE(g_ptr_array_index(inFiles, i));
+
+		/* Determine desktop ID for file */
+		desktopID=_esdashboard_application_database_get_desktop_id_at_search_path(inTopLevelPath, file);
+		if(!desktopID)
+		{
+			gchar									*path;
 
-					newDesktopFilename=esdashboard_application_database_get_file_from_desktop_id(desktopID);
-					if(newDesktopFilename)
-					{
-						GFile							*newDesktopFile;
+			path=g_file_get_path(file);
+			g_warning("Could not determine desktop ID for '%s'", path);
+			g_free(path);
 
-						ESDASHBOARD_DEBUG(self, APPLICATIONS,
-											"Replacing known desktop ID '%s' at desktop file '%s' with new desktop file '%s'",
-											desktopID,
-											filePath,
-											newDesktopFilename);
+			continue;
+		}
 
-						/* There is another desktop file which could replace the
-						 * desktop ID. Set new file at desktop app info which causes
-						 * the 'changed' signal to be emitted. No need to change hash table.
-						 */
-						newDesktopFile=g_file_new_for_path(newDesktopFilename);
-						g_object_set(currentDesktopAppInfo, "file", newDesktopFile, NULL);
-						g_object_unref(newDesktopFile);
+		/* Parse desktop file outside of lock as this is the expensive part.
+		 * Desktop app infos for invalid desktop files are kept.
+		 */
+		appInfo=ESDASHBOARD_DESKTOP_APP_INFO(g_object_new(ESDASHBOARD_TYPE_DESKTOP_APP_INFO,
+															"desktop-id", desktopID,
+															"file", file,
+															NULL));
 
-						/* Release allocated resources */
-						g_free(newDesktopFilename);
-					}
-						else
-						{
-							/* Take a reference on current desktop app info to be able
-							 * to emit a 'changed' signal and 'application-removed' signal
-							 * when setting the new file at it after it has been removed
-							 * from hash table. Otherwise the last reference at this object
-							 * could be release which causes the object to be destroyed.
-							 */
-							g_object_ref(currentDesktopAppInfo);
+		/* Create entry for cache. Invalid desktop files are stored without
+		 * data as they still mask desktop files of lower priority.
+		 */
+		cacheData=NULL;
+		if(esdashboard_desktop_app_info_is_valid(appInfo))
+		{
+			cacheData=esdashboard_desktop_app_info_get_cache_data(appInfo);
+		}
 
-							/* There is no other desktop file for this desktop ID.
-							 * Remove desktop app info and desktop ID from hash table.
-							 */
-							g_hash_table_remove(priv->applications, desktopID);
+		filename=g_file_get_basename(file);
+		entry=g_variant_ref_sink(g_variant_new("(ssm@" ESDASHBOARD_DESKTOP_APP_INFO_CACHE_DATA_TYPE_STRING ")",
+												desktopID,
+												filename,
+												cacheData));
 
-							ESDASHBOARD_DEBUG(self, APPLICATIONS,
-												"Removing desktop ID '%s'",
-												desktopID);
+		_esdashboard_application_database_scan_add_result(inScan, inDirectoryData, desktopID, appInfo, entry);
 
-							/* Emit signal that an application has been removed */
-							g_signal_emit(self, EsdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_REMOVED], 0, currentDesktopAppInfo);
+		/* Release allocated resources */
+		g_variant_unref(entry);
+		g_free(filename);
+		g_free(desktopID);
+		g_object_unref(appInfo);
+	}
+}
 
-							/* Set a NULL file at desktop app info which causes
-							 * the 'changed' signal to be emitted.
-							 */
-							g_object_set(currentDesktopAppInfo, "file", NULL, NULL);
+/* Take sub-directories and desktop files of a directory which did not change
+ * since it was stored in cache. Sub-directories are queued as new scan jobs
+ * as they may have changed.
+ */
+static void _esdashboard_application_database_scan_directory_from_cache(EsdashboardApplicationDatabaseScan *inScan,
+																		GFile *inTopLevelPath,
+																		EsdashboardApplicationDatabaseScanDirectoryData *inDirectoryData,
+																		GVariant *inRecord)
+{
+	GVariantIter									*subdirectoriesIter;
+	GVariantIter									*entriesIter;
+	const gchar										*name;
+	const gchar										*desktopID;
+	GVariant										*cacheData;
+
+	g_return_if_fail(inScan);
+	g_return_if_fail(G_IS_FILE(inTopLevelPath));
+	g_return_if_fail(inDirectoryData);
+	g_return_if_fail(inRecord);
+
+	/* Keep record as it is to store it again in cache */
+	inDirectoryData->cachedRecord=g_variant_ref(inRecord);
+
+	/* Queue scan jobs for sub-directories */
+	g_variant_get_child(inRecord, 3, "as", &subdirectoriesIter);
+	while(g_variant_iter_next(subdirectoriesIter, "&s", &name))
+	{
+		GFile										*childPath;
+
+		childPath=g_file_get_child(inDirectoryData->directory, name);
+		_esdashboard_application_database_scan_push_job(inScan,
+														_esdashboard_application_database_scan_job_new(inDirectoryData->searchPathIndex,
+																										inTopLevelPath,
+																										childPath,
+																										NULL,
+																										NULL));
+		g_object_unref(childPath);
+	}
+	g_variant_iter_free(subdirectoriesIter);
+
+	/* Create desktop app infos from cached data without parsing desktop files */
+	g_variant_get_child(inRecord, 4, "a" ESDASHBOARD_APPLICATION_DATABASE_CACHE_ENTRY_TYPE, &entriesIter);
+	while(g_variant_iter_next(entriesIter,
+								"(&s&sm@" ESDASHBOARD_DESKTOP_APP_INFO_CACHE_DATA_TYPE_STRING ")",
+								&desktopID,
+								&name,
+								&cacheData))
+	{
+		EsdashboardDesktopAppInfo					*appInfo;
 
-							/* Release the extra reference we took */
-							g_object_unref(currentDesktopAppInfo);
-						}
-				}
+		if(cacheData)
+		{
+			GFile									*file;
 
-				/* Release allocated resources */
-				g_free(desktopID);
+			file=g_file_get_child(inDirectoryData->directory, name);
+			appInfo=ESDASHBOARD_DESKTOP_APP_INFO(esdashboard_desktop_app_info_new_from_cache_data(desktopID, file, cacheData));
+			g_object_unref(file);
+			g_variant_unref(cacheData);
+		}
+			else
+			{
+				/* Desktop file is invalid so create an invalid desktop app info */
+				appInfo=ESDASHBOARD_DESKTOP_APP_INFO(g_object_new(ESDASHBOARD_TYPE_DESKTOP_APP_INFO,
+																	"desktop-id", desktopID,
+																	NULL));
 			}
+
+		if(appInfo)
+		{
+			_esdashboard_application_database_scan_add_result(inScan, inDirectoryData, desktopID, appInfo, NULL);
+			g_object_unref(appInfo);
 		}
 	}
-
-	/* Release allocated resources */
-	if(filePath) g_free(filePath);
+	g_variant_iter_free(entriesIter);
 }
 
-/* Load installed and user-overidden application desktop files */
-static gboolean _esdashboard_application_database_load_applications_recursive(EsdashboardApplicationDatabase *self,
-																				GFile *inTopLevelPath,
-																				GFile *inCurrentPath,
-																				GHashTable **ioDesktopAppInfos,
-																				GList **ioFileMonitors,
-																				GError **outError)
-{
-	EsdashboardApplicationDatabasePrivate			*priv G_GNUC_UNUSED;
-	gchar											*topLevelPath;
-	gchar											*path;
+/* Enumerate a directory at a search path. Sub-directories and batches of
+ * desktop files found are queued as new scan jobs. If directory did not
+ * change since it was stored in cache, its content is taken from cache.
+ */
+static gboolean _esdashboard_application_database_scan_directory(EsdashboardApplicationDatabaseScan *inScan,
+																	guint inSearchPathIndex,
+																	GFile *inTopLevelPath,
+																	GFile *inDirectory,
+																	GError **outError)
+{
+	EsdashboardApplicationDatabaseScanDirectoryData	*directoryData;
 	GFileEnumerator									*enumerator;
 	GFileInfo										*info;
-	EsdashboardApplicationDatabaseFileMonitorData	*monitorData;
+	GPtrArray										*files;
+	gint64											modificationTime;
 	GError											*error;
 
-	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
+	g_return_val_if_fail(inScan, FALSE);
 	g_return_val_if_fail(G_IS_FILE(inTopLevelPath), FALSE);
-	g_return_val_if_fail(G_IS_FILE(inCurrentPath), FALSE);
-	g_return_val_if_fail(ioDesktopAppInfos && *ioDesktopAppInfos, FALSE);
-	g_return_val_if_fail(ioFileMonitors, FALSE);
+	g_return_val_if_fail(G_IS_FILE(inDirectory), FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
 
-	priv=self->priv;
 	error=NULL;
 
-	/* Get path of current path to scan for desktop files */
-	path=g_file_get_path(inCurrentPath);
-	topLevelPath=g_file_get_path(inTopLevelPath);
+	/* Get modification time of directory before enumerating it, so any
+	 * change while enumerating causes a rescan at next start.
+	 */
+	info=g_file_query_info(inDirectory,
+							G_FILE_ATTRIBUTE_TIME_MODIFIED "," G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC,
+							G_FILE_QUERY_INFO_NONE,
+							NULL,
+							&error);
+	if(!info)
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
 
-	ESDASHBOARD_DEBUG(self, APPLICATIONS,
-						"Scanning directory '%s' for search path '%s'",
-						path,
-						topLevelPath);
+		return(FALSE);
+	}
+
+	modificationTime=(gint64)g_file_info_get_attribute_uint64(info, G_FILE_ATTRIBUTE_TIME_MODIFIED)*G_USEC_PER_SEC;
+	modificationTime+=g_file_info_get_attribute_uint32(info, G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC);
+	g_object_unref(info);
+
+	/* Remember directory to create a file monitor for it and to store it
+	 * in cache. A failed directory fails the whole scan so it is safe to
+	 * remember it now.
+	 */
+	directoryData=_esdashboard_application_database_scan_directory_data_new(inSearchPathIndex, inDirectory, modificationTime);
+
+	g_mutex_lock(&inScan->lock);
+	g_ptr_array_add(inScan->directories, directoryData);
+	g_mutex_unlock(&inScan->lock);
+
+	/* Take content of directory from cache if it did not change */
+	if(inScan->cache && directoryData->path)
+	{
+		GVariant									*record;
+		gchar										*key;
+		gint64										cachedModificationTime;
+
+		key=_esdashboard_application_database_get_cache_key(inSearchPathIndex, directoryData->path);
+		record=(GVariant*)g_hash_table_lookup(inScan->cache, key);
+		g_free(key);
+
+		if(record)
+		{
+			g_variant_get_child(record, 2, "x", &cachedModificationTime);
+			if(cachedModificationTime==modificationTime)
+			{
+				_esdashboard_application_database_scan_directory_from_cache(inScan, inTopLevelPath, directoryData, record);
+				return(TRUE);
+			}
+		}
+	}
 
-	/* Create enumerator for current path to iterate through path and
+	/* Directory is new or has changed so cache must be updated */
+	g_mutex_lock(&inScan->lock);
+	inScan->cacheChanged=TRUE;
+	g_mutex_unlock(&inScan->lock);
+
+	/* Create enumerator for directory to iterate through it and
 	 * searching for desktop files.
 	 */
-	enumerator=g_file_enumerate_children(inCurrentPath,
+	enumerator=g_file_enumerate_children(inDirectory,
 											G_FILE_ATTRIBUTE_STANDARD_TYPE "," G_FILE_ATTRIBUTE_STANDARD_NAME,
 											G_FILE_QUERY_INFO_NONE,
 											NULL,
@@ -733,207 +1745,161 @@ static gboolean _esdashboard_application_database_load_applications_recursive(Es
 		/* Propagate error */
 		g_propagate_error(outError, error);
 
-		/* Release allocated resources */
-		if(path) g_free(path);
-		if(topLevelPath) g_free(topLevelPath);
-
 		return(FALSE);
 	}
 
-	/* Iterate through files in current path recursively and for each
-	 * desktop file found create a desktop app info object but only
-	 * if it is the first occurence of that desktop ID in hash table.
+	/* Iterate through files in directory. Each sub-directory is scanned by
+	 * its own job and desktop files are collected in batches to be parsed
+	 * by other jobs. The last batch is parsed by this job.
 	 */
+	files=g_ptr_array_new_with_free_func(g_object_unref);
 	while((info=g_file_enumerator_next_file(enumerator, NULL, &error)))
 	{
-		/* If current file is a directory call this function recursively
-		 * with absolute path to directory.
-		 */
 		if(g_file_info_get_file_type(info)==G_FILE_TYPE_DIRECTORY)
 		{
-			GFile							*childPath;
-			gboolean						childSuccess;
+			GFile									*childPath;
+
+			g_ptr_array_add(directoryData->subdirectories, g_strdup(g_file_info_get_name(info)));
+
+			childPath=g_file_get_child(inDirectory, g_file_info_get_name(info));
+			_esdashboard_application_database_scan_push_job(inScan,
+															_esdashboard_application_database_scan_job_new(inSearchPathIndex,
+																											inTopLevelPath,
+																											childPath,
+																											NULL,
+																											NULL));
+			g_object_unref(childPath);
+		}
 
-			ESDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Suspend scanning directory '%s' at search path '%s' for sub-directory '%s'",
-								path,
-								topLevelPath,
-								g_file_info_get_name(info));
-
-			childPath=g_file_resolve_relative_path(inCurrentPath,
-													g_file_info_get_name(info));
-			if(!childPath)
+		if(g_file_info_get_file_type(info)==G_FILE_TYPE_REGULAR &&
+			g_str_has_suffix(g_file_info_get_name(info), ".desktop"))
+		{
+			g_ptr_array_add(files, g_file_get_child(inDirectory, g_file_info_get_name(info)));
+
+			if(files->len>=ESDASHBOARD_APPLICATION_DATABASE_SCAN_BATCH_SIZE)
 			{
-				ESDASHBOARD_DEBUG(self, APPLICATIONS,
-									"Unable to build path to search for desktop files for path='%s' and file='%s'",
-									path,
-									g_file_info_get_name(info));
-
-				/* Set error */
-				g_set_error(outError,
-								G_IO_ERROR,
-								G_IO_ERROR_FAILED,
-								"Unable to build path to '%s%s%s' to search for desktop files",
-								path,
-								G_DIR_SEPARATOR_S,
-								g_file_info_get_name(info));
-
-				/* Release allocated resources */
-				if(path) g_free(path);
-				if(topLevelPath) g_free(topLevelPath);
-				if(enumerator) g_object_unref(enumerator);
-
-				return(FALSE);
+				_esdashboard_application_database_scan_push_job(inScan,
+																_esdashboard_application_database_scan_job_new(inSearchPathIndex,
+																												inTopLevelPath,
+																												NULL,
+																												files,
+																												directoryData));
+				g_ptr_array_unref(files);
+				files=g_ptr_array_new_with_free_func(g_object_unref);
 			}
+		}
 
-			childSuccess=_esdashboard_application_database_load_applications_recursive(self,
-																						inTopLevelPath,
-																						childPath,
-																						ioDesktopAppInfos,
-																						ioFileMonitors,
-																						&error);
-			if(!childSuccess)
-			{
-				ESDASHBOARD_DEBUG(self, APPLICATIONS,
-									"Unable to iterate desktop files at %s%s%s",
-									path,
-									G_DIR_SEPARATOR_S,
-									g_file_info_get_name(info));
+		g_object_unref(info);
+	}
 
-				/* Propagate error */
-				g_propagate_error(outError, error);
+	if(error)
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
 
-				/* Release allocated resources */
-				if(childPath) g_object_unref(childPath);
-				if(path) g_free(path);
-				if(topLevelPath) g_free(topLevelPath);
-				if(enumerator) g_object_unref(enumerator);
+		/* Release allocated resources */
+		g_ptr_array_unref(files);
+		g_object_unref(enumerator);
 
-				return(FALSE);
-			}
+		return(FALSE);
+	}
 
-			/* Release allocated resources */
-			if(childPath) g_object_unref(childPath);
+	/* Parse remaining desktop files */
+	_esdashboard_application_database_scan_parse_files(inScan, inTopLevelPath, directoryData, files);
 
-			ESDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Resume scanning directory '%s' at search path '%s'",
-								path,
-								topLevelPath);
-		}
+	/* Release allocated resources */
+	g_ptr_array_unref(files);
+	g_object_unref(enumerator);
 
-		/* If current file is a regular file and if it is a desktop file
-		 * then create desktop app info object if it is the first occurence
-		 * of this desktop ID in hash table.
-		 */
-		if(g_file_info_get_file_type(info)==G_FILE_TYPE_REGULAR &&
-			g_str_has_suffix(g_file_info_get_name(info), ".desktop"))
-		{
-			const gchar								*childName;
-			GFile									*childFile;
-			gchar									*desktopID;
+	/* Return success result */
+	return(TRUE);
+}
 
-			/* Get file of current enumerated file */
-			childName=g_file_info_get_name(info);
-			childFile=g_file_get_child(g_file_enumerator_get_container(enumerator), childName);
+/* Run a scan job in a worker thread */
+static void _esdashboard_application_database_scan_run_job(gpointer inData, gpointer inUserData)
+{
+	EsdashboardApplicationDatabaseScanJob			*job;
+	EsdashboardApplicationDatabaseScan				*scan;
+	gboolean										failed;
+	GError											*error;
 
-			/* Determine desktop ID for file */
-			desktopID=g_file_get_relative_path(inTopLevelPath, childFile);
-			if(desktopID)
-			{
-				gchar								*iter;
+	g_return_if_fail(inData);
+	g_return_if_fail(inUserData);
 
-				iter=desktopID;
-				while(*iter)
-				{
-					/* Replace directory sepearator with dash if needed */
-					if(*iter==G_DIR_SEPARATOR) *iter='-';
+	job=(EsdashboardApplicationDatabaseScanJob*)inData;
+	scan=(EsdashboardApplicationDatabaseScan*)inUserData;
+	error=NULL;
 
-					/* Continue with next character in desktop ID */
-					iter++;
-				}
-			}
-				else
-				{
-					g_warning("Could not determine desktop ID for '%s'",
-								g_file_info_get_name(info));
-				}
+	/* Skip job if scan has failed already */
+	g_mutex_lock(&scan->lock);
+	failed=(scan->error!=NULL);
+	g_mutex_unlock(&scan->lock);
 
-			/* If no desktop app info with determined desktop ID exists
-			 * then create it now.
-			 */
-			if(desktopID &&
-				!g_hash_table_lookup_extended(*ioDesktopAppInfos,
-												desktopID,
-												NULL,
-												NULL))
+	if(!failed)
+	{
+		if(job->directory)
+		{
+			if(!_esdashboard_application_database_scan_directory(scan,
+																	job->searchPathIndex,
+																	job->topLevelPath,
+																	job->directory,
+																	&error))
 			{
-				EsdashboardDesktopAppInfo			*appInfo;
-
-				appInfo=ESDASHBOARD_DESKTOP_APP_INFO(g_object_new(ESDASHBOARD_TYPE_DESKTOP_APP_INFO,
-																	"desktop-id", desktopID,
-																	"file", childFile,
-																	NULL));
-				if(esdashboard_desktop_app_info_is_valid(appInfo))
-				{
-					g_hash_table_insert(*ioDesktopAppInfos, g_strdup(desktopID), g_object_ref(appInfo));
-
-					ESDASHBOARD_DEBUG(self, APPLICATIONS,
-										"Found desktop file '%s%s%s' with desktop ID '%s' at search path '%s'",
-										path,
-										G_DIR_SEPARATOR_S,
-										childName,
-										desktopID,
-										topLevelPath);
-				}
-					else
-					{
-						/* Although desktop file for desktop ID is invalid, add
-						 * it to the database to prevent that a valid desktop file
-						 * for the same desktop ID will be found at path of lower
-						 * prioritory which will then be store in the database as
-						 * no entry exists. The first entry found - valid or invalid -
-						 * has the highest priority. Later the caller has to ensure
-						 * that all invalid desktop IDs in the database will be removed.
-						 */
-						g_hash_table_insert(*ioDesktopAppInfos, g_strdup(desktopID), g_object_ref(appInfo));
-
-						ESDASHBOARD_DEBUG(self, APPLICATIONS,
-											"Adding and mark invalid desktop file '%s%s%s' with desktop ID '%s' at search path '%s'",
-											path,
-											G_DIR_SEPARATOR_S,
-											childName,
-											desktopID,
-											topLevelPath);
-					}
+				gchar								*path;
 
-				g_object_unref(appInfo);
+				path=g_file_get_path(job->directory);
+				ESDASHBOARD_DEBUG(scan->self, APPLICATIONS,
+									"Unable to iterate desktop files at %s: %s",
+									path,
+									error ? error->message : "Unknown error");
+				g_free(path);
 			}
-
-			/* Release allocated resources */
-			if(desktopID) g_free(desktopID);
-			if(childFile) g_object_unref(childFile);
 		}
-
-		g_object_unref(info);
+			else
+			{
+				_esdashboard_application_database_scan_parse_files(scan,
+																	job->topLevelPath,
+																	job->directoryData,
+																	job->files);
+			}
 	}
 
+	/* Job is done so record error if any and wake up waiting thread if it
+	 * was the last pending job.
+	 */
+	g_mutex_lock(&scan->lock);
 	if(error)
 	{
-		/* Propagate error */
-		g_propagate_error(outError, error);
+		if(!scan->error) scan->error=error;
+			else g_error_free(error);
+	}
+	scan->pendingJobs--;
+	if(scan->pendingJobs==0) g_cond_signal(&scan->finishedCond);
+	g_mutex_unlock(&scan->lock);
 
-		/* Release allocated resources */
-		if(path) g_free(path);
-		if(topLevelPath) g_free(topLevelPath);
-		if(enumerator) g_object_unref(enumerator);
+	/* Release allocated resources */
+	_esdashboard_application_database_scan_job_free(job);
+}
 
-		return(FALSE);
-	}
+/* Create file monitor for a directory scanned for desktop files */
+static gboolean _esdashboard_application_database_add_file_monitor(EsdashboardApplicationDatabase *self,
+																	GFile *inDirectory,
+																	GList **ioFileMonitors,
+																	GError **outError)
+{
+	EsdashboardApplicationDatabaseFileMonitorData	*monitorData;
+	gchar											*path;
+	GError											*error;
 
-	/* Iterating through given path was successful so create file monitor
-	 * for this path.
-	 */
-	monitorData=_esdashboard_application_database_monitor_data_new(inCurrentPath);
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
+	g_return_val_if_fail(G_IS_FILE(inDirectory), FALSE);
+	g_return_val_if_fail(ioFileMonitors, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	error=NULL;
+	path=g_file_get_path(inDirectory);
+
+	monitorData=_esdashboard_application_database_monitor_data_new(inDirectory);
 	if(!monitorData)
 	{
 		ESDASHBOARD_DEBUG(self, APPLICATIONS,
@@ -949,13 +1915,11 @@ static gboolean _esdashboard_application_database_load_applications_recursive(Es
 
 		/* Release allocated resources */
 		if(path) g_free(path);
-		if(topLevelPath) g_free(topLevelPath);
-		if(enumerator) g_object_unref(enumerator);
 
 		return(FALSE);
 	}
 
-	monitorData->monitor=g_file_monitor(inCurrentPath, G_FILE_MONITOR_NONE, NULL, &error);
+	monitorData->monitor=g_file_monitor(inDirectory, G_FILE_MONITOR_NONE, NULL, &error);
 	if(!monitorData->monitor && error)
 	{
 #if defined(__unix__)
@@ -976,10 +1940,7 @@ static gboolean _esdashboard_application_database_load_applications_recursive(Es
 
 		/* Release allocated resources */
 		if(monitorData) _esdashboard_application_database_monitor_data_free(monitorData);
-
 		if(path) g_free(path);
-		if(topLevelPath) g_free(topLevelPath);
-		if(enumerator) g_object_unref(enumerator);
 
 		return(FALSE);
 #endif
@@ -1004,79 +1965,286 @@ static gboolean _esdashboard_application_database_load_applications_recursive(Es
 								path);
 		}
 
-	ESDASHBOARD_DEBUG(self, APPLICATIONS,
-						"Finished scanning directory '%s' for search path '%s'",
-						path,
-						topLevelPath);
+	/* Release allocated resources */
+	if(path) g_free(path);
+
+	/* Return success result */
+	return(TRUE);
+}
+
+/* Store directories scanned and their desktop files in cache */
+static void _esdashboard_application_database_save_cache(EsdashboardApplicationDatabase *self,
+															EsdashboardApplicationDatabaseScan *inScan)
+{
+	EsdashboardApplicationDatabasePrivate			*priv;
+	GVariantBuilder									searchPathsBuilder;
+	GVariantBuilder									recordsBuilder;
+	const gchar* const								*languageNames;
+	GVariant										*cache;
+	gchar											*filename;
+	gchar											*folder;
+	GList											*iter;
+	guint											i;
+	GError											*error;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(inScan);
+
+	priv=self->priv;
+	error=NULL;
+
+	/* Build cache of search paths, languages and a record for each directory
+	 * scanned.
+	 */
+	g_variant_builder_init(&searchPathsBuilder, G_VARIANT_TYPE_STRING_ARRAY);
+	for(iter=priv->searchPaths; iter; iter=g_list_next(iter))
+	{
+		g_variant_builder_add(&searchPathsBuilder, "s", (const gchar*)iter->data);
+	}
+
+	g_variant_builder_init(&recordsBuilder, G_VARIANT_TYPE("a" ESDASHBOARD_APPLICATION_DATABASE_CACHE_RECORD_TYPE));
+	for(i=0; i<inScan->directories->len; i++)
+	{
+		EsdashboardApplicationDatabaseScanDirectoryData	*directoryData;
+
+		directoryData=(EsdashboardApplicationDatabaseScanDirectoryData*)g_ptr_array_index(inScan->directories, i);
+
+		/* Store record of unchanged directory as it was loaded */
+		if(directoryData->cachedRecord)
+		{
+			g_variant_builder_add_value(&recordsBuilder, directoryData->cachedRecord);
+			continue;
+		}
+
+		if(!directoryData->path) continue;
+
+		g_variant_builder_add(&recordsBuilder,
+								"(usx@as@a" ESDASHBOARD_APPLICATION_DATABASE_CACHE_ENTRY_TYPE ")",
+								directoryData->searchPathIndex,
+								directoryData->path,
+								directoryData->modificationTime,
+								g_variant_new_strv((const gchar* const*)directoryData->subdirectories->pdata,
+													directoryData->subdirectories->len),
+								g_variant_new_array(G_VARIANT_TYPE(ESDASHBOARD_APPLICATION_DATABASE_CACHE_ENTRY_TYPE),
+													(GVariant**)directoryData->entries->pdata,
+													directoryData->entries->len));
+	}
+
+	languageNames=g_get_language_names();
+
+	cache=g_variant_ref_sink(g_variant_new("(u@as^as@a" ESDASHBOARD_APPLICATION_DATABASE_CACHE_RECORD_TYPE ")",
+											ESDASHBOARD_APPLICATION_DATABASE_CACHE_VERSION,
+											g_variant_builder_end(&searchPathsBuilder),
+											languageNames,
+											g_variant_builder_end(&recordsBuilder)));
+
+	/* Write cache file atomically */
+	filename=_esdashboard_application_database_get_cache_filename();
+	folder=g_path_get_dirname(filename);
+	if(g_mkdir_with_parents(folder, 0700)<0 ||
+		!g_file_set_contents(filename,
+								g_variant_get_data(cache),
+								g_variant_get_size(cache),
+								&error))
+	{
+		g_warning("Could not write application cache %s: %s",
+					filename,
+					error ? error->message : g_strerror(errno));
+	}
+		else
+		{
+			ESDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Stored %u directories in application cache at '%s'",
+								inScan->directories->len,
+								filename);
+		}
+
+	/* Release allocated resources */
+	if(error) g_error_free(error);
+	g_variant_unref(cache);
+	g_free(folder);
+	g_free(filename);
+}
+
+/* Release resources of a scan for desktop files */
+static void _esdashboard_application_database_scan_clear(EsdashboardApplicationDatabaseScan *inScan)
+{
+	g_return_if_fail(inScan);
+
+	/* Release allocated resources */
+	if(inScan->pool) g_thread_pool_free(inScan->pool, TRUE, TRUE);
+	if(inScan->results) g_ptr_array_unref(inScan->results);
+	if(inScan->directories) g_ptr_array_unref(inScan->directories);
+	if(inScan->cache) g_hash_table_unref(inScan->cache);
+	if(inScan->error) g_error_free(inScan->error);
+	g_mutex_clear(&inScan->lock);
+	g_cond_clear(&inScan->finishedCond);
+}
+
+/* Load installed and user-overidden application desktop files */
+static gboolean _esdashboard_application_database_load_applications(EsdashboardApplicationDatabase *self, GError **outError)
+{
+	EsdashboardApplicationDatabasePrivate			*priv;
+	EsdashboardApplicationDatabaseScan				scan;
+	GHashTable										*apps;
+	GList											*fileMonitors;
+	GError											*error;
+	GList											*iter;
+	guint											i;
+	EsdashboardApplicationDatabaseFileMonitorData	*monitorData;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
+	g_return_val_if_fail(outError && *outError==NULL, FALSE);
+
+	priv=self->priv;
+	error=NULL;
+
+	/* Scan all search paths for desktop files in a pool of worker threads.
+	 * Directories are enumerated and desktop files are parsed in parallel
+	 * but the results are collected for each search path separately, so
+	 * they can be merged in order of search paths afterwards to add only
+	 * the first occurence of each desktop ID. Directories which did not
+	 * change since they were stored in cache are not enumerated and their
+	 * desktop files are not parsed but taken from cache.
+	 */
+	memset(&scan, 0, sizeof(scan));
+	scan.self=self;
+	g_mutex_init(&scan.lock);
+	g_cond_init(&scan.finishedCond);
+	scan.results=g_ptr_array_new_with_free_func((GDestroyNotify)g_hash_table_unref);
+	scan.directories=g_ptr_array_new_with_free_func((GDestroyNotify)_esdashboard_application_database_scan_directory_data_free);
+	scan.cache=_esdashboard_application_database_load_cache(self);
+	scan.pool=g_thread_pool_new(_esdashboard_application_database_scan_run_job,
+								&scan,
+								MAX(1, (gint)g_get_num_processors()),
+								FALSE,
+								&error);
+	if(!scan.pool)
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
+
+		/* Release allocated resources */
+		_esdashboard_application_database_scan_clear(&scan);
+
+		return(FALSE);
+	}
+
+	for(iter=priv->searchPaths, i=0; iter; iter=g_list_next(iter), i++)
+	{
+		const gchar							*path;
+		GFile								*directory;
+
+		/* Create hash-table for results of this search path */
+		g_ptr_array_add(scan.results,
+						g_hash_table_new_full(g_str_hash,
+												g_str_equal,
+												g_free,
+												g_object_unref));
+
+		/* Only scan current search path if path exists and is a directory.
+		 * Otherwise the scan will fail and then this function will fail also.
+		 * But not all search path must exist so check.
+		 */
+		path=(const gchar*)iter->data;
+		directory=g_file_new_for_path(path);
+
+		if(g_file_query_file_type(directory, G_FILE_QUERY_INFO_NONE, NULL)==G_FILE_TYPE_DIRECTORY)
+		{
+			ESDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Scanning search path '%s'",
+								path);
+
+			_esdashboard_application_database_scan_push_job(&scan,
+															_esdashboard_application_database_scan_job_new(i, directory, directory, NULL, NULL));
+		}
+
+		if(directory) g_object_unref(directory);
+	}
 
-	/* Release allocated resources */
-	if(path) g_free(path);
-	if(topLevelPath) g_free(topLevelPath);
-	if(enumerator) g_object_unref(enumerator);
+	/* Wait for all scan jobs to finish */
+	g_mutex_lock(&scan.lock);
+	while(scan.pendingJobs>0) g_cond_wait(&scan.finishedCond, &scan.lock);
+	g_mutex_unlock(&scan.lock);
 
-	/* Return success result */
-	return(TRUE);
-}
+	g_thread_pool_free(scan.pool, FALSE, TRUE);
+	scan.pool=NULL;
 
-static gboolean _esdashboard_application_database_load_applications(EsdashboardApplicationDatabase *self, GError **outError)
-{
-	EsdashboardApplicationDatabasePrivate			*priv;
-	GHashTable										*apps;
-	GList											*fileMonitors;
-	GError											*error;
-	GList											*iter;
-	EsdashboardApplicationDatabaseFileMonitorData	*monitorData;
+	if(scan.error)
+	{
+		/* Propagate error */
+		g_propagate_error(outError, scan.error);
+		scan.error=NULL;
 
-	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
-	g_return_val_if_fail(outError && *outError==NULL, FALSE);
+		/* Release allocated resources */
+		_esdashboard_application_database_scan_clear(&scan);
 
-	priv=self->priv;
-	error=NULL;
+		return(FALSE);
+	}
 
-	/* Iterate through enumerated files at each path in list of search paths
-	 * and add only the first occurence of each desktop ID. Also set up
-	 * file monitors to get notified if a desktop file changes, was removed
-	 * or a new one added.
+	/* Merge results of all search paths in their order and add only the
+	 * first occurence of each desktop ID.
 	 */
-	fileMonitors=NULL;
 	apps=g_hash_table_new_full(g_str_hash,
 								g_str_equal,
 								g_free,
 								g_object_unref);
 
-	for(iter=priv->searchPaths; iter; iter=g_list_next(iter))
+	for(i=0; i<scan.results->len; i++)
 	{
-		const gchar							*path;
-		GFile								*directory;
+		GHashTableIter								resultsIter;
+		const gchar									*desktopID;
+		EsdashboardDesktopAppInfo					*appInfo;
 
-		/* Iterate through files in current search path recursively and
-		 * for each desktop file create a desktop app info object but only
-		 * if it is the first occurence of that desktop ID.
-		 */
-		path=(const gchar*)iter->data;
-		directory=g_file_new_for_path(path);
+		g_hash_table_iter_init(&resultsIter, (GHashTable*)g_ptr_array_index(scan.results, i));
+		while(g_hash_table_iter_next(&resultsIter, (gpointer*)&desktopID, (gpointer*)&appInfo))
+		{
+			if(g_hash_table_lookup_extended(apps, desktopID, NULL, NULL)) continue;
 
-		/* Only scan current search path if path exists and is a directory.
-		 * Otherwise the called function will fail and then this function
-		 * will fail also. But not all search path must exist so check.
-		 */
-		if(g_file_query_file_type(directory, G_FILE_QUERY_INFO_NONE, NULL)==G_FILE_TYPE_DIRECTORY &&
-			!_esdashboard_application_database_load_applications_recursive(self, directory, directory, &apps, &fileMonitors, &error))
+			g_hash_table_insert(apps, g_strdup(desktopID), g_object_ref(appInfo));
+		}
+	}
+
+	/* Update cache if any directory was rescanned or is gone */
+	if(scan.cacheChanged ||
+		!scan.cache ||
+		g_hash_table_size(scan.cache)!=scan.directories->len)
+	{
+		_esdashboard_application_database_save_cache(self, &scan);
+	}
+
+	/* Set up file monitors to get notified if a desktop file changes, was
+	 * removed or a new one added in any directory scanned. File monitors are
+	 * created here in main thread to get their signals emitted in main loop.
+	 */
+	fileMonitors=NULL;
+	for(i=0; i<scan.directories->len; i++)
+	{
+		if(!_esdashboard_application_database_add_file_monitor(self,
+																((EsdashboardApplicationDatabaseScanDirectoryData*)g_ptr_array_index(scan.directories, i))->directory,
+																&fileMonitors,
+																&error))
 		{
 			/* Propagate error */
 			g_propagate_error(outError, error);
 
 			/* Release allocated resources */
-			if(fileMonitors) g_list_free_full(fileMonitors, g_object_unref);
+			if(fileMonitors) g_list_free_full(fileMonitors, (GDestroyNotify)_esdashboard_application_database_monitor_data_free);
 			if(apps) g_hash_table_unref(apps);
-			if(directory) g_object_unref(directory);
+			_esdashboard_application_database_scan_clear(&scan);
 
 			return(FALSE);
 		}
-
-		if(directory) g_object_unref(directory);
 	}
 
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Scanned %u directories in %u search paths",
+						scan.directories->len,
+						scan.results->len);
+
+	/* Release allocated resources */
+	_esdashboard_application_database_scan_clear(&scan);
+
 	/* Remove invalid desktop IDs from database */
 	if(apps)
 	{
@@ -1113,6 +2281,9 @@ static gboolean _esdashboard_application_database_load_applications(EsdashboardA
 
 	priv->applications=apps;
 
+	/* Build search index for new list of installed applications */
+	_esdashboard_application_database_search_index_rebuild(self);
+
 	/* Release old list of installed applications and set new one.
 	 * Now ee can also connect signals to all file monitors created.
 	 */
@@ -1143,34 +2314,19 @@ static gboolean _esdashboard_application_database_load_applications(EsdashboardA
 	return(TRUE);
 }
 
-/* Load menus and applications */
-static gboolean _esdashboard_application_database_load_application_menu(EsdashboardApplicationDatabase *self, GError **outError)
+/* Set loaded application menu, takes ownership of menu */
+static void _esdashboard_application_database_set_application_menu(EsdashboardApplicationDatabase *self, MarkonMenu *inAppsMenu)
 {
 	EsdashboardApplicationDatabasePrivate	*priv;
-	MarkonMenu								*appsMenu;
-	GError									*error;
 
-	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
-	g_return_val_if_fail(outError && *outError==NULL, FALSE);
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(MARKON_IS_MENU(inAppsMenu));
 
 	priv=self->priv;
-	error=NULL;
-
-	/* Load menu */
-	appsMenu=markon_menu_new_applications();
-	if(!markon_menu_load(appsMenu, NULL, &error))
-	{
-		/* Propagate error */
-		g_propagate_error(outError, error);
-
-		/* Release allocated resources */
-		g_object_unref(appsMenu);
 
-		return(FALSE);
-	}
 	ESDASHBOARD_DEBUG(self, APPLICATIONS,
 						"Loaded application menu '%s'",
-						markon_menu_element_get_name(MARKON_MENU_ELEMENT(appsMenu)));
+						markon_menu_element_get_name(MARKON_MENU_ELEMENT(inAppsMenu)));
 
 	/* Release old menus and set new one */
 	if(priv->appsMenu)
@@ -1185,7 +2341,7 @@ static gboolean _esdashboard_application_database_load_application_menu(Esdashbo
 		priv->appsMenu=NULL;
 	}
 
-	priv->appsMenu=appsMenu;
+	priv->appsMenu=inAppsMenu;
 	priv->appsMenuReloadRequiredID=g_signal_connect_swapped(priv->appsMenu,
 																	"reload-required",
 																	G_CALLBACK(_esdashboard_application_database_on_application_menu_reload_required),
@@ -1193,11 +2349,164 @@ static gboolean _esdashboard_application_database_load_application_menu(Esdashbo
 
 	/* Emit signal 'menu-reload-required' */
 	g_signal_emit(self, EsdashboardApplicationDatabaseSignals[SIGNAL_MENU_RELOAD_REQUIRED], 0);
+}
+
+/* Load menus */
+static gboolean _esdashboard_application_database_load_application_menu(EsdashboardApplicationDatabase *self, GError **outError)
+{
+	MarkonMenu								*appsMenu;
+	GError									*error;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
+	g_return_val_if_fail(outError && *outError==NULL, FALSE);
+
+	error=NULL;
+
+	/* Load menu */
+	appsMenu=markon_menu_new_applications();
+	if(!markon_menu_load(appsMenu, NULL, &error))
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
+
+		/* Release allocated resources */
+		g_object_unref(appsMenu);
+
+		return(FALSE);
+	}
+
+	/* Set loaded menu */
+	_esdashboard_application_database_set_application_menu(self, appsMenu);
 
 	/* Menu was loaded successfully */
 	return(TRUE);
 }
 
+/* Load menu in worker thread. The menu is created and loaded here, so no other
+ * thread can access it until the task is done and it is handed over to main
+ * thread. It is not modified afterwards, so the applications menu model can
+ * walk it in a worker thread of its own. The file monitors set up by markon
+ * while loading are attached to the default main context, so its signals are
+ * still emitted in main thread.
+ */
+static void _esdashboard_application_database_load_application_menu_thread(GTask *inTask,
+																			gpointer inSourceObject,
+																			gpointer inTaskData,
+																			GCancellable *inCancellable)
+{
+	MarkonMenuItemCache						*cache;
+	MarkonMenu								*appsMenu;
+	GError									*error;
+
+	error=NULL;
+
+	/* Clear markon's menu item cache otherwise changed items will not be
+	 * loaded again. The cache is guarded by its own lock.
+	 */
+	cache=markon_menu_item_cache_get_default();
+	markon_menu_item_cache_invalidate(cache);
+	g_object_unref(cache);
+
+	/* Load menu */
+	appsMenu=markon_menu_new_applications();
+	if(!markon_menu_load(appsMenu, inCancellable, &error))
+	{
+		/* Return error */
+		g_task_return_error(inTask, error);
+
+		/* Release allocated resources */
+		g_object_unref(appsMenu);
+
+		return;
+	}
+
+	/* Return loaded menu if loading was not cancelled meanwhile */
+	if(g_task_return_error_if_cancelled(inTask))
+	{
+		g_object_unref(appsMenu);
+		return;
+	}
+
+	g_task_return_pointer(inTask, appsMenu, g_object_unref);
+}
+
+/* Menu was loaded in worker thread, so set it as application menu */
+static void _esdashboard_application_database_on_load_application_menu_done(GObject *inSourceObject,
+																			GAsyncResult *inResult,
+																			gpointer inUserData)
+{
+	EsdashboardApplicationDatabase			*self;
+	EsdashboardApplicationDatabasePrivate	*priv;
+	GTask									*task;
+	MarkonMenu								*appsMenu;
+	GError									*error;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(inSourceObject));
+	g_return_if_fail(G_IS_TASK(inResult));
+
+	self=ESDASHBOARD_APPLICATION_DATABASE(inSourceObject);
+	priv=self->priv;
+	task=G_TASK(inResult);
+	error=NULL;
+
+	appsMenu=MARKON_MENU(g_task_propagate_pointer(task, &error));
+
+	/* If this loading was cancelled or superseded by a newer one, the menu
+	 * is outdated and must not be set.
+	 */
+	if(g_task_get_cancellable(task)!=priv->appsMenuLoadCancellable)
+	{
+		/* Release allocated resources */
+		if(appsMenu) g_object_unref(appsMenu);
+		if(error) g_error_free(error);
+
+		return;
+	}
+
+	g_clear_object(&priv->appsMenuLoadCancellable);
+
+	if(!appsMenu)
+	{
+		g_critical("Could not reload application menu: %s",
+					error ? error->message : "Unknown error");
+
+		/* Release allocated resources */
+		if(error) g_error_free(error);
+
+		return;
+	}
+
+	/* Set loaded menu */
+	_esdashboard_application_database_set_application_menu(self, appsMenu);
+}
+
+/* Load menus in background */
+static void _esdashboard_application_database_load_application_menu_async(EsdashboardApplicationDatabase *self)
+{
+	EsdashboardApplicationDatabasePrivate	*priv;
+	GTask									*task;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self));
+
+	priv=self->priv;
+
+	/* Cancel any loading in progress as it is superseded by this one */
+	if(priv->appsMenuLoadCancellable)
+	{
+		g_cancellable_cancel(priv->appsMenuLoadCancellable);
+		g_clear_object(&priv->appsMenuLoadCancellable);
+	}
+
+	/* Load menu in worker thread. The current menu is kept until the new one
+	 * is set when done.
+	 */
+	priv->appsMenuLoadCancellable=g_cancellable_new();
+
+	task=g_task_new(self, priv->appsMenuLoadCancellable, _esdashboard_application_database_on_load_application_menu_done, NULL);
+	g_task_run_in_thread(task, _esdashboard_application_database_load_application_menu_thread);
+	g_object_unref(task);
+}
+
 /* Release all allocated resources of this object and clean up */
 static void _esdashboard_application_database_clean(EsdashboardApplicationDatabase *self)
 {
@@ -1208,6 +2517,19 @@ static void _esdashboard_application_database_clean(EsdashboardApplicationDataba
 	priv=self->priv;
 
 	/* Release allocated resources */
+	if(priv->pendingChangesID)
+	{
+		g_source_remove(priv->pendingChangesID);
+		priv->pendingChangesID=0;
+	}
+
+	if(priv->pendingChanges)
+	{
+		g_hash_table_unref(priv->pendingChanges);
+		priv->pendingChanges=NULL;
+	}
+	priv->pendingChangesSince=0;
+
 	if(priv->appDirMonitors)
 	{
 		GList								*iter;
@@ -1220,6 +2542,13 @@ static void _esdashboard_application_database_clean(EsdashboardApplicationDataba
 		priv->appDirMonitors=NULL;
 	}
 
+	if(priv->appsMenuLoadCancellable)
+	{
+		g_cancellable_cancel(priv->appsMenuLoadCancellable);
+		g_object_unref(priv->appsMenuLoadCancellable);
+		priv->appsMenuLoadCancellable=NULL;
+	}
+
 	if(priv->appsMenu)
 	{
 		if(priv->appsMenuReloadRequiredID)
@@ -1238,6 +2567,8 @@ static void _esdashboard_application_database_clean(EsdashboardApplicationDataba
 		priv->applications=NULL;
 	}
 
+	_esdashboard_application_database_search_index_clear(self);
+
 	/* Now as all allocated resources are released, this database is not loaded anymore */
 	priv->isLoaded=FALSE;
 
@@ -1301,6 +2632,30 @@ static void _esdashboard_application_database_dispose(GObject *inObject)
 		priv->searchPaths=NULL;
 	}
 
+	if(priv->searchIndex)
+	{
+		g_hash_table_destroy(priv->searchIndex);
+		priv->searchIndex=NULL;
+	}
+
+	if(priv->searchIndexEntries)
+	{
+		g_hash_table_destroy(priv->searchIndexEntries);
+		priv->searchIndexEntries=NULL;
+	}
+
+	if(priv->searchIndexEntriesByID)
+	{
+		g_ptr_array_free(priv->searchIndexEntriesByID, TRUE);
+		priv->searchIndexEntriesByID=NULL;
+	}
+
+	if(priv->suffixIndex)
+	{
+		g_hash_table_destroy(priv->suffixIndex);
+		priv->suffixIndex=NULL;
+	}
+
 	/* Call parent's class dispose method */
 	G_OBJECT_CLASS(esdashboard_application_database_parent_class)->dispose(inObject);
 }
@@ -1396,6 +2751,20 @@ static void esdashboard_application_database_class_init(EsdashboardApplicationDa
 						G_TYPE_NONE,
 						1,
 						G_TYPE_APP_INFO);
+
+	EsdashboardApplicationDatabaseSignals[SIGNAL_APPLICATIONS_CHANGED]=
+		g_signal_new("applications-changed",
+						G_TYPE_FROM_CLASS(klass),
+						G_SIGNAL_RUN_LAST | G_SIGNAL_NO_HOOKS,
+						G_STRUCT_OFFSET(EsdashboardApplicationDatabaseClass, applications_changed),
+						NULL,
+						NULL,
+						_esdashboard_marshal_VOID__POINTER_POINTER_POINTER,
+						G_TYPE_NONE,
+						3,
+						G_TYPE_POINTER,
+						G_TYPE_POINTER,
+						G_TYPE_POINTER);
 }
 
 /* Object initialization
@@ -1414,8 +2783,26 @@ static void esdashboard_application_database_init(EsdashboardApplicationDatabase
 	priv->searchPaths=NULL;
 	priv->appsMenu=NULL;
 	priv->appsMenuReloadRequiredID=0;
+	priv->appsMenuLoadCancellable=NULL;
 	priv->applications=NULL;
 	priv->appDirMonitors=NULL;
+	priv->pendingChanges=NULL;
+	priv->pendingChangesID=0;
+	priv->pendingChangesSince=0;
+	priv->searchIndex=g_hash_table_new_full(g_direct_hash,
+											g_direct_equal,
+											NULL,
+											(GDestroyNotify)g_array_unref);
+	priv->searchIndexEntries=g_hash_table_new_full(g_direct_hash,
+													g_direct_equal,
+													NULL,
+													(GDestroyNotify)_esdashboard_application_database_search_index_entry_free);
+	priv->searchIndexEntriesByID=g_ptr_array_new();
+	priv->searchIndexDeadEntries=0;
+	priv->suffixIndex=g_hash_table_new_full(g_str_hash,
+											g_str_equal,
+											g_free,
+											(GDestroyNotify)g_ptr_array_unref);
 
 	/* Set up search paths but eliminate duplicates */
 	path=g_build_filename(g_get_user_data_dir(), "applications", NULL);
@@ -1599,6 +2986,42 @@ GAppInfo* esdashboard_application_database_lookup_desktop_id(EsdashboardApplicat
 	return(NULL);
 }
 
+/* Get list of applications whose desktop ID ends with a dash followed by
+ * requested suffix, e.g. "sub-app.desktop" for suffix "app.desktop".
+ * The returned list must be freed with g_list_free_full(list, g_object_unref)
+ */
+GList* esdashboard_application_database_lookup_desktop_id_suffix(EsdashboardApplicationDatabase *self,
+																	const gchar *inSuffix)
+{
+	EsdashboardApplicationDatabasePrivate	*priv;
+	GPtrArray								*apps;
+	GList									*result;
+	guint									i;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self), NULL);
+	g_return_val_if_fail(inSuffix && *inSuffix, NULL);
+
+	priv=self->priv;
+	result=NULL;
+
+	/* Lock for thread-safety */
+	G_LOCK(_esdashboard_application_database_search_index_lock);
+
+	apps=(GPtrArray*)g_hash_table_lookup(priv->suffixIndex, inSuffix);
+	if(apps)
+	{
+		for(i=apps->len; i>0; i--)
+		{
+			result=g_list_prepend(result, g_object_ref(g_ptr_array_index(apps, i-1)));
+		}
+	}
+
+	/* Unlock for thread-safety */
+	G_UNLOCK(_esdashboard_application_database_search_index_lock);
+
+	return(result);
+}
+
 /* Get path to desktop file for requested desktop ID.
  * Returns NULL if desktop file is invalid or was not found at any search path.
  */
@@ -1869,3 +3292,104 @@ gchar* esdashboard_application_database_get_desktop_id_from_file(GFile *inFile)
 	/* Return found desktop ID */
 	return(foundDesktopID);
 }
+
+/* Get list of desktop IDs of applications which may match all requested search
+ * terms by looking up the n-grams of each search term in search index. Each
+ * application matching all search terms in its name, description, command or
+ * keywords is in returned list but the list may contain applications which do
+ * not match. This function is thread-safe.
+ * The returned list should be freed with g_list_free_full(result, g_free)
+ */
+GList* esdashboard_application_database_get_search_candidates(EsdashboardApplicationDatabase *self,
+																const gchar **inSearchTerms)
+{
+	EsdashboardApplicationDatabasePrivate			*priv;
+	GArray											*ids;
+	GList											*candidates;
+	guint											i;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(self), NULL);
+	g_return_val_if_fail(inSearchTerms, NULL);
+
+	priv=self->priv;
+	ids=NULL;
+
+	/* Lock for thread-safety */
+	G_LOCK(_esdashboard_application_database_search_index_lock);
+
+	/* Intersect the lists of IDs of all n-grams of all search terms */
+	for(; *inSearchTerms; inSearchTerms++)
+	{
+		gchar										*term;
+		guint										termLength;
+		guint										ngramLength;
+		const gchar									*iter;
+
+		/* Fold search term in the same way as the indexed text was folded */
+		term=g_utf8_strdown(*inSearchTerms, -1);
+		termLength=strlen(term);
+
+		/* Short search terms are n-grams by themselves. Longer ones are looked up
+		 * by each of their n-grams with maximum length.
+		 */
+		ngramLength=MIN(termLength, ESDASHBOARD_APPLICATION_DATABASE_SEARCH_INDEX_MAX_NGRAM);
+		for(iter=term; ngramLength>0 && iter+ngramLength<=term+termLength; iter++)
+		{
+			GArray									*ngramIDs;
+
+			ngramIDs=(GArray*)g_hash_table_lookup(priv->searchIndex,
+													GUINT_TO_POINTER(ESDASHBOARD_APPLICATION_DATABASE_NGRAM_KEY(iter, ngramLength)));
+
+			/* The first list of IDs is copied, all others are intersected with it */
+			if(!ids)
+			{
+				ids=g_array_sized_new(FALSE, FALSE, sizeof(guint), ngramIDs ? ngramIDs->len : 0);
+				if(ngramIDs) g_array_append_vals(ids, ngramIDs->data, ngramIDs->len);
+			}
+				else _esdashboard_application_database_search_index_intersect(ids, ngramIDs);
+
+			/* Stop if no application can match anymore */
+			if(ids->len==0) break;
+		}
+
+		/* Release allocated resources */
+		g_free(term);
+
+		/* Stop if no application can match anymore */
+		if(ids && ids->len==0) break;
+	}
+
+	/* Build list of applications for remaining IDs */
+	candidates=NULL;
+	if(ids)
+	{
+		for(i=ids->len; i>0; i--)
+		{
+			EsdashboardApplicationDatabaseSearchIndexEntry	*entry;
+
+			entry=g_ptr_array_index(priv->searchIndexEntriesByID, g_array_index(ids, guint, i-1));
+			if(entry) candidates=g_list_prepend(candidates, g_strdup(g_app_info_get_id(entry->appInfo)));
+		}
+
+		g_array_free(ids, TRUE);
+	}
+		else
+		{
+			/* No n-gram was looked up, e.g. all search terms were empty,
+			 * so every indexed application is a candidate.
+			 */
+			for(i=priv->searchIndexEntriesByID->len; i>0; i--)
+			{
+				EsdashboardApplicationDatabaseSearchIndexEntry	*entry;
+
+				entry=g_ptr_array_index(priv->searchIndexEntriesByID, i-1);
+				if(entry) candidates=g_list_prepend(candidates, g_strdup(g_app_info_get_id(entry->appInfo)));
+			}
+		}
+
+	/* Unlock for thread-safety */
+	G_UNLOCK(_esdashboard_application_database_search_index_lock);
+
+	/* Return list of candidates */
+	return(candidates);
+}
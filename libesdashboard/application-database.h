@@ -66,6 +66,10 @@ struct _EsdashboardApplicationDatabaseClass
 
 	void (*application_added)(EsdashboardApplicationDatabase *self, GAppInfo *inAppInfo);
 	void (*application_removed)(EsdashboardApplicationDatabase *self, GAppInfo *inAppInfo);
+	void (*applications_changed)(EsdashboardApplicationDatabase *self,
+									GList *inAdded,
+									GList *inRemoved,
+									GList *inChanged);
 };
 
 /* Public API */
@@ -80,9 +84,13 @@ const GList* esdashboard_application_database_get_application_search_paths(const
 
 MarkonMenu* esdashboard_application_database_get_application_menu(EsdashboardApplicationDatabase *self);
 GList* esdashboard_application_database_get_all_applications(EsdashboardApplicationDatabase *self);
+GList* esdashboard_application_database_get_search_candidates(EsdashboardApplicationDatabase *self,
+																const gchar **inSearchTerms);
 
 GAppInfo* esdashboard_application_database_lookup_desktop_id(EsdashboardApplicationDatabase *self,
 																const gchar *inDesktopID);
+GList* esdashboard_application_database_lookup_desktop_id_suffix(EsdashboardApplicationDatabase *self,
+																	const gchar *inSuffix);
 
 gchar* esdashboard_application_database_get_file_from_desktop_id(const gchar *inDesktopID);
 gchar* esdashboard_application_database_get_desktop_id_from_path(const gchar *inFilename);
@@ -45,6 +45,8 @@ struct _EsdashboardApplicationTrackerPrivate
 
 	EsdashboardApplicationDatabase	*appDatabase;
 	EsdashboardWindowTracker		*windowTracker;
+
+	GHashTable						*processes;
 };
 
 G_DEFINE_TYPE_WITH_PRIVATE(EsdashboardApplicationTracker,
@@ -77,6 +79,23 @@ struct _EsdashboardApplicationTrackerItem
 	GList				*windows;
 };
 
+typedef struct _EsdashboardApplicationTrackerProcess	EsdashboardApplicationTrackerProcess;
+struct _EsdashboardApplicationTrackerProcess
+{
+	guint64				startTime;
+	gchar				*desktopFile;	/* NULL if process' environment has no usable desktop file */
+};
+
+/* Free data remembered for a process */
+static void _esdashboard_application_tracker_process_free(EsdashboardApplicationTrackerProcess *inProcess)
+{
+	g_return_if_fail(inProcess);
+
+	/* Release allocated resources */
+	if(inProcess->desktopFile) g_free(inProcess->desktopFile);
+	g_free(inProcess);
+}
+
 /* Remove a window from application tracker item if it exists */
 static gboolean _esdashboard_application_tracker_item_remove_window(EsdashboardApplicationTrackerItem *inItem,
 																	EsdashboardWindowTrackerWindow *inWindow)
@@ -258,30 +277,75 @@ static EsdashboardApplicationTrackerItem* _esdashboard_application_tracker_find_
 }
 
 #if defined(__linux__)
-/* Get process' environment set from requested PID when running at Linux
- * by reading in file in proc filesystem.
+/* Get start time of process with requested PID when running at Linux by
+ * reading its stat file in proc filesystem. It is used to detect if a PID
+ * was reused by another process. Returns 0 if it could not be determined.
+ */
+static guint64 _esdashboard_application_tracker_get_process_start_time(gint inPID)
+{
+	gchar			*procStatFile;
+	gchar			*statContent;
+	gchar			*iter;
+	gint			field;
+	guint64			startTime;
+
+	g_return_val_if_fail(inPID>0, 0);
+
+	startTime=0;
+
+	procStatFile=g_strdup_printf("/proc/%d/stat", inPID);
+	if(!g_file_get_contents(procStatFile, &statContent, NULL, NULL))
+	{
+		g_free(procStatFile);
+		return(0);
+	}
+
+	/* The second field is the process' name in parentheses which may contain
+	 * spaces and parentheses itself, so start after last closing parenthesis.
+	 * The start time is the 22nd field.
+	 */
+	iter=strrchr(statContent, ')');
+	if(iter)
+	{
+		field=2;
+		while(*iter && field<22)
+		{
+			if(*iter==' ') field++;
+			iter++;
+		}
+
+		if(field==22) startTime=g_ascii_strtoull(iter, NULL, 10);
+	}
+
+	/* Release allocated resources */
+	g_free(statContent);
+	g_free(procStatFile);
+
+	return(startTime);
+}
+
+/* Get desktop file and PID of process it was launched with from environment
+ * set of requested PID when running at Linux by reading in file in proc
+ * filesystem. Only the environment variables needed are looked up but the
+ * environment set is not parsed completely.
  */
-static GHashTable* _esdashboard_application_tracker_get_environment_from_pid(gint inPID)
+static gboolean _esdashboard_application_tracker_get_launched_desktop_file_from_pid(gint inPID,
+																					gchar **outDesktopFile,
+																					gchar **outLaunchedPID)
 {
-	GHashTable		*environments;
 	gchar			*procEnvFile;
 	gchar			*envContent;
 	gsize			envLength;
 	GError			*error;
-	gchar			*iter;
+	const gchar		*iter;
+	const gchar		*end;
 
-	g_return_val_if_fail(inPID>0, NULL);
+	g_return_val_if_fail(inPID>0, FALSE);
+	g_return_val_if_fail(outDesktopFile && *outDesktopFile==NULL, FALSE);
+	g_return_val_if_fail(outLaunchedPID && *outLaunchedPID==NULL, FALSE);
 
 	error=NULL;
 
-	/* Create environment hash-table which will be returned on success */
-	environments=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
-	if(!environments)
-	{
-		g_warning("Could not create environment lookup table for PID %d", inPID);
-		return(NULL);
-	}
-
 	/* Open environment variables of process.
 	 * This is the initial set of environment variables set when process was spawned.
 	 * But that is ok because the environment variables we lookup are set
@@ -303,10 +367,9 @@ static GHashTable* _esdashboard_application_tracker_get_environment_from_pid(gin
 		if(error) g_error_free(error);
 		if(procEnvFile) g_free(procEnvFile);
 		if(envContent) g_free(envContent);
-		if(environments) g_hash_table_destroy(environments);
 
-		/* Return NULL result */
-		return(NULL);
+		/* Return FALSE result */
+		return(FALSE);
 	}
 
 	ESDASHBOARD_DEBUG(_esdashboard_application_tracker, APPLICATIONS,
@@ -315,103 +378,52 @@ static GHashTable* _esdashboard_application_tracker_get_environment_from_pid(gin
 						procEnvFile,
 						envLength);
 
-	/* Iterate through environment variables and insert copy of environment
-	 * variable's name as key and the copy of its value as value into hash-table.
+	/* Iterate through NULL-terminated environment variables and take a copy
+	 * of the values of the first occurence of the variables looked up. Stop
+	 * as soon as all of them were found. The content read is NULL-terminated
+	 * also, so the last variable can be handled like all others.
 	 */
 	iter=envContent;
-	while(envLength>0)
+	end=envContent+envLength;
+	while(iter<end && (!*outDesktopFile || !*outLaunchedPID))
 	{
-		const gchar		*name;
-		const gchar		*value;
-
-		/* Skip NULL-termination */
-		if(!*iter)
+		if(!*outDesktopFile &&
+			g_str_has_prefix(iter, "GIO_LAUNCHED_DESKTOP_FILE="))
 		{
-			envLength--;
-			iter++;
-			continue;
-		}
-
-		/* Split string up to next NULL termination into environment
-		 * name and value.
-		 * Current position of iterator is begin of environment variable's
-		 * name. Next step is to iterate further until the first '=' is found
-		 * which is the seperator for name and value of environment. This
-		 * character is replace with NULL to mark end of name so it can be
-		 * simply copied with g_strdup() later. After this is done iterate
-		 * through string up to NULL termination or end of file but the
-		 * first character iterated marks begin of value.
-		 */
-		name=iter;
-
-		while(*iter && *iter!='=' && envLength>0)
-		{
-			iter++;
-			envLength--;
-		}
-		if(*iter!='=')
-		{
-			g_warning("Malformed environment '%s' in environment set for PID %d at %s",
-						name,
-						inPID,
-						procEnvFile);
-
-			/* Release allocated resources */
-			if(procEnvFile) g_free(procEnvFile);
-			if(envContent) g_free(envContent);
-			if(environments) g_hash_table_destroy(environments);
-
-			/* Return NULL result */
-			return(NULL);
-		}
-		*iter=0;
-
-		value=NULL;
-		do
-		{
-			iter++;
-			envLength--;
-			if(!value) value=iter;
-		}
-		while(*iter && envLength>0);
-
-		/* Insert environment name and value into hash-table but fail on
-		 * duplicate key as a environment variable's name should not be
-		 * found twice.
-		 */
-		if(g_hash_table_lookup(environments, name))
-		{
-			g_warning("Unexpected duplicate name '%s' in environment set for PID %d at %s: %s = %s",
-						name,
-						inPID,
-						procEnvFile,
-						name,
-						value);
-
-			/* Release allocated resources */
-			if(procEnvFile) g_free(procEnvFile);
-			if(envContent) g_free(envContent);
-			if(environments) g_hash_table_destroy(environments);
-
-			/* Return NULL result */
-			return(NULL);
+			*outDesktopFile=g_strdup(iter+strlen("GIO_LAUNCHED_DESKTOP_FILE="));
 		}
+			else if(!*outLaunchedPID &&
+					g_str_has_prefix(iter, "GIO_LAUNCHED_DESKTOP_FILE_PID="))
+			{
+				*outLaunchedPID=g_strdup(iter+strlen("GIO_LAUNCHED_DESKTOP_FILE_PID="));
+			}
 
-		g_hash_table_insert(environments, g_strdup(name), g_strdup(value));
+		/* Continue with next environment variable */
+		iter+=strlen(iter)+1;
 	}
 
 	/* Release allocated resources */
 	if(procEnvFile) g_free(procEnvFile);
 	if(envContent) g_free(envContent);
 
-	/* Return hash-table with environment variables found */
-	return(environments);
+	/* Return TRUE as environment set could be read */
+	return(TRUE);
 }
 #else
-/* Fallback funtion to get process' environment set from requested PID
- * when running at an unsupported system. It just simply returns NULL.
+/* Fallback funtion to get start time of process with requested PID when
+ * running at an unsupported system. It just simply returns 0.
  */
-static GHashTable* _esdashboard_application_tracker_get_environment_from_pid(gint inPID)
+static guint64 _esdashboard_application_tracker_get_process_start_time(gint inPID)
+{
+	return(0);
+}
+
+/* Fallback funtion to get desktop file of process from its environment set
+ * when running at an unsupported system. It just simply returns FALSE.
+ */
+static gboolean _esdashboard_application_tracker_get_launched_desktop_file_from_pid(gint inPID,
+																					gchar **outDesktopFile,
+																					gchar **outLaunchedPID)
 {
 	static gboolean		wasWarningPrinted=FALSE;
 
@@ -421,53 +433,45 @@ static GHashTable* _esdashboard_application_tracker_get_environment_from_pid(gin
 		wasWarningPrinted=TRUE;
 	}
 
-	/* Return NULL to not check environment by callee */
-	return(NULL);
+	/* Return FALSE to not check environment by callee */
+	return(FALSE);
 }
 #endif
 
-/* Get desktop ID from process' environment which owns window.
- * Callee is responsible to free result with g_object_unref().
+/* Get desktop file from environment of process with requested PID. Returns
+ * FALSE if environment could not be read. Otherwise TRUE is returned and the
+ * desktop file is stored at outDesktopFile which is NULL if environment has
+ * no usable desktop file for this process.
+ * Callee is responsible to free desktop file with g_free().
  */
-static GAppInfo* _esdashboard_application_tracker_get_desktop_id_from_environment(EsdashboardApplicationTracker *self,
-																					EsdashboardWindowTrackerWindow *inWindow)
+static gboolean _esdashboard_application_tracker_get_desktop_file_from_process_environment(EsdashboardApplicationTracker *self,
+																							EsdashboardWindowTrackerWindow *inWindow,
+																							gint inPID,
+																							gchar **outDesktopFile)
 {
-	EsdashboardApplicationTrackerPrivate	*priv;
-	GAppInfo								*foundAppInfo;
-	gint									windowPID;
-	GHashTable								*environments;
-	gchar									*value;
+	gchar									*desktopFile;
+	gchar									*launchedPID;
 	gint									checkPID;
 
-	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_TRACKER(self), NULL);
-	g_return_val_if_fail(ESDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow), NULL);
-
-	priv=self->priv;
-	foundAppInfo=NULL;
-
-	/* Get process ID running this window */
-	windowPID=esdashboard_window_tracker_window_get_pid(inWindow);
-	if(windowPID<=0)
-	{
-		ESDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Could not get PID for window '%s' of a running application to parse environment variables",
-							esdashboard_window_tracker_window_get_name(inWindow));
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_TRACKER(self), FALSE);
+	g_return_val_if_fail(ESDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow), FALSE);
+	g_return_val_if_fail(inPID>0, FALSE);
+	g_return_val_if_fail(outDesktopFile, FALSE);
 
-		/* Return NULL result */
-		return(NULL);
-	}
+	*outDesktopFile=NULL;
+	desktopFile=NULL;
+	launchedPID=NULL;
 
-	/* Get hash-table with environment variables found for window's PID */
-	environments=_esdashboard_application_tracker_get_environment_from_pid(windowPID);
-	if(!environments)
+	/* Get environment variables needed for window's PID */
+	if(!_esdashboard_application_tracker_get_launched_desktop_file_from_pid(inPID, &desktopFile, &launchedPID))
 	{
 		ESDASHBOARD_DEBUG(self, APPLICATIONS,
 							"Could not get environments for PID %d of windows '%s'",
-							windowPID,
+							inPID,
 							esdashboard_window_tracker_window_get_name(inWindow));
 
-		/* Return NULL result */
-		return(NULL);
+		/* Return FALSE as environment could not be read */
+		return(FALSE);
 	}
 
 	/* Check that environment variable GIO_LAUNCHED_DESKTOP_FILE_PID exists.
@@ -475,58 +479,75 @@ static GAppInfo* _esdashboard_application_tracker_get_desktop_id_from_environmen
 	 * as the process may inherit the environments of its parent process
 	 * but then this one is not the initial process for this application.
 	 */
-	if(!g_hash_table_lookup_extended(environments, "GIO_LAUNCHED_DESKTOP_FILE_PID", NULL, (gpointer)&value))
+	if(!launchedPID)
 	{
 		ESDASHBOARD_DEBUG(self, APPLICATIONS,
 							"Missing 'GIO_LAUNCHED_DESKTOP_FILE_PID' in environment variables for PID %d of windows '%s'",
-							windowPID,
+							inPID,
 							esdashboard_window_tracker_window_get_name(inWindow));
 
 		/* Release allocated resources */
-		if(environments) g_hash_table_destroy(environments);
+		if(desktopFile) g_free(desktopFile);
 
-		/* Return NULL result */
-		return(NULL);
+		/* Return TRUE as environment could be read but has no usable desktop file */
+		return(TRUE);
 	}
 
-	checkPID=atoi(value);
-	if(checkPID!=windowPID)
+	checkPID=atoi(launchedPID);
+	if(checkPID!=inPID)
 	{
 		ESDASHBOARD_DEBUG(self, APPLICATIONS,
 							"PID %d of environment variables does not match requested window PID %d for '%s'",
 							checkPID,
-							windowPID,
+							inPID,
 							esdashboard_window_tracker_window_get_name(inWindow));
 
 		/* Release allocated resources */
-		if(environments) g_hash_table_destroy(environments);
+		if(desktopFile) g_free(desktopFile);
+		if(launchedPID) g_free(launchedPID);
 
-		/* Return NULL result */
-		return(NULL);
+		/* Return TRUE as environment could be read but has no usable desktop file */
+		return(TRUE);
 	}
 
-	/* Check that environment variable GIO_LAUNCHED_DESKTOP_FILE exists and
-	 * lookup application from full path as set in environment's value.
-	 */
-	if(!g_hash_table_lookup_extended(environments, "GIO_LAUNCHED_DESKTOP_FILE", NULL, (gpointer)&value))
+	/* Check that environment variable GIO_LAUNCHED_DESKTOP_FILE exists */
+	if(!desktopFile)
 	{
 		ESDASHBOARD_DEBUG(self, APPLICATIONS,
 							"Missing 'GIO_LAUNCHED_DESKTOP_FILE' in environment variables for PID %d of windows '%s'",
-							windowPID,
+							inPID,
 							esdashboard_window_tracker_window_get_name(inWindow));
+	}
 
-		/* Release allocated resources */
-		if(environments) g_hash_table_destroy(environments);
+	/* Release allocated resources */
+	if(launchedPID) g_free(launchedPID);
 
-		/* Return NULL result */
-		return(NULL);
-	}
+	/* Return desktop file found which may be NULL */
+	*outDesktopFile=desktopFile;
+	return(TRUE);
+}
 
-	foundAppInfo=esdashboard_application_database_lookup_desktop_id(priv->appDatabase, value);
+/* Lookup application from full path of desktop file as set in environment of
+ * a process or from its basename.
+ * Callee is responsible to free result with g_object_unref().
+ */
+static GAppInfo* _esdashboard_application_tracker_lookup_desktop_file(EsdashboardApplicationTracker *self,
+																		const gchar *inDesktopFile)
+{
+	EsdashboardApplicationTrackerPrivate	*priv;
+	GAppInfo								*foundAppInfo;
+	const gchar								*value;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_TRACKER(self), NULL);
+	g_return_val_if_fail(inDesktopFile && *inDesktopFile, NULL);
+
+	priv=self->priv;
+
+	foundAppInfo=esdashboard_application_database_lookup_desktop_id(priv->appDatabase, inDesktopFile);
 	if(!foundAppInfo)
 	{
 		/* Lookup application from basename of path */
-		value=g_strrstr(value, G_DIR_SEPARATOR_S);
+		value=g_strrstr(inDesktopFile, G_DIR_SEPARATOR_S);
 		if(value)
 		{
 			value++;
@@ -534,12 +555,86 @@ static GAppInfo* _esdashboard_application_tracker_get_desktop_id_from_environmen
 		}
 	}
 
-	/* Release allocated resources */
-	if(environments) g_hash_table_destroy(environments);
-
 	/* Return found application info which may be NULL if not found in
 	 * application database.
 	 */
+	return(foundAppInfo);
+}
+
+/* Get desktop ID from process' environment which owns window. The desktop
+ * file found in environment is remembered for the process until its last
+ * window was closed, so windows of the same process do not need to read its
+ * environment again. It is looked up in application database on each call
+ * as the application database may have changed in the meantime.
+ * Callee is responsible to free result with g_object_unref().
+ */
+static GAppInfo* _esdashboard_application_tracker_get_desktop_id_from_environment(EsdashboardApplicationTracker *self,
+																					EsdashboardWindowTrackerWindow *inWindow)
+{
+	EsdashboardApplicationTrackerPrivate	*priv;
+	GAppInfo								*foundAppInfo;
+	gint									windowPID;
+	guint64									startTime;
+	gchar									*desktopFile;
+	EsdashboardApplicationTrackerProcess	*process;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_TRACKER(self), NULL);
+	g_return_val_if_fail(ESDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow), NULL);
+
+	priv=self->priv;
+	foundAppInfo=NULL;
+
+	/* Get process ID running this window */
+	windowPID=esdashboard_window_tracker_window_get_pid(inWindow);
+	if(windowPID<=0)
+	{
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Could not get PID for window '%s' of a running application to parse environment variables",
+							esdashboard_window_tracker_window_get_name(inWindow));
+
+		/* Return NULL result */
+		return(NULL);
+	}
+
+	/* Use desktop file found before in environment of this process if PID
+	 * was not reused by another process in the meantime.
+	 */
+	startTime=_esdashboard_application_tracker_get_process_start_time(windowPID);
+
+	process=(EsdashboardApplicationTrackerProcess*)g_hash_table_lookup(priv->processes, GINT_TO_POINTER(windowPID));
+	if(process && process->startTime==startTime)
+	{
+		if(process->desktopFile)
+		{
+			foundAppInfo=_esdashboard_application_tracker_lookup_desktop_file(self, process->desktopFile);
+		}
+
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Resolved environment variables of window '%s' to desktop ID '%s' for known PID %d",
+							esdashboard_window_tracker_window_get_name(inWindow),
+							foundAppInfo ? g_app_info_get_id(foundAppInfo) : "<nil>",
+							windowPID);
+
+		return(foundAppInfo);
+	}
+
+	/* Get desktop file from environment of process. If environment could not
+	 * be read do not remember anything so it is tried again next time.
+	 */
+	if(!_esdashboard_application_tracker_get_desktop_file_from_process_environment(self, inWindow, windowPID, &desktopFile))
+	{
+		return(NULL);
+	}
+
+	/* Remember desktop file found in environment, even if there is none */
+	process=g_new0(EsdashboardApplicationTrackerProcess, 1);
+	process->startTime=startTime;
+	process->desktopFile=desktopFile;
+	g_hash_table_insert(priv->processes, GINT_TO_POINTER(windowPID), process);
+
+	/* Lookup application of desktop file */
+	if(desktopFile) foundAppInfo=_esdashboard_application_tracker_lookup_desktop_file(self, desktopFile);
+
 	ESDASHBOARD_DEBUG(self, APPLICATIONS,
 						"Resolved environment variables of window '%s' to desktop ID '%s'",
 						esdashboard_window_tracker_window_get_name(inWindow),
@@ -548,6 +643,47 @@ static GAppInfo* _esdashboard_application_tracker_get_desktop_id_from_environmen
 	return(foundAppInfo);
 }
 
+/* Forget desktop file found for process of a window closed if it was the
+ * last window of this process.
+ */
+static void _esdashboard_application_tracker_forget_process(EsdashboardApplicationTracker *self,
+															EsdashboardWindowTrackerWindow *inWindow)
+{
+	EsdashboardApplicationTrackerPrivate	*priv;
+	gint									windowPID;
+	GList									*iter;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_TRACKER(self));
+	g_return_if_fail(ESDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow));
+
+	priv=self->priv;
+
+	windowPID=esdashboard_window_tracker_window_get_pid(inWindow);
+	if(windowPID<=0 ||
+		!g_hash_table_contains(priv->processes, GINT_TO_POINTER(windowPID)))
+	{
+		return;
+	}
+
+	/* Keep desktop ID if process has any other window */
+	for(iter=esdashboard_window_tracker_get_windows(priv->windowTracker); iter; iter=g_list_next(iter))
+	{
+		EsdashboardWindowTrackerWindow		*window;
+
+		window=ESDASHBOARD_WINDOW_TRACKER_WINDOW(iter->data);
+		if(window==inWindow) continue;
+
+		if(esdashboard_window_tracker_window_get_pid(window)==windowPID) return;
+	}
+
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Forget desktop file found for PID %d as its last window '%s' was closed",
+						windowPID,
+						esdashboard_window_tracker_window_get_name(inWindow));
+
+	g_hash_table_remove(priv->processes, GINT_TO_POINTER(windowPID));
+}
+
 /* Get desktop ID from window names.
  * Callee is responsible to free result with g_object_unref().
  */
@@ -558,7 +694,6 @@ static GAppInfo* _esdashboard_application_tracker_get_desktop_id_from_window_nam
 	GAppInfo								*foundAppInfo;
 	gchar									**names;
 	gchar									**iter;
-	GList									*apps;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATION_TRACKER(self), NULL);
 	g_return_val_if_fail(ESDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow), NULL);
@@ -566,9 +701,6 @@ static GAppInfo* _esdashboard_application_tracker_get_desktop_id_from_window_nam
 	priv=self->priv;
 	foundAppInfo=NULL;
 
-	/* Get list of applications */
-	apps=esdashboard_application_database_get_all_applications(priv->appDatabase);
-
 	/* Get window's names */
 	names=esdashboard_window_tracker_window_get_instance_names(inWindow);
 
@@ -600,61 +732,39 @@ static GAppInfo* _esdashboard_application_tracker_get_desktop_id_from_window_nam
 
 		/* If no application was found for the name it may be an application
 		 * located in a subdirectory. Then the desktop ID is prefixed with
-		 * the subdirectory's name followed by a dash. So iterate through all
-		 * applications and lookup with glob pattern '*-' followed by name
+		 * the subdirectory's name followed by a dash. So lookup all
+		 * applications whose desktop ID ends with a dash followed by name
 		 * and suffix '.desktop'.
 		 */
 		if(!appInfo)
 		{
-			GList							*iterApps;
 			GList							*foundSubdirApps;
-			gchar							*globName;
-			GPatternSpec					*globPattern;
-			GAppInfo						*globAppInfo;
-
-			/* Build glob pattern */
-			globAppInfo=NULL;
-			globName=g_strconcat("*-", iterNameLowerCase, NULL);
-			globPattern=g_pattern_spec_new(globName);
-
-			/* Iterate through application and collect applications matching
-			 * glob pattern.
-			 */
-			foundSubdirApps=NULL;
-			for(iterApps=apps; iterApps; iterApps=g_list_next(iterApps))
+			GList							*iterApps;
+
+			foundSubdirApps=esdashboard_application_database_lookup_desktop_id_suffix(priv->appDatabase, iterNameLowerCase);
+			for(iterApps=foundSubdirApps; iterApps; iterApps=g_list_next(iterApps))
 			{
-				if(!G_IS_APP_INFO(iterApps->data)) continue;
-				globAppInfo=G_APP_INFO(iterApps->data);
-
-				if(g_pattern_match_string(globPattern, g_app_info_get_id(globAppInfo)))
-				{
-					foundSubdirApps=g_list_prepend(foundSubdirApps, globAppInfo);
-					ESDASHBOARD_DEBUG(self, APPLICATIONS,
-										"Found possible application '%s' for window '%s' using pattern '%s'",
-										g_app_info_get_id(globAppInfo),
-										esdashboard_window_tracker_window_get_name(inWindow),
-										globName);
-				}
+				ESDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Found possible application '%s' for window '%s' using suffix '-%s'",
+									g_app_info_get_id(G_APP_INFO(iterApps->data)),
+									esdashboard_window_tracker_window_get_name(inWindow),
+									iterNameLowerCase);
 			}
 
-			/* If exactly one application was collected because it matched
-			 * the glob pattern then we found the application.
-			 */
+			/* If exactly one application was found then we found the application */
 			if(g_list_length(foundSubdirApps)==1)
 			{
 				appInfo=G_APP_INFO(g_object_ref(G_OBJECT(foundSubdirApps->data)));
 
 				ESDASHBOARD_DEBUG(self, APPLICATIONS,
-									"Found exactly one application named '%s' for window '%s' using pattern '%s'",
+									"Found exactly one application named '%s' for window '%s' using suffix '-%s'",
 									g_app_info_get_id(appInfo),
 									esdashboard_window_tracker_window_get_name(inWindow),
-									globName);
+									iterNameLowerCase);
 			}
 
 			/* Release allocated resources */
-			if(foundSubdirApps) g_list_free(foundSubdirApps);
-			if(globPattern) g_pattern_spec_free(globPattern);
-			if(globName) g_free(globName);
+			if(foundSubdirApps) g_list_free_full(foundSubdirApps, g_object_unref);
 		}
 
 		/* If we still did not find an application continue with next
@@ -689,7 +799,6 @@ static GAppInfo* _esdashboard_application_tracker_get_desktop_id_from_window_nam
 			if(foundAppInfo) g_object_unref(foundAppInfo);
 			if(appInfo) g_object_unref(appInfo);
 			if(names) g_strfreev(names);
-			if(apps) g_list_free_full(apps, g_object_unref);
 
 			return(NULL);
 		}
@@ -708,7 +817,6 @@ static GAppInfo* _esdashboard_application_tracker_get_desktop_id_from_window_nam
 
 	/* Release allocated resources */
 	if(names) g_strfreev(names);
-	if(apps) g_list_free_full(apps, g_object_unref);
 
 	/* Return found application info */
 	ESDASHBOARD_DEBUG(self, APPLICATIONS,
@@ -820,6 +928,9 @@ static void _esdashboard_application_tracker_on_window_closed(EsdashboardApplica
 
 	priv=self->priv;
 
+	/* Forget desktop file of window's process if it was its last window */
+	_esdashboard_application_tracker_forget_process(self, inWindow);
+
 	/* Find application tracker item in list of known running applications
 	 * matching the window just closed.
 	 */
@@ -973,6 +1084,12 @@ static void _esdashboard_application_tracker_dispose(GObject *inObject)
 		priv->appDatabase=NULL;
 	}
 
+	if(priv->processes)
+	{
+		g_hash_table_destroy(priv->processes);
+		priv->processes=NULL;
+	}
+
 	/* Call parent's class dispose method */
 	G_OBJECT_CLASS(esdashboard_application_tracker_parent_class)->dispose(inObject);
 }
@@ -1031,6 +1148,10 @@ static void esdashboard_application_tracker_init(EsdashboardApplicationTracker *
 	priv->runningApps=NULL;
 	priv->appDatabase=esdashboard_application_database_get_default();
 	priv->windowTracker=esdashboard_window_tracker_get_default();
+	priv->processes=g_hash_table_new_full(g_direct_hash,
+											g_direct_equal,
+											NULL,
+											(GDestroyNotify)_esdashboard_application_tracker_process_free);
 
 	/* Load application database if not done already */
 	if(!esdashboard_application_database_is_loaded(priv->appDatabase))
@@ -42,6 +42,8 @@ struct _EsdashboardApplicationsMenuModelPrivate
 
 	EsdashboardApplicationDatabase	*appDB;
 	guint							reloadRequiredSignalID;
+
+	GCancellable					*loadCancellable;
 };
 
 G_DEFINE_TYPE_WITH_PRIVATE(EsdashboardApplicationsMenuModel,
@@ -62,8 +64,11 @@ static guint EsdashboardApplicationsMenuModelSignals[SIGNAL_LAST]={ 0, };
 typedef struct _EsdashboardApplicationsMenuModelFillData		EsdashboardApplicationsMenuModelFillData;
 struct _EsdashboardApplicationsMenuModelFillData
 {
+	MarkonMenu			*rootMenu;
+	GCancellable		*cancellable;
 	gint				sequenceID;
 	GSList				*populatedMenus;
+	GPtrArray			*items;
 };
 
 typedef struct _EsdashboardApplicationsMenuModelItem			EsdashboardApplicationsMenuModelItem;
@@ -78,7 +83,7 @@ struct _EsdashboardApplicationsMenuModelItem
 };
 
 /* Forward declarations */
-static void _esdashboard_applications_menu_model_fill_model(EsdashboardApplicationsMenuModel *self);
+static void _esdashboard_applications_menu_model_load(EsdashboardApplicationsMenuModel *self);
 
 /* Free an item of application menu model */
 static void _esdashboard_applications_menu_model_item_free(EsdashboardApplicationsMenuModelItem *inItem)
@@ -117,30 +122,7 @@ static void _esdashboard_applications_menu_model_on_reload_required(EsdashboardA
 
 	/* Reload menu by filling it again. This also emits all necessary signals. */
 	ESDASHBOARD_DEBUG(self, APPLICATIONS, "Applications menu has changed and needs to be reloaded.");
-	_esdashboard_applications_menu_model_fill_model(self);
-}
-
-/* Clear all data in model and also release all allocated resources needed for this model */
-static void _esdashboard_applications_menu_model_clear(EsdashboardApplicationsMenuModel *self)
-{
-	EsdashboardApplicationsMenuModelPrivate		*priv;
-
-	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
-
-	priv=self->priv;
-
-	/* Unset filter (forces all rows being accessible and not being skipped/filtered) */
-	esdashboard_model_set_filter(ESDASHBOARD_MODEL(self), NULL, NULL, NULL);
-
-	/* Clean up and remove all rows */
-	esdashboard_model_remove_all(ESDASHBOARD_MODEL(self));
-
-	/* Destroy root menu */
-	if(priv->rootMenu)
-	{
-		g_object_unref(priv->rootMenu);
-		priv->rootMenu=NULL;
-	}
+	_esdashboard_applications_menu_model_load(self);
 }
 
 /* Helper function to filter model data */
@@ -245,16 +227,17 @@ static gboolean _esdashboard_applications_menu_model_filter_empty(EsdashboardMod
 	return(FALSE);
 }
 
-/* Fill model */
-static MarkonMenu* _esdashboard_applications_menu_model_find_similar_menu(EsdashboardApplicationsMenuModel *self,
-																			MarkonMenu *inMenu,
+/* Fill model.
+ * The menu tree is walked and flattened in a worker thread so these functions
+ * must not access the model but only the fill data passed in.
+ */
+static MarkonMenu* _esdashboard_applications_menu_model_find_similar_menu(MarkonMenu *inMenu,
 																			EsdashboardApplicationsMenuModelFillData *inFillData)
 {
 	MarkonMenu					*parentMenu;
 	GSList						*iter;
 	MarkonMenu					*foundMenu;
 
-	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self), NULL);
 	g_return_val_if_fail(MARKON_IS_MENU(inMenu), NULL);
 	g_return_val_if_fail(inFillData, NULL);
 
@@ -349,18 +332,14 @@ static MarkonMenu* _esdashboard_applications_menu_model_find_similar_menu(Esdash
 	return(foundMenu);
 }
 
-static MarkonMenu* _esdashboard_applications_menu_model_find_section(EsdashboardApplicationsMenuModel *self,
-																		MarkonMenu *inMenu,
+static MarkonMenu* _esdashboard_applications_menu_model_find_section(MarkonMenu *inMenu,
 																		EsdashboardApplicationsMenuModelFillData *inFillData)
 {
-	EsdashboardApplicationsMenuModelPrivate		*priv;
 	MarkonMenu									*sectionMenu;
 	MarkonMenu									*parentMenu;
 
-	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self), NULL);
 	g_return_val_if_fail(MARKON_IS_MENU(inMenu), NULL);
-
-	priv=self->priv;
+	g_return_val_if_fail(inFillData, NULL);
 
 	/* Finding section is technically the same as looking up similar menu
 	 * but only at top-level menus. So iterate through all parent menu
@@ -374,7 +353,7 @@ static MarkonMenu* _esdashboard_applications_menu_model_find_section(Esdashboard
 		parentMenu=markon_menu_get_parent(sectionMenu);
 
 		/* Check if parent menu is root menu stop here */
-		if(!parentMenu || parentMenu==priv->rootMenu) break;
+		if(!parentMenu || parentMenu==inFillData->rootMenu) break;
 
 		/* Set current parent menu as found section menu */
 		sectionMenu=parentMenu;
@@ -384,42 +363,42 @@ static MarkonMenu* _esdashboard_applications_menu_model_find_section(Esdashboard
 	/* Find similar menu to found section menu */
 	if(sectionMenu)
 	{
-		sectionMenu=_esdashboard_applications_menu_model_find_similar_menu(self, sectionMenu, inFillData);
+		sectionMenu=_esdashboard_applications_menu_model_find_similar_menu(sectionMenu, inFillData);
 	}
 
 	/* Return found section menu */
 	return(sectionMenu);
 }
 
-static void _esdashboard_applications_menu_model_fill_model_collect_menu(EsdashboardApplicationsMenuModel *self,
-																			MarkonMenu *inMenu,
+static void _esdashboard_applications_menu_model_fill_model_collect_menu(MarkonMenu *inMenu,
 																			MarkonMenu *inParentMenu,
 																			EsdashboardApplicationsMenuModelFillData *inFillData)
 {
-	EsdashboardApplicationsMenuModelPrivate			*priv;
 	MarkonMenu										*menu;
 	MarkonMenu										*section;
 	GList											*elements, *element;
 	EsdashboardApplicationsMenuModelItem			*item;
 
-	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
 	g_return_if_fail(MARKON_IS_MENU(inMenu));
+	g_return_if_fail(inFillData);
 
-	priv=self->priv;
 	section=NULL;
-	menu=priv->rootMenu;
+	menu=inFillData->rootMenu;
+
+	/* Stop walking menu tree if loading was cancelled */
+	if(g_cancellable_is_cancelled(inFillData->cancellable)) return;
 
 	/* Increase reference on menu going to be processed to keep it alive */
 	g_object_ref(inMenu);
 
 	/* Skip additional check on root menu as it must be processed normally and non-disruptively */
-	if(inMenu!=priv->rootMenu)
+	if(inMenu!=inFillData->rootMenu)
 	{
 		/* Find section to add menu to */
-		section=_esdashboard_applications_menu_model_find_section(self, inMenu, inFillData);
+		section=_esdashboard_applications_menu_model_find_section(inMenu, inFillData);
 
 		/* Add menu to model if no duplicate or similar menu exist */
-		menu=_esdashboard_applications_menu_model_find_similar_menu(self, inMenu, inFillData);
+		menu=_esdashboard_applications_menu_model_find_similar_menu(inMenu, inFillData);
 		if(!menu)
 		{
 			gchar									*title;
@@ -450,7 +429,7 @@ static void _esdashboard_applications_menu_model_fill_model_collect_menu(Esdashb
 			if(title) item->title=g_strdup(title);
 			if(description) item->description=g_strdup(description);
 
-			esdashboard_model_append(ESDASHBOARD_MODEL(self), item, NULL);
+			g_ptr_array_add(inFillData->items, item);
 
 			/* Add menu to list of populated ones */
 			inFillData->populatedMenus=g_slist_prepend(inFillData->populatedMenus, inMenu);
@@ -459,7 +438,7 @@ static void _esdashboard_applications_menu_model_fill_model_collect_menu(Esdashb
 			menu=inMenu;
 
 			/* Find section of newly created menu to */
-			section=_esdashboard_applications_menu_model_find_section(self, menu, inFillData);
+			section=_esdashboard_applications_menu_model_find_section(menu, inFillData);
 
 			/* Release allocated resources */
 			g_free(title);
@@ -482,14 +461,14 @@ static void _esdashboard_applications_menu_model_fill_model_collect_menu(Esdashb
 		/* If element is a menu call this function recursively */
 		if(MARKON_IS_MENU(menuElement))
 		{
-			_esdashboard_applications_menu_model_fill_model_collect_menu(self, MARKON_MENU(menuElement), menu, inFillData);
+			_esdashboard_applications_menu_model_fill_model_collect_menu(MARKON_MENU(menuElement), menu, inFillData);
 		}
 
 		/* Insert row into model if menu element is a menu item if it does not
 		 * belong to root menu.
 		 */
 		if(MARKON_IS_MENU_ITEM(menuElement) &&
-			menu!=priv->rootMenu)
+			menu!=inFillData->rootMenu)
 		{
 			gchar									*title;
 			gchar									*description;
@@ -517,7 +496,7 @@ static void _esdashboard_applications_menu_model_fill_model_collect_menu(Esdashb
 			if(title) item->title=g_strdup(title);
 			if(description) item->description=g_strdup(description);
 
-			esdashboard_model_append(ESDASHBOARD_MODEL(self), item, NULL);
+			g_ptr_array_add(inFillData->items, item);
 
 			/* Release allocated resources */
 			g_free(title);
@@ -530,45 +509,178 @@ static void _esdashboard_applications_menu_model_fill_model_collect_menu(Esdashb
 	g_object_unref(inMenu);
 }
 
-static void _esdashboard_applications_menu_model_fill_model(EsdashboardApplicationsMenuModel *self)
+/* Walk menu tree and flatten it into a snapshot of model items in worker thread.
+ * The menu was loaded completely by application database before and it is not
+ * modified afterwards as a reload creates a new menu instead. So it is only
+ * read here and by the filter functions in main thread which is safe. The
+ * only state shared by markon menus is the global menu item cache which is
+ * guarded by its own lock.
+ */
+static void _esdashboard_applications_menu_model_load_thread(GTask *inTask,
+																gpointer inSourceObject,
+																gpointer inTaskData,
+																GCancellable *inCancellable)
 {
-	EsdashboardApplicationsMenuModelPrivate		*priv;
-	MarkonMenuItemCache							*cache;
 	EsdashboardApplicationsMenuModelFillData	fillData;
 
+	g_return_if_fail(MARKON_IS_MENU(inTaskData));
+
+	/* Iterate through menus recursively to collect items for model */
+	fillData.rootMenu=MARKON_MENU(inTaskData);
+	fillData.cancellable=inCancellable;
+	fillData.sequenceID=0;
+	fillData.populatedMenus=NULL;
+	fillData.items=g_ptr_array_new_with_free_func((GDestroyNotify)_esdashboard_applications_menu_model_item_free);
+	_esdashboard_applications_menu_model_fill_model_collect_menu(fillData.rootMenu, NULL, &fillData);
+
+	/* Release allocated resources at fill data structure */
+	if(fillData.populatedMenus) g_slist_free(fillData.populatedMenus);
+
+	/* Return snapshot if loading was not cancelled meanwhile */
+	if(g_task_return_error_if_cancelled(inTask))
+	{
+		g_ptr_array_unref(fillData.items);
+		return;
+	}
+
+	g_task_return_pointer(inTask, fillData.items, (GDestroyNotify)g_ptr_array_unref);
+}
+
+/* Swap snapshot of model items and its root menu into model. Listeners are
+ * notified once by signal "loaded" when done and not by any signal of model
+ * as the data they would see in between is incomplete.
+ */
+static void _esdashboard_applications_menu_model_swap(EsdashboardApplicationsMenuModel *self,
+														MarkonMenu *inRootMenu,
+														GPtrArray *inItems)
+{
+	EsdashboardApplicationsMenuModelPrivate		*priv;
+
 	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
+	g_return_if_fail(!inRootMenu || MARKON_IS_MENU(inRootMenu));
+	g_return_if_fail(inItems);
 
 	priv=self->priv;
 
-	/* Clear model data */
-	_esdashboard_applications_menu_model_clear(self);
+	/* Set root menu of snapshot */
+	if(priv->rootMenu) g_object_unref(priv->rootMenu);
+	priv->rootMenu=(inRootMenu ? MARKON_MENU(g_object_ref(inRootMenu)) : NULL);
 
-	/* Clear markon's menu item cache otherwise some items will not be loaded
-	 * if this is a reload of the model or a second(, third, ...) instance of model
+	/* Replace model data by all items of snapshot at once. The model takes
+	 * ownership of the items.
 	 */
-	cache=markon_menu_item_cache_get_default();
-	markon_menu_item_cache_invalidate(cache);
-	g_object_unref(cache);
-
-	/* Load root menu */
-	priv->rootMenu=esdashboard_application_database_get_application_menu(priv->appDB);
-
-	/* Iterate through menus recursively to add them to model */
-	fillData.sequenceID=0;
-	fillData.populatedMenus=NULL;
-	_esdashboard_applications_menu_model_fill_model_collect_menu(self, priv->rootMenu, NULL, &fillData);
+	g_ptr_array_set_free_func(inItems, NULL);
+	esdashboard_model_replace_all(ESDASHBOARD_MODEL(self), inItems);
 
 	/* Emit signal */
 	g_signal_emit(self, EsdashboardApplicationsMenuModelSignals[SIGNAL_LOADED], 0);
+}
 
-	/* Release allocated resources at fill data structure */
-	if(fillData.populatedMenus) g_slist_free(fillData.populatedMenus);
+/* Menu tree was flattened in worker thread, so swap snapshot into model */
+static void _esdashboard_applications_menu_model_on_load_done(GObject *inSourceObject,
+																GAsyncResult *inResult,
+																gpointer inUserData)
+{
+	EsdashboardApplicationsMenuModel			*self;
+	EsdashboardApplicationsMenuModelPrivate		*priv;
+	GTask										*task;
+	GPtrArray									*items;
+	MarkonMenu									*rootMenu;
+	GError										*error;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(inSourceObject));
+	g_return_if_fail(G_IS_TASK(inResult));
+
+	self=ESDASHBOARD_APPLICATIONS_MENU_MODEL(inSourceObject);
+	priv=self->priv;
+	task=G_TASK(inResult);
+	error=NULL;
+
+	items=(GPtrArray*)g_task_propagate_pointer(task, &error);
+
+	/* If this loading was cancelled or superseded by a newer one, the snapshot
+	 * is outdated and must not be swapped into model.
+	 */
+	if(g_task_get_cancellable(task)!=priv->loadCancellable)
+	{
+		/* Release allocated resources */
+		if(items) g_ptr_array_unref(items);
+		if(error) g_error_free(error);
+
+		return;
+	}
+
+	g_clear_object(&priv->loadCancellable);
+
+	if(!items)
+	{
+		g_critical("Could not load applications menu: %s",
+					error ? error->message : "Unknown error");
+
+		/* Release allocated resources */
+		if(error) g_error_free(error);
+
+		return;
+	}
+
+	/* Swap snapshot into model */
+	rootMenu=MARKON_MENU(g_task_get_task_data(task));
+	_esdashboard_applications_menu_model_swap(self, rootMenu, items);
+
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Loaded %u items of applications menu '%s'",
+						items->len,
+						markon_menu_element_get_name(MARKON_MENU_ELEMENT(rootMenu)));
+
+	/* Release allocated resources */
+	g_ptr_array_unref(items);
+}
+
+/* Load model from application menu in background */
+static void _esdashboard_applications_menu_model_load(EsdashboardApplicationsMenuModel *self)
+{
+	EsdashboardApplicationsMenuModelPrivate		*priv;
+	MarkonMenu									*rootMenu;
+	GTask										*task;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
+
+	priv=self->priv;
+
+	/* Cancel any loading in progress as it is superseded by this one */
+	if(priv->loadCancellable)
+	{
+		g_cancellable_cancel(priv->loadCancellable);
+		g_clear_object(&priv->loadCancellable);
+	}
+
+	/* Get root menu. If no application menu is available the model is empty. */
+	rootMenu=esdashboard_application_database_get_application_menu(priv->appDB);
+	if(!rootMenu)
+	{
+		GPtrArray								*items;
+
+		items=g_ptr_array_new();
+		_esdashboard_applications_menu_model_swap(self, NULL, items);
+		g_ptr_array_unref(items);
+		return;
+	}
+
+	/* Walk menu tree in worker thread. The model keeps its current data until
+	 * the snapshot is swapped in when done.
+	 */
+	priv->loadCancellable=g_cancellable_new();
+
+	task=g_task_new(self, priv->loadCancellable, _esdashboard_applications_menu_model_on_load_done, NULL);
+	g_task_set_task_data(task, rootMenu, g_object_unref);
+	g_task_run_in_thread(task, _esdashboard_applications_menu_model_load_thread);
+	g_object_unref(task);
 }
 
 /* Idle callback to fill model */
 static gboolean _esdashboard_applications_menu_model_init_idle(gpointer inUserData)
 {
-	_esdashboard_applications_menu_model_fill_model(ESDASHBOARD_APPLICATIONS_MENU_MODEL(inUserData));
+	_esdashboard_applications_menu_model_load(ESDASHBOARD_APPLICATIONS_MENU_MODEL(inUserData));
 	return(G_SOURCE_REMOVE);
 }
 
@@ -582,6 +694,13 @@ static void _esdashboard_applications_menu_model_dispose(GObject *inObject)
 	EsdashboardApplicationsMenuModelPrivate		*priv=self->priv;
 
 	/* Release allocated resources */
+	if(priv->loadCancellable)
+	{
+		g_cancellable_cancel(priv->loadCancellable);
+		g_object_unref(priv->loadCancellable);
+		priv->loadCancellable=NULL;
+	}
+
 	if(priv->rootMenu)
 	{
 		g_object_unref(priv->rootMenu);
@@ -640,6 +759,7 @@ static void esdashboard_applications_menu_model_init(EsdashboardApplicationsMenu
 	priv->rootMenu=NULL;
 	priv->appDB=NULL;
 	priv->reloadRequiredSignalID=0;
+	priv->loadCancellable=NULL;
 
 	/* Get application database and connect signals */
 	priv->appDB=esdashboard_application_database_get_default();
@@ -669,39 +789,22 @@ EsdashboardModel* esdashboard_applications_menu_model_new(void)
 	return(ESDASHBOARD_MODEL(model));
 }
 
-/* Get values from application menu model at requested iterator and columns */
-void esdashboard_applications_menu_model_get(EsdashboardApplicationsMenuModel *self,
-												EsdashboardModelIter *inIter,
-												...)
+/* Get values from item of application menu model at requested columns */
+static void _esdashboard_applications_menu_model_get_valist(EsdashboardApplicationsMenuModelItem *inItem,
+															va_list inArgs)
 {
-	EsdashboardModel							*model;
 	EsdashboardApplicationsMenuModelItem		*item;
-	va_list										args;
 	gint										column;
 	gpointer									*storage;
 
-	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
-	g_return_if_fail(ESDASHBOARD_IS_MODEL_ITER(inIter));
-
-	/* Check if iterator belongs to this model */
-	model=esdashboard_model_iter_get_model(inIter);
-	if(!ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(model) ||
-		ESDASHBOARD_APPLICATIONS_MENU_MODEL(model)!=self)
-	{
-		g_critical("Iterator does not belong to application menu model.");
-		return;
-	}
+	g_return_if_fail(inItem);
 
-	/* Get item from iterator */
-	item=(EsdashboardApplicationsMenuModelItem*)esdashboard_model_iter_get(inIter);
-	g_assert(item);
+	item=inItem;
 
 	/* Iterate through column index and pointer where to store value until
 	 * until end of list (marked with -1) is reached.
 	 */
-	va_start(args, inIter);
-
-	column=va_arg(args, gint);
+	column=va_arg(inArgs, gint);
 	while(column!=-1)
 	{
 		if(column<0 || column>=ESDASHBOARD_APPLICATIONS_MENU_MODEL_COLUMN_LAST)
@@ -714,7 +817,7 @@ void esdashboard_applications_menu_model_get(EsdashboardApplicationsMenuModel *s
 		/* Get generic pointer to storage as it will be casted as necessary
 		 * when determining which column is requested.
 		 */
-		storage=va_arg(args, gpointer*);
+		storage=va_arg(inArgs, gpointer*);
 		if(!storage)
 		{
 			g_warning("No storage pointer provided to store value of column number %d",
@@ -760,9 +863,66 @@ void esdashboard_applications_menu_model_get(EsdashboardApplicationsMenuModel *s
 		}
 
 		/* Continue with next column and storage pointer */
-		column=va_arg(args, gint);
+		column=va_arg(inArgs, gint);
+	}
+}
+
+/* Get values from application menu model at requested iterator and columns */
+void esdashboard_applications_menu_model_get(EsdashboardApplicationsMenuModel *self,
+												EsdashboardModelIter *inIter,
+												...)
+{
+	EsdashboardModel							*model;
+	EsdashboardApplicationsMenuModelItem		*item;
+	va_list										args;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
+	g_return_if_fail(ESDASHBOARD_IS_MODEL_ITER(inIter));
+
+	/* Check if iterator belongs to this model */
+	model=esdashboard_model_iter_get_model(inIter);
+	if(!ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(model) ||
+		ESDASHBOARD_APPLICATIONS_MENU_MODEL(model)!=self)
+	{
+		g_critical("Iterator does not belong to application menu model.");
+		return;
 	}
 
+	/* Get item from iterator */
+	item=(EsdashboardApplicationsMenuModelItem*)esdashboard_model_iter_get(inIter);
+	g_assert(item);
+
+	/* Get values of requested columns */
+	va_start(args, inIter);
+	_esdashboard_applications_menu_model_get_valist(item, args);
+	va_end(args);
+}
+
+/* Get values from application menu model at requested row iterator and columns */
+void esdashboard_applications_menu_model_get_from_row_iter(EsdashboardApplicationsMenuModel *self,
+															EsdashboardModelRowIter *inIter,
+															...)
+{
+	EsdashboardApplicationsMenuModelItem		*item;
+	va_list										args;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
+	g_return_if_fail(inIter);
+
+	/* Check if iterator belongs to this model */
+	if(esdashboard_model_row_iter_get_model(inIter)!=ESDASHBOARD_MODEL(self))
+	{
+		g_critical("Iterator does not belong to application menu model.");
+		return;
+	}
+
+	/* Get item from iterator */
+	item=(EsdashboardApplicationsMenuModelItem*)esdashboard_model_row_iter_get(inIter);
+	g_assert(item);
+
+	/* Get values of requested columns */
+	va_start(args, inIter);
+	_esdashboard_applications_menu_model_get_valist(item, args);
 	va_end(args);
 }
 
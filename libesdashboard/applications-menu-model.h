@@ -91,6 +91,9 @@ EsdashboardModel* esdashboard_applications_menu_model_new(void);
 void esdashboard_applications_menu_model_get(EsdashboardApplicationsMenuModel *self,
 												EsdashboardModelIter *inIter,
 												...);
+void esdashboard_applications_menu_model_get_from_row_iter(EsdashboardApplicationsMenuModel *self,
+															EsdashboardModelRowIter *inIter,
+															...);
 
 void esdashboard_applications_menu_model_filter_by_menu(EsdashboardApplicationsMenuModel *self,
 														MarkonMenu *inMenu);
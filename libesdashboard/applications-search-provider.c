@@ -31,6 +31,8 @@
 #include <glib/gi18n-lib.h>
 #include <gtk/gtk.h>
 #include <errno.h>
+#include <string.h>
+#include <math.h>
 
 #include <libesdashboard/application-database.h>
 #include <libesdashboard/application-button.h>
@@ -55,10 +57,15 @@ struct _EsdashboardApplicationsSearchProviderPrivate
 
 	/* Instance related */
 	EsdashboardApplicationDatabase					*appDB;
-	guint											applicationAddedID;
-	guint											applicationRemovedID;
+	guint											applicationsChangedID;
 
-	GList											*allApps;
+	GMutex											entriesLock;
+	GHashTable										*entries;
+	gboolean										allAppsChanged;
+	gboolean										appDBLoaded;
+	guint											appDBLoadedID;
+	guint											incrementalSearchCount;
+	guint											incrementalSearchCountNotifyID;
 
 	EsconfChannel									*esconfChannel;
 	guint											esconfSortModeBindingID;
@@ -75,6 +82,7 @@ enum
 	PROP_0,
 
 	PROP_SORT_MODE,
+	PROP_INCREMENTAL_SEARCH_COUNT,
 
 	PROP_LAST
 };
@@ -86,11 +94,30 @@ static GParamSpec* EsdashboardApplicationsSearchProviderProperties[PROP_LAST]={
 
 #define DEFAULT_DELIMITERS														"\t\n\r "
 
-#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_FILE				"applications-search-provider-statistics.ini"
+#define FUZZY_MAX_PATTERN_LENGTH												64
+#define FUZZY_MIN_TERM_LENGTH													4
+#define FUZZY_TWO_ERRORS_TERM_LENGTH											8
+#define FUZZY_EXACT_MIN_SCORE													0.5f
+#define FUZZY_MAX_SCORE															0.45f
+
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_FILE				"applications-search-provider-statistics.db"
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_MAGIC				"ESDSTATS"
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_MAGIC_LENGTH		8
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_VERSION				1
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_HEADER_SIZE			16
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_SIZE			16
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_SNAPSHOT		1
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_LAUNCH		2
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_FRECENCY		3
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_MIN_COMPACT_RECORDS	256
+
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_KEYFILE				"applications-search-provider-statistics.ini"
 #define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP		"Entries"
 #define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_COUNT		"Count"
 #define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP	"Used Counters"
 
+#define ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_FRECENCY_HALF_LIFE				(14*24*60*60)
+
 typedef struct _EsdashboardApplicationsSearchProviderGlobal			EsdashboardApplicationsSearchProviderGlobal;
 struct _EsdashboardApplicationsSearchProviderGlobal
 {
@@ -102,30 +129,86 @@ struct _EsdashboardApplicationsSearchProviderGlobal
 	guint								applicationLaunchedSignalID;
 
 	guint								maxUsedCounter;
+	GSequence							*frecency;		/* Statistics sorted by frecency, highest first */
+
+	GFileOutputStream					*logStream;
+	guint								logRecordsCount;
+	goffset								logValidLength;	/* Length of valid records if file ends with garbage, zero otherwise */
+
+	GCancellable						*compactCancellable;
+	GByteArray							*pendingRecords;
+	guint								pendingRecordsCount;
 };
 
 G_LOCK_DEFINE_STATIC(_esdashboard_applications_search_provider_statistics_lock);
+G_LOCK_DEFINE_STATIC(_esdashboard_applications_search_provider_statistics_file_lock);
 EsdashboardApplicationsSearchProviderGlobal		_esdashboard_applications_search_provider_statistics={0, };
 
+typedef struct _EsdashboardApplicationsSearchProviderCompactData	EsdashboardApplicationsSearchProviderCompactData;
+struct _EsdashboardApplicationsSearchProviderCompactData
+{
+	gchar								*filename;
+	GBytes								*data;
+};
+
 typedef struct _EsdashboardApplicationsSearchProviderStatistics		EsdashboardApplicationsSearchProviderStatistics;
 struct _EsdashboardApplicationsSearchProviderStatistics
 {
 	gint								refCount;
 
+	gchar								*appID;
 	guint								usedCounter;
+	gint64								lastUsed;		/* Seconds since epoch */
+
+	/* The frecency is the sum of all launches each decaying exponentially
+	 * with its age. It is stored as natural logarithm of the sum with all
+	 * launches decayed to the epoch instead of now, so it does not need to
+	 * be updated as time passes and the order of applications does not
+	 * change by time. Only differences of it are meaningful.
+	 */
+	gdouble								frecencyLog;
+	GSequenceIter						*frecencyIter;
+};
+
+typedef struct _EsdashboardApplicationsSearchProviderEntry			EsdashboardApplicationsSearchProviderEntry;
+struct _EsdashboardApplicationsSearchProviderEntry
+{
+	EsdashboardDesktopAppInfo			*appInfo;
+	guint								changedID;
+
+	gboolean							shouldShow;
+
+	/* Strings are stored in memory allocated with this entry */
+	const gchar							*desktopID;
+	const gchar							*title;
+	const gchar							*description;
+	const gchar							*command;
+	const gchar							*keywords;		/* Each keyword is NULL-terminated, list ends at empty string */
+};
+
+typedef struct _EsdashboardApplicationsSearchProviderFuzzyPattern	EsdashboardApplicationsSearchProviderFuzzyPattern;
+struct _EsdashboardApplicationsSearchProviderFuzzyPattern
+{
+	guint64								peq[256];		/* Bit mask of positions in pattern for each byte */
+	guint								length;
+	guint								maxErrors;		/* Zero means no fuzzy matching for this term */
 };
 
 /* Create, destroy, ref and unref statistics data */
-static EsdashboardApplicationsSearchProviderStatistics* _esdashboard_applications_search_provider_statistics_new(void)
+static EsdashboardApplicationsSearchProviderStatistics* _esdashboard_applications_search_provider_statistics_new(const gchar *inAppID)
 {
 	EsdashboardApplicationsSearchProviderStatistics	*data;
 
+	g_return_val_if_fail(inAppID && *inAppID, NULL);
+
 	/* Create statistics data */
 	data=g_new0(EsdashboardApplicationsSearchProviderStatistics, 1);
 	if(!data) return(NULL);
 
 	/* Set up statistics data */
 	data->refCount=1;
+	data->appID=g_strdup(inAppID);
+	data->frecencyLog=-INFINITY;
 
 	return(data);
 }
@@ -134,7 +217,11 @@ static void _esdashboard_applications_search_provider_statistics_free(Esdashboar
 {
 	g_return_if_fail(inData);
 
+	/* Remove statistics data from frecency order */
+	if(inData->frecencyIter) g_sequence_remove(inData->frecencyIter);
+
 	/* Release common allocated resources */
+	if(inData->appID) g_free(inData->appID);
 	g_free(inData);
 }
 
@@ -173,6 +260,561 @@ static EsdashboardApplicationsSearchProviderStatistics* _esdashboard_application
 	return(stats);
 }
 
+/* Get frecency (as logarithm) of a single launch at given time */
+static gdouble _esdashboard_applications_search_provider_statistics_frecency_at(gint64 inTimestamp)
+{
+	return(((gdouble)inTimestamp)*G_LN2/ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_FRECENCY_HALF_LIFE);
+}
+
+/* Add two frecencies given as logarithms without leaving logarithmic space */
+static gdouble _esdashboard_applications_search_provider_statistics_frecency_add(gdouble inLeft, gdouble inRight)
+{
+	gdouble												high, low;
+
+	if(isinf(inLeft) && inLeft<0.0) return(inRight);
+	if(isinf(inRight) && inRight<0.0) return(inLeft);
+
+	high=MAX(inLeft, inRight);
+	low=MIN(inLeft, inRight);
+	return(high+log1p(exp(low-high)));
+}
+
+/* Sort statistics data by frecency, highest first */
+static gint _esdashboard_applications_search_provider_statistics_frecency_compare(gconstpointer inLeft,
+																					gconstpointer inRight,
+																					gpointer inUserData)
+{
+	const EsdashboardApplicationsSearchProviderStatistics	*left;
+	const EsdashboardApplicationsSearchProviderStatistics	*right;
+
+	left=(const EsdashboardApplicationsSearchProviderStatistics*)inLeft;
+	right=(const EsdashboardApplicationsSearchProviderStatistics*)inRight;
+
+	if(left->frecencyLog>right->frecencyLog) return(-1);
+	if(left->frecencyLog<right->frecencyLog) return(1);
+	return(g_strcmp0(left->appID, right->appID));
+}
+
+/* Set frecency of statistics data and keep frecency order up-to-date.
+ * Statistics must be locked when calling this function.
+ */
+static void _esdashboard_applications_search_provider_statistics_set_frecency(EsdashboardApplicationsSearchProviderStatistics *inData,
+																				gdouble inFrecencyLog)
+{
+	g_return_if_fail(inData);
+	g_return_if_fail(_esdashboard_applications_search_provider_statistics.frecency);
+
+	inData->frecencyLog=inFrecencyLog;
+
+	if(!inData->frecencyIter)
+	{
+		inData->frecencyIter=g_sequence_insert_sorted(_esdashboard_applications_search_provider_statistics.frecency,
+														inData,
+														_esdashboard_applications_search_provider_statistics_frecency_compare,
+														NULL);
+	}
+		else
+		{
+			g_sequence_sort_changed(inData->frecencyIter,
+									_esdashboard_applications_search_provider_statistics_frecency_compare,
+									NULL);
+		}
+}
+
+/* Estimate frecency of statistics data with launch counter but without
+ * frecency, e.g. from statistics files of older versions, as if all launches
+ * happened at time of last launch or at given time if unknown.
+ * Statistics must be locked when calling this function.
+ */
+static void _esdashboard_applications_search_provider_statistics_estimate_frecency(EsdashboardApplicationsSearchProviderStatistics *inData,
+																					gint64 inFallbackTimestamp)
+{
+	gint64												timestamp;
+
+	g_return_if_fail(inData);
+
+	if(inData->usedCounter==0) return;
+
+	timestamp=(inData->lastUsed>0 ? inData->lastUsed : inFallbackTimestamp);
+	_esdashboard_applications_search_provider_statistics_set_frecency(inData,
+																		log((gdouble)inData->usedCounter)+_esdashboard_applications_search_provider_statistics_frecency_at(timestamp));
+}
+
+/* Get frecency of statistics data relative to the application with highest
+ * frecency as fraction between 0.0 and 1.0. Statistics must be locked when
+ * calling this function.
+ */
+static gdouble _esdashboard_applications_search_provider_statistics_get_relative_frecency(EsdashboardApplicationsSearchProviderStatistics *inData)
+{
+	GSequenceIter										*iter;
+	EsdashboardApplicationsSearchProviderStatistics		*highest;
+
+	g_return_val_if_fail(inData, 0.0);
+
+	if(!inData->frecencyIter) return(0.0);
+
+	iter=g_sequence_get_begin_iter(_esdashboard_applications_search_provider_statistics.frecency);
+	highest=(EsdashboardApplicationsSearchProviderStatistics*)g_sequence_get(iter);
+
+	return(exp(inData->frecencyLog-highest->frecencyLog));
+}
+
+/* Append a record for an application to binary statistics data */
+static void _esdashboard_applications_search_provider_statistics_add_record(GByteArray *ioData,
+																			guint8 inType,
+																			const gchar *inAppID,
+																			guint32 inCount,
+																			gint64 inTimestamp)
+{
+	guint8												record[ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_SIZE];
+	gsize												appIDLength;
+	guint16												valueUInt16;
+	guint32												valueUInt32;
+	gint64												valueInt64;
+
+	g_return_if_fail(ioData);
+	g_return_if_fail(inAppID && *inAppID);
+
+	appIDLength=strlen(inAppID);
+	g_return_if_fail(appIDLength<=G_MAXUINT16);
+
+	/* Each record consists of its type, the length of application ID, the
+	 * launch counter and the time of last launch in seconds since epoch - all
+	 * in little-endian byte order - followed by the application ID without
+	 * NULL-terminator.
+	 */
+	memset(record, 0, sizeof(record));
+	record[0]=inType;
+
+	valueUInt16=GUINT16_TO_LE((guint16)appIDLength);
+	memcpy(record+2, &valueUInt16, sizeof(valueUInt16));
+
+	valueUInt32=GUINT32_TO_LE(inCount);
+	memcpy(record+4, &valueUInt32, sizeof(valueUInt32));
+
+	valueInt64=GINT64_TO_LE(inTimestamp);
+	memcpy(record+8, &valueInt64, sizeof(valueInt64));
+
+	g_byte_array_append(ioData, record, sizeof(record));
+	g_byte_array_append(ioData, (const guint8*)inAppID, appIDLength);
+}
+
+/* Build binary statistics data with file header and one snapshot record for
+ * each application. Statistics must be locked when calling this function.
+ */
+static GBytes* _esdashboard_applications_search_provider_statistics_build_snapshot(void)
+{
+	GByteArray											*data;
+	guint8												header[ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_HEADER_SIZE];
+	guint32												version;
+	GHashTableIter										iter;
+	const gchar											*appID;
+	EsdashboardApplicationsSearchProviderStatistics		*stats;
+
+	data=g_byte_array_new();
+
+	/* Write file header */
+	memset(header, 0, sizeof(header));
+	memcpy(header, ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_MAGIC, ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_MAGIC_LENGTH);
+
+	version=GUINT32_TO_LE(ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_VERSION);
+	memcpy(header+ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_MAGIC_LENGTH, &version, sizeof(version));
+
+	g_byte_array_append(data, header, sizeof(header));
+
+	/* Write snapshot record for each application but skip default values
+	 * to keep file small.
+	 */
+	g_hash_table_iter_init(&iter, _esdashboard_applications_search_provider_statistics.stats);
+	while(g_hash_table_iter_next(&iter, (gpointer*)&appID, (gpointer*)&stats))
+	{
+		if(stats->usedCounter==0) continue;
+
+		_esdashboard_applications_search_provider_statistics_add_record(data,
+																		ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_SNAPSHOT,
+																		appID,
+																		stats->usedCounter,
+																		stats->lastUsed);
+
+		/* Launches are not stored in snapshot so store frecency in an own
+		 * record. Its value is stored bitwise in place of the timestamp.
+		 */
+		if(stats->frecencyIter)
+		{
+			union
+			{
+				gdouble									frecency;
+				gint64									bits;
+			} value;
+
+			value.frecency=stats->frecencyLog;
+			_esdashboard_applications_search_provider_statistics_add_record(data,
+																			ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_FRECENCY,
+																			appID,
+																			0,
+																			value.bits);
+		}
+	}
+
+	/* Return binary statistics data */
+	return(g_byte_array_free_to_bytes(data));
+}
+
+/* Write binary statistics data to file by replacing it atomically */
+static gboolean _esdashboard_applications_search_provider_statistics_write_file(const gchar *inFilename,
+																				GBytes *inData,
+																				GError **outError)
+{
+	gchar												*fileFolder;
+	gconstpointer										data;
+	gsize												dataLength;
+
+	g_return_val_if_fail(inFilename && *inFilename, FALSE);
+	g_return_val_if_fail(inData, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	/* Create parent folders for statistics file if not available */
+	fileFolder=g_path_get_dirname(inFilename);
+	if(g_mkdir_with_parents(fileFolder, 0700)<0)
+	{
+		int												errno_save;
+
+		/* Get error code */
+		errno_save=errno;
+
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						g_io_error_from_errno(errno_save),
+						"Could not create configuration folder for applications search provider at %s: %s",
+						fileFolder,
+						g_strerror(errno_save));
+
+		/* Release allocated resources */
+		if(fileFolder) g_free(fileFolder);
+
+		return(FALSE);
+	}
+
+	/* Release allocated resources */
+	if(fileFolder) g_free(fileFolder);
+
+	/* Store binary statistics data in file */
+	data=g_bytes_get_data(inData, &dataLength);
+	return(g_file_set_contents(inFilename, data, dataLength, outError));
+}
+
+/* Truncate statistics file to its valid records if it ends with a truncated
+ * or corrupt record, so records appended later are readable again.
+ * Statistics must be locked when calling this function.
+ */
+static gboolean _esdashboard_applications_search_provider_statistics_truncate_log(GError **outError)
+{
+	GFile												*file;
+	GFileIOStream										*stream;
+	gboolean											success;
+
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	/* Check if statistics file needs to be truncated */
+	if(_esdashboard_applications_search_provider_statistics.logValidLength==0) return(TRUE);
+
+	/* Open statistics file and cut off everything behind last valid record */
+	file=g_file_new_for_path(_esdashboard_applications_search_provider_statistics.filename);
+	stream=g_file_open_readwrite(file, NULL, outError);
+	g_object_unref(file);
+	if(!stream) return(FALSE);
+
+	success=g_seekable_truncate(G_SEEKABLE(stream),
+								_esdashboard_applications_search_provider_statistics.logValidLength,
+								NULL,
+								outError);
+	if(success) success=g_io_stream_close(G_IO_STREAM(stream), NULL, outError);
+		else g_io_stream_close(G_IO_STREAM(stream), NULL, NULL);
+	g_object_unref(stream);
+
+	if(!success) return(FALSE);
+
+	ESDASHBOARD_DEBUG(NULL, APPLICATIONS,
+						"Truncated statistics file %s of applications search provider to %" G_GOFFSET_FORMAT " bytes",
+						_esdashboard_applications_search_provider_statistics.filename,
+						_esdashboard_applications_search_provider_statistics.logValidLength);
+
+	/* Statistics file contains only valid records now */
+	_esdashboard_applications_search_provider_statistics.logValidLength=0;
+
+	return(TRUE);
+}
+
+/* Append records to log at end of statistics file. If statistics file is
+ * compacted currently the records are queued until compaction is done.
+ * Statistics must be locked when calling this function.
+ */
+static void _esdashboard_applications_search_provider_statistics_append(const guint8 *inData,
+																		gsize inLength,
+																		guint inRecordsCount)
+{
+	GError												*error;
+
+	g_return_if_fail(inData || inLength==0);
+
+	error=NULL;
+
+	/* If we have no filename do not store statistics */
+	if(!_esdashboard_applications_search_provider_statistics.filename) return;
+
+	/* Queue records if statistics file is compacted currently */
+	if(_esdashboard_applications_search_provider_statistics.compactCancellable)
+	{
+		g_byte_array_append(_esdashboard_applications_search_provider_statistics.pendingRecords, inData, inLength);
+		_esdashboard_applications_search_provider_statistics.pendingRecordsCount+=inRecordsCount;
+		return;
+	}
+
+	/* Open statistics file for appending if not done already */
+	if(!_esdashboard_applications_search_provider_statistics.logStream)
+	{
+		GFile											*file;
+
+		/* Records appended behind a truncated or corrupt record could not be
+		 * read anymore, so cut it off first. If this fails do not append at
+		 * all and leave it to the next compaction to store these records.
+		 */
+		if(!_esdashboard_applications_search_provider_statistics_truncate_log(&error))
+		{
+			g_warning("Could not truncate corrupt statistics file %s of applications search provider: %s",
+						_esdashboard_applications_search_provider_statistics.filename,
+						error ? error->message : "Unknown error");
+			if(error) g_clear_error(&error);
+
+			return;
+		}
+
+		file=g_file_new_for_path(_esdashboard_applications_search_provider_statistics.filename);
+		_esdashboard_applications_search_provider_statistics.logStream=g_file_append_to(file, G_FILE_CREATE_PRIVATE, NULL, &error);
+		g_object_unref(file);
+
+		if(!_esdashboard_applications_search_provider_statistics.logStream)
+		{
+			g_warning("Could not open statistics file %s of applications search provider: %s",
+						_esdashboard_applications_search_provider_statistics.filename,
+						error ? error->message : "Unknown error");
+			if(error) g_clear_error(&error);
+
+			return;
+		}
+	}
+
+	/* Write records to end of statistics file */
+	if(!g_output_stream_write_all(G_OUTPUT_STREAM(_esdashboard_applications_search_provider_statistics.logStream), inData, inLength, NULL, NULL, &error) ||
+		!g_output_stream_flush(G_OUTPUT_STREAM(_esdashboard_applications_search_provider_statistics.logStream), NULL, &error))
+	{
+		g_warning("Could not write to statistics file %s of applications search provider: %s",
+					_esdashboard_applications_search_provider_statistics.filename,
+					error ? error->message : "Unknown error");
+		if(error) g_clear_error(&error);
+
+		return;
+	}
+
+	_esdashboard_applications_search_provider_statistics.logRecordsCount+=inRecordsCount;
+}
+
+/* Close log of statistics file. Statistics must be locked when calling
+ * this function.
+ */
+static void _esdashboard_applications_search_provider_statistics_close_log(void)
+{
+	if(!_esdashboard_applications_search_provider_statistics.logStream) return;
+
+	g_output_stream_close(G_OUTPUT_STREAM(_esdashboard_applications_search_provider_statistics.logStream), NULL, NULL);
+	g_object_unref(_esdashboard_applications_search_provider_statistics.logStream);
+	_esdashboard_applications_search_provider_statistics.logStream=NULL;
+}
+
+/* Free data of a compaction of statistics file */
+static void _esdashboard_applications_search_provider_statistics_compact_data_free(EsdashboardApplicationsSearchProviderCompactData *inData)
+{
+	g_return_if_fail(inData);
+
+	/* Release allocated resources */
+	if(inData->filename) g_free(inData->filename);
+	if(inData->data) g_bytes_unref(inData->data);
+	g_free(inData);
+}
+
+/* Replace statistics file with snapshot in worker thread */
+static void _esdashboard_applications_search_provider_statistics_compact_thread(GTask *inTask,
+																				gpointer inSourceObject,
+																				gpointer inTaskData,
+																				GCancellable *inCancellable)
+{
+	EsdashboardApplicationsSearchProviderCompactData	*data;
+	GError												*error;
+
+	data=(EsdashboardApplicationsSearchProviderCompactData*)inTaskData;
+	error=NULL;
+
+	/* Lock statistics file as it may be written when statistics are destroyed.
+	 * If compaction was cancelled meanwhile the snapshot must not replace the
+	 * statistics file anymore as records may have been appended to it.
+	 */
+	G_LOCK(_esdashboard_applications_search_provider_statistics_file_lock);
+
+	if(g_cancellable_set_error_if_cancelled(inCancellable, &error) ||
+		!_esdashboard_applications_search_provider_statistics_write_file(data->filename, data->data, &error))
+	{
+		G_UNLOCK(_esdashboard_applications_search_provider_statistics_file_lock);
+
+		g_task_return_error(inTask, error);
+		return;
+	}
+
+	/* The snapshot replaced statistics file so any garbage at its end is gone.
+	 * It is safe to reset it here as it is only accessed while no compaction
+	 * is running or while holding the file lock.
+	 */
+	_esdashboard_applications_search_provider_statistics.logValidLength=0;
+
+	G_UNLOCK(_esdashboard_applications_search_provider_statistics_file_lock);
+
+	g_task_return_boolean(inTask, TRUE);
+}
+
+/* Compaction of statistics file has finished */
+static void _esdashboard_applications_search_provider_statistics_on_compact_done(GObject *inSourceObject,
+																					GAsyncResult *inResult,
+																					gpointer inUserData)
+{
+	GCancellable										*cancellable;
+	GByteArray											*pendingRecords;
+	guint												pendingRecordsCount;
+	gboolean											success;
+	GError												*error;
+
+	g_return_if_fail(G_IS_TASK(inResult));
+	g_return_if_fail(G_IS_CANCELLABLE(inUserData));
+
+	cancellable=G_CANCELLABLE(inUserData);
+	error=NULL;
+
+	success=g_task_propagate_boolean(G_TASK(inResult), &error);
+
+	/* Lock for thread-safety */
+	G_LOCK(_esdashboard_applications_search_provider_statistics_lock);
+
+	/* If compaction was cancelled, statistics were destroyed and all queued
+	 * records were written already.
+	 */
+	if(cancellable!=_esdashboard_applications_search_provider_statistics.compactCancellable)
+	{
+		G_UNLOCK(_esdashboard_applications_search_provider_statistics_lock);
+
+		/* Release allocated resources */
+		if(error) g_error_free(error);
+		g_object_unref(cancellable);
+
+		return;
+	}
+
+	/* A failed compaction left the old statistics file untouched. If it ends
+	 * with a truncated or corrupt record it will be truncated before queued
+	 * records are appended.
+	 */
+	if(success)
+	{
+		ESDASHBOARD_DEBUG(NULL, APPLICATIONS,
+							"Compacted statistics file %s of applications search provider",
+							_esdashboard_applications_search_provider_statistics.filename);
+
+		_esdashboard_applications_search_provider_statistics.logRecordsCount=0;
+	}
+		else
+		{
+			g_warning("Could not compact statistics file %s of applications search provider: %s",
+						_esdashboard_applications_search_provider_statistics.filename,
+						error ? error->message : "Unknown error");
+		}
+
+	/* Compaction is done so append queued records to statistics file */
+	g_clear_object(&_esdashboard_applications_search_provider_statistics.compactCancellable);
+
+	pendingRecords=_esdashboard_applications_search_provider_statistics.pendingRecords;
+	pendingRecordsCount=_esdashboard_applications_search_provider_statistics.pendingRecordsCount;
+	_esdashboard_applications_search_provider_statistics.pendingRecords=g_byte_array_new();
+	_esdashboard_applications_search_provider_statistics.pendingRecordsCount=0;
+
+	if(pendingRecords->len>0)
+	{
+		_esdashboard_applications_search_provider_statistics_append(pendingRecords->data,
+																	pendingRecords->len,
+																	pendingRecordsCount);
+	}
+
+	/* Unlock for thread-safety */
+	G_UNLOCK(_esdashboard_applications_search_provider_statistics_lock);
+
+	/* Release allocated resources */
+	g_byte_array_unref(pendingRecords);
+	if(error) g_error_free(error);
+	g_object_unref(cancellable);
+}
+
+/* Compact statistics file in background by replacing it with a snapshot of
+ * current statistics if enough records were appended to its log or if it ends
+ * with a truncated or corrupt record. Statistics must be locked when calling
+ * this function.
+ */
+static void _esdashboard_applications_search_provider_statistics_compact(void)
+{
+	EsdashboardApplicationsSearchProviderCompactData	*data;
+	GTask												*task;
+	guint												threshold;
+
+	/* Do not compact if we have no filename or compaction is running already */
+	if(!_esdashboard_applications_search_provider_statistics.filename ||
+		_esdashboard_applications_search_provider_statistics.compactCancellable)
+	{
+		return;
+	}
+
+	/* Check if enough records were appended to log of statistics file. A
+	 * statistics file ending with garbage is always compacted.
+	 */
+	threshold=MAX(ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_MIN_COMPACT_RECORDS,
+					g_hash_table_size(_esdashboard_applications_search_provider_statistics.stats));
+	if(_esdashboard_applications_search_provider_statistics.logValidLength==0 &&
+		_esdashboard_applications_search_provider_statistics.logRecordsCount<threshold)
+	{
+		return;
+	}
+
+	ESDASHBOARD_DEBUG(NULL, APPLICATIONS,
+						"Compacting statistics file %s of applications search provider with %u records in log",
+						_esdashboard_applications_search_provider_statistics.filename,
+						_esdashboard_applications_search_provider_statistics.logRecordsCount);
+
+	/* Build snapshot to write in worker thread */
+	data=g_new0(EsdashboardApplicationsSearchProviderCompactData, 1);
+	data->filename=g_strdup(_esdashboard_applications_search_provider_statistics.filename);
+	data->data=_esdashboard_applications_search_provider_statistics_build_snapshot();
+
+	/* Close log as the statistics file will be replaced. Records appended
+	 * until compaction is done will be queued.
+	 */
+	_esdashboard_applications_search_provider_statistics_close_log();
+
+	_esdashboard_applications_search_provider_statistics.compactCancellable=g_cancellable_new();
+
+	task=g_task_new(NULL,
+					_esdashboard_applications_search_provider_statistics.compactCancellable,
+					_esdashboard_applications_search_provider_statistics_on_compact_done,
+					g_object_ref(_esdashboard_applications_search_provider_statistics.compactCancellable));
+	g_task_set_task_data(task, data, (GDestroyNotify)_esdashboard_applications_search_provider_statistics_compact_data_free);
+	g_task_run_in_thread(task, _esdashboard_applications_search_provider_statistics_compact_thread);
+	g_object_unref(task);
+}
+
 /* An application was launched successfully */
 static void _esdashboard_applications_search_provider_on_application_launched(EsdashboardApplication *inApplication,
 																				GAppInfo *inAppInfo,
@@ -180,6 +822,7 @@ static void _esdashboard_applications_search_provider_on_application_launched(Es
 {
 	const gchar											*appID;
 	EsdashboardApplicationsSearchProviderStatistics		*stats;
+	GByteArray											*record;
 
 	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
 
@@ -195,23 +838,43 @@ static void _esdashboard_applications_search_provider_on_application_launched(Es
 	 * to zero which destroys the statistics data.
 	 */
 	stats=_esdashboard_applications_search_provider_statistics_get(appID);
-	if(!stats) stats=_esdashboard_applications_search_provider_statistics_new();
+	if(!stats) stats=_esdashboard_applications_search_provider_statistics_new(appID);
 		else _esdashboard_applications_search_provider_statistics_ref(stats);
 
 	/* Increase launch counter and remember it has highest launch counter if it
 	 * is now higher than the one we remembered.
 	 */
 	stats->usedCounter++;
+	stats->lastUsed=g_get_real_time()/G_USEC_PER_SEC;
 	if(stats->usedCounter>_esdashboard_applications_search_provider_statistics.maxUsedCounter)
 	{
 		_esdashboard_applications_search_provider_statistics.maxUsedCounter=stats->usedCounter;
 	}
 
+	/* Add this launch to frecency which does not need to touch any other
+	 * application's frecency.
+	 */
+	_esdashboard_applications_search_provider_statistics_set_frecency(stats,
+																		_esdashboard_applications_search_provider_statistics_frecency_add(stats->frecencyLog,
+																																			_esdashboard_applications_search_provider_statistics_frecency_at(stats->lastUsed)));
+
 	/* Store updated statistics */
 	g_hash_table_insert(_esdashboard_applications_search_provider_statistics.stats,
 						g_strdup(appID),
 						_esdashboard_applications_search_provider_statistics_ref(stats));
 
+	/* Append launch to statistics file and compact it if needed */
+	record=g_byte_array_new();
+	_esdashboard_applications_search_provider_statistics_add_record(record,
+																	ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_LAUNCH,
+																	appID,
+																	1,
+																	stats->lastUsed);
+	_esdashboard_applications_search_provider_statistics_append(record->data, record->len, 1);
+	g_byte_array_unref(record);
+
+	_esdashboard_applications_search_provider_statistics_compact();
+
 	/* Release extra reference we took to keep this statistics data alive */
 	_esdashboard_applications_search_provider_statistics_unref(stats);
 
@@ -219,118 +882,354 @@ static void _esdashboard_applications_search_provider_on_application_launched(Es
 	G_UNLOCK(_esdashboard_applications_search_provider_statistics_lock);
 }
 
-/* Save statistics to file */
-static gboolean _esdashboard_applications_search_provider_save_statistics(GError **outError)
+/* Load statistics from key file used by older versions */
+static gboolean _esdashboard_applications_search_provider_load_statistics_from_keyfile(EsdashboardApplicationsSearchProvider *self,
+																						const gchar *inFilename,
+																						GError **outError)
 {
 	GKeyFile												*keyFile;
-	gchar													*keyFileData;
-	gsize													keyFileLength;
 	GList													*allAppIDs;
 	GList													*iter;
 	guint													entriesCount;
-	gchar													*fileFolder;
 	GError													*error;
 
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), FALSE);
+	g_return_val_if_fail(inFilename && *inFilename, FALSE);
 	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
 
 	error=NULL;
 
-	/* If we have no filename do not store statistics but do not return error */
-	if(!_esdashboard_applications_search_provider_statistics.filename) return(TRUE);
-
-	/* Create parent folders for key file if not available */
-	fileFolder=g_path_get_dirname(_esdashboard_applications_search_provider_statistics.filename);
-	if(g_mkdir_with_parents(fileFolder, 0700)<0)
+	/* Load statistics from key file */
+	keyFile=g_key_file_new();
+	if(!g_key_file_load_from_file(keyFile, inFilename, G_KEY_FILE_NONE, &error))
 	{
-		int											errno_save;
+		/* Propagate error */
+		g_propagate_error(outError, error);
 
-		/* Get error code */
-		errno_save=errno;
+		/* Release allocated resources */
+		if(keyFile) g_key_file_free(keyFile);
 
-		/* Set error */
-		g_set_error(outError,
-						G_IO_ERROR,
-						g_io_error_from_errno(errno_save),
-						"Could not create configuration folder for applications search provider at %s: %s",
-						fileFolder,
-						g_strerror(errno_save));
+		return(FALSE);
+	}
+
+	/* Get number of applications and their application desktop IDs from key file */
+	entriesCount=g_key_file_get_integer(keyFile,
+										ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP,
+										ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_COUNT,
+										&error);
+	if(error)
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
 
 		/* Release allocated resources */
-		if(fileFolder) g_free(fileFolder);
+		if(keyFile) g_key_file_free(keyFile);
 
 		return(FALSE);
 	}
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Will load statistics for %d applications",
+						entriesCount);
 
-	/* Create and set up key file to store statistics */
-	keyFile=g_key_file_new();
+	allAppIDs=NULL;
+	while(entriesCount>0)
+	{
+		gchar											*name;
+		gchar											*appID;
 
-	/* Get list of all applications from statistics hash table, iterate through
-	 * all applications and store them in key file.
-	 */
-	allAppIDs=g_hash_table_get_keys(_esdashboard_applications_search_provider_statistics.stats);
+		/* Get application desktop ID */
+		name=g_strdup_printf("%d", entriesCount);
+		appID=g_key_file_get_string(keyFile,
+									ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP,
+									name,
+									&error);
+		g_free(name);
+
+		if(error)
+		{
+			/* Propagate error */
+			g_propagate_error(outError, error);
 
-	g_key_file_set_integer(keyFile,
-							ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP,
-							ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_COUNT,
-							g_list_length(allAppIDs));
+			/* Release allocated resources */
+			if(appID) g_free(appID);
+			if(allAppIDs) g_list_free_full(allAppIDs, g_free);
+			if(keyFile) g_key_file_free(keyFile);
+
+			return(FALSE);
+		}
+
+		/* Store application desktop ID in list to iterate */
+		allAppIDs=g_list_prepend(allAppIDs, appID);
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Will load statistics for application '%s'",
+							appID);
+
+		/* Continue with next application in entries group */
+		entriesCount--;
+	}
 
-	entriesCount=0;
+	/* Iterate through all application desktop IDs and create statistics data
+	 * with default values for each one first. Then try to load stored values
+	 * from key file.
+	 */
 	for(iter=allAppIDs; iter; iter=g_list_next(iter))
 	{
-		gchar												*name;
 		const gchar											*appID;
 		EsdashboardApplicationsSearchProviderStatistics		*stats;
 
 		/* Get current iterated application desktop ID */
 		appID=(const gchar*)iter->data;
 
-		/* Get statistics data (it must exist because we got a list of all keys) */
-		stats=_esdashboard_applications_search_provider_statistics_get(appID);
-		g_assert(stats!=NULL);
+		/* Create statistics data for application with default values */
+		stats=_esdashboard_applications_search_provider_statistics_new(appID);
+		if(!stats)
+		{
+			g_critical("Could not create statistics data for application '%s' of applications search provider", appID);
+			continue;
+		}
+
+		/* Try to load stored values for application from key file */
+		if(g_key_file_has_key(keyFile, ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP, appID, NULL))
+		{
+			stats->usedCounter=g_key_file_get_integer(keyFile,
+														ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP,
+														appID,
+														&error);
+			if(error)
+			{
+				g_critical("Could not get value from group [%s] for application %s from statistics file of applications search provider: %s",
+							ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP,
+							appID,
+							error->message);
+				g_clear_error(&error);
+			}
+
+			if(stats->usedCounter>_esdashboard_applications_search_provider_statistics.maxUsedCounter)
+			{
+				_esdashboard_applications_search_provider_statistics.maxUsedCounter=stats->usedCounter;
+			}
+
+			/* Key file does not know when application was launched so assume now */
+			_esdashboard_applications_search_provider_statistics_estimate_frecency(stats, g_get_real_time()/G_USEC_PER_SEC);
+		}
+
+		/* Store statistics data for application in hash-table */
+		g_hash_table_insert(_esdashboard_applications_search_provider_statistics.stats, g_strdup(appID), _esdashboard_applications_search_provider_statistics_ref(stats));
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Loaded and stored statistics for '%s' for applications search provider",
+							appID);
+
+		/* Release allocated resources */
+		_esdashboard_applications_search_provider_statistics_unref(stats);
+	}
+
+	/* Release allocated resources */
+	if(allAppIDs) g_list_free_full(allAppIDs, g_free);
+	if(keyFile) g_key_file_free(keyFile);
+
+	/* If we get here loading statistics from key file was successful */
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Loaded statistics of applications search provider from %s",
+						inFilename);
+
+	return(TRUE);
+}
+
+/* Load statistics from binary statistics file by replaying all its records */
+static gboolean _esdashboard_applications_search_provider_load_statistics_from_file(EsdashboardApplicationsSearchProvider *self,
+																					const gchar *inFilename,
+																					GError **outError)
+{
+	GMappedFile												*mappedFile;
+	const gchar												*data;
+	gsize													dataLength;
+	gsize													offset;
+	guint32													version;
+	GError													*error;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), FALSE);
+	g_return_val_if_fail(inFilename && *inFilename, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	error=NULL;
+
+	/* Map statistics file into memory */
+	mappedFile=g_mapped_file_new(inFilename, FALSE, &error);
+	if(!mappedFile)
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
+
+		return(FALSE);
+	}
+
+	data=g_mapped_file_get_contents(mappedFile);
+	dataLength=g_mapped_file_get_length(mappedFile);
+
+	/* Check file header */
+	if(!data ||
+		dataLength<ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_HEADER_SIZE ||
+		memcmp(data, ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_MAGIC, ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_MAGIC_LENGTH)!=0)
+	{
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						G_IO_ERROR_INVALID_DATA,
+						"File %s is not a statistics file of applications search provider",
+						inFilename);
+
+		/* Release allocated resources */
+		g_mapped_file_unref(mappedFile);
+
+		return(FALSE);
+	}
+
+	memcpy(&version, data+ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_MAGIC_LENGTH, sizeof(version));
+	version=GUINT32_FROM_LE(version);
+	if(version!=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_VERSION)
+	{
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						G_IO_ERROR_NOT_SUPPORTED,
+						"Unsupported version %u of statistics file %s of applications search provider",
+						version,
+						inFilename);
+
+		/* Release allocated resources */
+		g_mapped_file_unref(mappedFile);
+
+		return(FALSE);
+	}
+
+	/* Replay all records in order. A snapshot record sets the statistics of
+	 * an application while a launch record adds to them.
+	 */
+	offset=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_HEADER_SIZE;
+	while(offset+ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_SIZE<=dataLength)
+	{
+		const gchar											*record;
+		guint8												type;
+		guint16												appIDLength;
+		guint32												count;
+		gint64												timestamp;
+		gchar												*appID;
+		EsdashboardApplicationsSearchProviderStatistics		*stats;
+
+		/* Decode record */
+		record=data+offset;
+		type=(guint8)record[0];
+
+		memcpy(&appIDLength, record+2, sizeof(appIDLength));
+		appIDLength=GUINT16_FROM_LE(appIDLength);
+
+		memcpy(&count, record+4, sizeof(count));
+		count=GUINT32_FROM_LE(count);
+
+		memcpy(&timestamp, record+8, sizeof(timestamp));
+		timestamp=GINT64_FROM_LE(timestamp);
+
+		/* Stop at a record truncated by an interrupted write */
+		if(appIDLength==0 ||
+			offset+ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_SIZE+appIDLength>dataLength)
+		{
+			break;
+		}
+
+		appID=g_strndup(record+ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_SIZE, appIDLength);
+		offset+=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_SIZE+appIDLength;
+
+		/* Get statistics data of application or create it with default values */
+		stats=_esdashboard_applications_search_provider_statistics_get(appID);
+		if(!stats)
+		{
+			stats=_esdashboard_applications_search_provider_statistics_new(appID);
+			if(!stats)
+			{
+				g_critical("Could not create statistics data for application '%s' of applications search provider", appID);
+				g_free(appID);
+				continue;
+			}
+
+			g_hash_table_insert(_esdashboard_applications_search_provider_statistics.stats, appID, stats);
+		}
+			else g_free(appID);
 
-		/* Store application desktop ID in "entries" overview group and increase counter */
-		entriesCount++;
+		/* Apply record to statistics data */
+		switch(type)
+		{
+			case ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_SNAPSHOT:
+				/* Estimate frecency in case no frecency record follows */
+				stats->usedCounter=count;
+				stats->lastUsed=timestamp;
+				_esdashboard_applications_search_provider_statistics_estimate_frecency(stats, timestamp);
+				break;
+
+			case ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_LAUNCH:
+				stats->usedCounter+=count;
+				stats->lastUsed=MAX(stats->lastUsed, timestamp);
+				_esdashboard_applications_search_provider_statistics_set_frecency(stats,
+																					_esdashboard_applications_search_provider_statistics_frecency_add(stats->frecencyLog,
+																																						log((gdouble)count)+_esdashboard_applications_search_provider_statistics_frecency_at(timestamp)));
+				_esdashboard_applications_search_provider_statistics.logRecordsCount++;
+				break;
+
+			case ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_RECORD_FRECENCY:
+			{
+				union
+				{
+					gdouble								frecency;
+					gint64								bits;
+				} value;
 
-		name=g_strdup_printf("%d", entriesCount);
-		g_key_file_set_string(keyFile,
-								ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP,
-								name,
-								appID);
-		g_free(name);
+				value.bits=timestamp;
+				if(!isnan(value.frecency))
+				{
+					_esdashboard_applications_search_provider_statistics_set_frecency(stats, value.frecency);
+				}
+				break;
+			}
 
-		/* Store statistics in key file in their groups but try to avoid to store
-		 * default values to keep key file small.
-		 */
-		if(stats->usedCounter>0)
+			default:
+				ESDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Skipping record of unknown type %u in statistics file %s",
+									type,
+									inFilename);
+				break;
+		}
+
+		if(stats->usedCounter>_esdashboard_applications_search_provider_statistics.maxUsedCounter)
 		{
-			g_key_file_set_integer(keyFile,
-									ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP,
-									appID,
-									stats->usedCounter);
+			_esdashboard_applications_search_provider_statistics.maxUsedCounter=stats->usedCounter;
 		}
 	}
 
-	/* Store key file for statistics in file */
-	keyFileData=g_key_file_to_data(keyFile, &keyFileLength, NULL);
-	if(!g_file_set_contents(_esdashboard_applications_search_provider_statistics.filename, keyFileData, keyFileLength, &error))
+	/* If statistics file ends with a truncated record, records appended later
+	 * would not be readable, so replace it with a snapshot in background.
+	 * Remember the length of its valid records to truncate it before appending
+	 * in case the compaction fails.
+	 */
+	if(offset<dataLength)
 	{
-		/* Propagate error */
-		g_propagate_error(outError, error);
-
-		/* Release allocated resources */
-		if(fileFolder) g_free(fileFolder);
-		if(keyFileData) g_free(keyFileData);
-		if(keyFile) g_key_file_free(keyFile);
-
-		return(FALSE);
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Statistics file %s ends with truncated record at offset %" G_GSIZE_FORMAT,
+							inFilename,
+							offset);
+		_esdashboard_applications_search_provider_statistics.logValidLength=offset;
 	}
 
+	_esdashboard_applications_search_provider_statistics_compact();
+
 	/* Release allocated resources */
-	if(fileFolder) g_free(fileFolder);
-	if(keyFileData) g_free(keyFileData);
-	if(keyFile) g_key_file_free(keyFile);
+	g_mapped_file_unref(mappedFile);
+
+	/* If we get here loading statistics file was successful */
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Loaded statistics for %u applications with %u records in log from %s",
+						g_hash_table_size(_esdashboard_applications_search_provider_statistics.stats),
+						_esdashboard_applications_search_provider_statistics.logRecordsCount,
+						inFilename);
 
-	/* If we get here saving statistics file was successful */
 	return(TRUE);
 }
 
@@ -338,10 +1237,8 @@ static gboolean _esdashboard_applications_search_provider_save_statistics(GError
 static gboolean _esdashboard_applications_search_provider_load_statistics(EsdashboardApplicationsSearchProvider *self,
 																			GError **outError)
 {
-	GKeyFile												*keyFile;
-	GList													*allAppIDs;
-	GList													*iter;
-	guint													entriesCount;
+	gchar													*keyFilename;
+	GBytes													*snapshot;
 	GError													*error;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), FALSE);
@@ -385,145 +1282,59 @@ static gboolean _esdashboard_applications_search_provider_load_statistics(Esdash
 						"Will load statistics of applications search provider from %s",
 						_esdashboard_applications_search_provider_statistics.filename);
 
-	/* If statistics file does not exist then return immediately but with success */
-	if(!g_file_test(_esdashboard_applications_search_provider_statistics.filename, G_FILE_TEST_EXISTS | G_FILE_TEST_IS_REGULAR))
+	/* If statistics file exists load it */
+	if(g_file_test(_esdashboard_applications_search_provider_statistics.filename, G_FILE_TEST_EXISTS | G_FILE_TEST_IS_REGULAR))
 	{
-		ESDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Statistics file %s does not exists. Will create empty statistics database for applications search provider",
-							_esdashboard_applications_search_provider_statistics.filename);
-
-		return(TRUE);
-	}
-
-	/* Load statistics from key file */
-	keyFile=g_key_file_new();
-	if(!g_key_file_load_from_file(keyFile, _esdashboard_applications_search_provider_statistics.filename, G_KEY_FILE_NONE, &error))
-	{
-		/* Propagate error */
-		g_propagate_error(outError, error);
-
-		/* Release allocated resources */
-		if(keyFile) g_key_file_free(keyFile);
-
-		return(FALSE);
-	}
-
-	/* Get number of applications and their application desktop IDs from key file */
-	entriesCount=g_key_file_get_integer(keyFile,
-										ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP,
-										ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_COUNT,
-										&error);
-	if(error)
-	{
-		/* Propagate error */
-		g_propagate_error(outError, error);
-
-		/* Release allocated resources */
-		if(keyFile) g_key_file_free(keyFile);
-
-		return(FALSE);
+		return(_esdashboard_applications_search_provider_load_statistics_from_file(self,
+																					_esdashboard_applications_search_provider_statistics.filename,
+																					outError));
 	}
-	ESDASHBOARD_DEBUG(self, APPLICATIONS,
-						"Will load statistics for %d applications",
-						entriesCount);
 
-	allAppIDs=NULL;
-	while(entriesCount>0)
+	/* Statistics file does not exist so convert key file of older versions
+	 * if available. The key file is kept to allow going back to an older
+	 * version.
+	 */
+	keyFilename=g_build_filename(g_get_user_data_dir(),
+									"esdashboard",
+									ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_KEYFILE,
+									NULL);
+	if(g_file_test(keyFilename, G_FILE_TEST_EXISTS | G_FILE_TEST_IS_REGULAR))
 	{
-		gchar											*name;
-		gchar											*appID;
-
-		/* Get application desktop ID */
-		name=g_strdup_printf("%d", entriesCount);
-		appID=g_key_file_get_string(keyFile,
-									ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP,
-									name,
-									&error);
-		g_free(name);
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Converting statistics of applications search provider from key file %s",
+							keyFilename);
 
-		if(error)
+		if(!_esdashboard_applications_search_provider_load_statistics_from_keyfile(self, keyFilename, outError))
 		{
-			/* Propagate error */
-			g_propagate_error(outError, error);
-
 			/* Release allocated resources */
-			if(appID) g_free(appID);
-			if(allAppIDs) g_list_free_full(allAppIDs, g_free);
-			if(keyFile) g_key_file_free(keyFile);
+			g_free(keyFilename);
 
 			return(FALSE);
 		}
-
-		/* Store application desktop ID in list to iterate */
-		allAppIDs=g_list_prepend(allAppIDs, appID);
-		ESDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Will load statistics for application '%s'",
-							appID);
-
-		/* Continue with next application in entries group */
-		entriesCount--;
 	}
-
-	/* Iterate through all application desktop IDs and create statistics data
-	 * with default values for each one first. Then try to load stored values
-	 * from key file.
-	 */
-	for(iter=allAppIDs; iter; iter=g_list_next(iter))
-	{
-		const gchar											*appID;
-		EsdashboardApplicationsSearchProviderStatistics		*stats;
-
-		/* Get current iterated application desktop ID */
-		appID=(const gchar*)iter->data;
-
-		/* Create statistics data for application with default values */
-		stats=_esdashboard_applications_search_provider_statistics_new();
-		if(!stats)
-		{
-			g_critical("Could not create statistics data for application '%s' of applications search provider", appID);
-			continue;
-		}
-
-		/* Try to load stored values for application from key file */
-		if(g_key_file_has_key(keyFile, ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP, appID, NULL))
+		else
 		{
-			stats->usedCounter=g_key_file_get_integer(keyFile,
-														ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP,
-														appID,
-														&error);
-			if(error)
-			{
-				g_critical("Could not get value from group [%s] for application %s from statistics file of applications search provider: %s",
-							ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP,
-							appID,
-							error->message);
-				g_clear_error(&error);
-			}
-
-			if(stats->usedCounter>_esdashboard_applications_search_provider_statistics.maxUsedCounter)
-			{
-				_esdashboard_applications_search_provider_statistics.maxUsedCounter=stats->usedCounter;
-			}
+			ESDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Statistics file %s does not exists. Will create empty statistics database for applications search provider",
+								_esdashboard_applications_search_provider_statistics.filename);
 		}
+	g_free(keyFilename);
 
-		/* Store statistics data for application in hash-table */
-		g_hash_table_insert(_esdashboard_applications_search_provider_statistics.stats, g_strdup(appID), _esdashboard_applications_search_provider_statistics_ref(stats));
-		ESDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Loaded and stored statistics for '%s' for applications search provider",
-							appID);
+	/* Create statistics file with snapshot of statistics loaded. If it could
+	 * not be written keep statistics in memory only.
+	 */
+	snapshot=_esdashboard_applications_search_provider_statistics_build_snapshot();
+	if(!_esdashboard_applications_search_provider_statistics_write_file(_esdashboard_applications_search_provider_statistics.filename, snapshot, &error))
+	{
+		g_warning("Could not create statistics file %s of applications search provider: %s",
+					_esdashboard_applications_search_provider_statistics.filename,
+					error ? error->message : "Unknown error");
+		if(error) g_clear_error(&error);
 
-		/* Release allocated resources */
-		_esdashboard_applications_search_provider_statistics_unref(stats);
+		g_free(_esdashboard_applications_search_provider_statistics.filename);
+		_esdashboard_applications_search_provider_statistics.filename=NULL;
 	}
-
-	/* Release allocated resources */
-	if(allAppIDs) g_list_free_full(allAppIDs, g_free);
-	if(keyFile) g_key_file_free(keyFile);
-
-	/* If we get here saving statistics file was successful */
-	ESDASHBOARD_DEBUG(self, APPLICATIONS,
-						"Loaded statistics of applications search provider from %s",
-						_esdashboard_applications_search_provider_statistics.filename);
+	g_bytes_unref(snapshot);
 
 	return(TRUE);
 }
@@ -532,9 +1343,6 @@ static gboolean _esdashboard_applications_search_provider_load_statistics(Esdash
 static void _esdashboard_applications_search_provider_destroy_statistics(void)
 {
 	EsdashboardApplication			*application;
-	GError							*error;
-
-	error=NULL;
 
 	/* Only existing statistics can be destroyed */
 	if(!_esdashboard_applications_search_provider_statistics.stats) return;
@@ -559,20 +1367,44 @@ static void _esdashboard_applications_search_provider_destroy_statistics(void)
 		_esdashboard_applications_search_provider_statistics.applicationLaunchedSignalID=0;
 	}
 
-	/* Save statistics to file */
-	if(!_esdashboard_applications_search_provider_save_statistics(&error))
+	/* All launches were appended to statistics file already except the ones
+	 * queued while compacting it. In this case cancel compaction and append
+	 * queued records to the statistics file. Either the compaction has already
+	 * replaced it with an equivalent snapshot or it will not touch it anymore.
+	 */
+	if(_esdashboard_applications_search_provider_statistics.compactCancellable)
 	{
-		g_critical("Failed to save statistics of applications search provider to %s: %s",
-					_esdashboard_applications_search_provider_statistics.filename,
-					error ? error->message : "Unknown error");
-		if(error) g_clear_error(&error);
+		GByteArray					*pendingRecords;
+
+		G_LOCK(_esdashboard_applications_search_provider_statistics_file_lock);
+
+		g_cancellable_cancel(_esdashboard_applications_search_provider_statistics.compactCancellable);
+		g_clear_object(&_esdashboard_applications_search_provider_statistics.compactCancellable);
+
+		pendingRecords=_esdashboard_applications_search_provider_statistics.pendingRecords;
+		if(pendingRecords->len>0)
+		{
+			_esdashboard_applications_search_provider_statistics_append(pendingRecords->data,
+																		pendingRecords->len,
+																		_esdashboard_applications_search_provider_statistics.pendingRecordsCount);
+		}
+
+		G_UNLOCK(_esdashboard_applications_search_provider_statistics_file_lock);
 	}
 
+	_esdashboard_applications_search_provider_statistics_close_log();
+
 	/* Destroy statistics */
 	ESDASHBOARD_DEBUG(NULL, APPLICATIONS, "Destroying statistics of applications search provider");
 	g_hash_table_destroy(_esdashboard_applications_search_provider_statistics.stats);
 	_esdashboard_applications_search_provider_statistics.stats=NULL;
 
+	g_sequence_free(_esdashboard_applications_search_provider_statistics.frecency);
+	_esdashboard_applications_search_provider_statistics.frecency=NULL;
+
+	g_byte_array_unref(_esdashboard_applications_search_provider_statistics.pendingRecords);
+	_esdashboard_applications_search_provider_statistics.pendingRecords=NULL;
+
 	/* Destroy filename for statistics */
 	if(_esdashboard_applications_search_provider_statistics.filename)
 	{
@@ -582,6 +1414,9 @@ static void _esdashboard_applications_search_provider_destroy_statistics(void)
 
 	/* Reset other variables */
 	_esdashboard_applications_search_provider_statistics.maxUsedCounter=0;
+	_esdashboard_applications_search_provider_statistics.logRecordsCount=0;
+	_esdashboard_applications_search_provider_statistics.logValidLength=0;
+	_esdashboard_applications_search_provider_statistics.pendingRecordsCount=0;
 
 	/* Unlock for thread-safety */
 	G_UNLOCK(_esdashboard_applications_search_provider_statistics_lock);
@@ -608,6 +1443,15 @@ static void _esdashboard_applications_search_provider_create_statistics(Esdashbo
 
 	/* Initialize non-critical variables */
 	_esdashboard_applications_search_provider_statistics.maxUsedCounter=0;
+	_esdashboard_applications_search_provider_statistics.logRecordsCount=0;
+	_esdashboard_applications_search_provider_statistics.logValidLength=0;
+	_esdashboard_applications_search_provider_statistics.pendingRecords=g_byte_array_new();
+	_esdashboard_applications_search_provider_statistics.pendingRecordsCount=0;
+
+	/* Create frecency order of statistics. It does not own the statistics
+	 * as they are removed from it when they are destroyed.
+	 */
+	_esdashboard_applications_search_provider_statistics.frecency=g_sequence_new(NULL);
 
 	/* Create hash-table for statistics */
 	_esdashboard_applications_search_provider_statistics.stats=
@@ -641,6 +1485,18 @@ static void _esdashboard_applications_search_provider_create_statistics(Esdashbo
 			_esdashboard_applications_search_provider_statistics.filename=NULL;
 		}
 
+		if(_esdashboard_applications_search_provider_statistics.pendingRecords)
+		{
+			g_byte_array_unref(_esdashboard_applications_search_provider_statistics.pendingRecords);
+			_esdashboard_applications_search_provider_statistics.pendingRecords=NULL;
+		}
+
+		if(_esdashboard_applications_search_provider_statistics.frecency)
+		{
+			g_sequence_free(_esdashboard_applications_search_provider_statistics.frecency);
+			_esdashboard_applications_search_provider_statistics.frecency=NULL;
+		}
+
 		/* Unlock for thread-safety */
 		G_UNLOCK(_esdashboard_applications_search_provider_statistics_lock);
 
@@ -660,59 +1516,312 @@ static void _esdashboard_applications_search_provider_create_statistics(Esdashbo
 							G_CALLBACK(_esdashboard_applications_search_provider_destroy_statistics),
 							NULL);
 
-	/* Connect to "application-launched" signal of application to track app launches */
-	_esdashboard_applications_search_provider_statistics.applicationLaunchedSignalID=
-		g_signal_connect(application,
-							"application-launched",
-							G_CALLBACK(_esdashboard_applications_search_provider_on_application_launched),
-							NULL);
+	/* Connect to "application-launched" signal of application to track app launches */
+	_esdashboard_applications_search_provider_statistics.applicationLaunchedSignalID=
+		g_signal_connect(application,
+							"application-launched",
+							G_CALLBACK(_esdashboard_applications_search_provider_on_application_launched),
+							NULL);
+
+	/* Unlock for thread-safety */
+	G_UNLOCK(_esdashboard_applications_search_provider_statistics_lock);
+}
+
+/* Create search entry for application. All case-folded strings needed to match
+ * search terms against this application are stored in one memory block right
+ * behind the entry structure, so matching needs no allocation at all and touches
+ * only a small contiguous piece of memory.
+ */
+static EsdashboardApplicationsSearchProviderEntry* _esdashboard_applications_search_provider_entry_new(GAppInfo *inAppInfo)
+{
+	EsdashboardApplicationsSearchProviderEntry		*entry;
+	const gchar										*desktopID;
+	const gchar										*value;
+	gchar											*title;
+	gchar											*description;
+	gchar											*command;
+	GList											*keywords;
+	GList											*iter;
+	gsize											desktopIDLength;
+	gsize											titleLength;
+	gsize											descriptionLength;
+	gsize											commandLength;
+	gsize											keywordsLength;
+	gsize											arenaSize;
+	gchar											*arena;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), NULL);
+
+	/* Get desktop ID of application which is also the key to lookup entry */
+	desktopID=g_app_info_get_id(inAppInfo);
+	if(!desktopID) return(NULL);
+
+	/* Get case-folded strings to store in entry */
+	value=g_app_info_get_display_name(inAppInfo);
+	if(value) title=g_utf8_strdown(value, -1);
+		else title=NULL;
+
+	value=g_app_info_get_description(inAppInfo);
+	if(value) description=g_utf8_strdown(value, -1);
+		else description=NULL;
+
+	value=g_app_info_get_executable(inAppInfo);
+	if(value) command=g_utf8_strdown(value, -1);
+		else command=NULL;
+
+	keywords=NULL;
+	keywordsLength=0;
+	for(iter=esdashboard_desktop_app_info_get_keywords(ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo)); iter; iter=g_list_next(iter))
+	{
+		gchar										*keyword;
+
+		/* Skip empty keywords as an empty string terminates list of keywords in entry */
+		if(!iter->data || !*((const gchar*)iter->data)) continue;
+
+		keyword=g_utf8_strdown(iter->data, -1);
+		keywordsLength+=strlen(keyword)+1;
+		keywords=g_list_prepend(keywords, keyword);
+	}
+	keywords=g_list_reverse(keywords);
+
+	/* Calculate size of memory needed for all strings */
+	desktopIDLength=strlen(desktopID)+1;
+	titleLength=(title ? strlen(title)+1 : 0);
+	descriptionLength=(description ? strlen(description)+1 : 0);
+	commandLength=(command ? strlen(command)+1 : 0);
+	if(keywordsLength>0) keywordsLength++;
+
+	arenaSize=desktopIDLength+titleLength+descriptionLength+commandLength+keywordsLength;
+
+	/* Allocate entry and its memory for all strings in one block */
+	entry=(EsdashboardApplicationsSearchProviderEntry*)g_malloc0(sizeof(EsdashboardApplicationsSearchProviderEntry)+arenaSize);
+	entry->appInfo=ESDASHBOARD_DESKTOP_APP_INFO(g_object_ref(inAppInfo));
+	entry->shouldShow=g_app_info_should_show(inAppInfo);
+
+	/* Copy strings into memory block behind entry */
+	arena=(gchar*)(entry+1);
+
+	entry->desktopID=arena;
+	memcpy(arena, desktopID, desktopIDLength);
+	arena+=desktopIDLength;
+
+	if(title)
+	{
+		entry->title=arena;
+		memcpy(arena, title, titleLength);
+		arena+=titleLength;
+	}
+
+	if(description)
+	{
+		entry->description=arena;
+		memcpy(arena, description, descriptionLength);
+		arena+=descriptionLength;
+	}
+
+	if(command)
+	{
+		entry->command=arena;
+		memcpy(arena, command, commandLength);
+		arena+=commandLength;
+	}
+
+	if(keywords)
+	{
+		entry->keywords=arena;
+		for(iter=keywords; iter; iter=g_list_next(iter))
+		{
+			gsize									length;
+
+			length=strlen((const gchar*)iter->data)+1;
+			memcpy(arena, iter->data, length);
+			arena+=length;
+		}
+
+		/* Terminate list of keywords with an empty string. The memory was
+		 * zero-initialized so just skip it.
+		 */
+		arena++;
+	}
+
+	/* Release allocated resources */
+	if(keywords) g_list_free_full(keywords, g_free);
+	if(command) g_free(command);
+	if(description) g_free(description);
+	if(title) g_free(title);
+
+	/* Return newly created search entry */
+	return(entry);
+}
+
+/* Free search entry of application */
+static void _esdashboard_applications_search_provider_entry_free(EsdashboardApplicationsSearchProviderEntry *inEntry)
+{
+	g_return_if_fail(inEntry);
+
+	/* Release allocated resources */
+	if(inEntry->appInfo)
+	{
+		if(inEntry->changedID) g_signal_handler_disconnect(inEntry->appInfo, inEntry->changedID);
+		g_object_unref(inEntry->appInfo);
+	}
+
+	/* Release entry which also releases all strings */
+	g_free(inEntry);
+}
+
+/* Forward declaration */
+static void _esdashboard_applications_search_provider_on_application_changed(EsdashboardApplicationsSearchProvider *self,
+																				gpointer inUserData);
+
+/* Create or replace search entry of application */
+static void _esdashboard_applications_search_provider_add_entry(EsdashboardApplicationsSearchProvider *self,
+																GAppInfo *inAppInfo)
+{
+	EsdashboardApplicationsSearchProviderPrivate	*priv;
+	EsdashboardApplicationsSearchProviderEntry		*entry;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
+	g_return_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo));
+
+	priv=self->priv;
+
+	/* Create new search entry for application */
+	entry=_esdashboard_applications_search_provider_entry_new(inAppInfo);
+	if(!entry) return;
+
+	/* Rebuild search entry if application changes */
+	entry->changedID=g_signal_connect_swapped(entry->appInfo,
+												"changed",
+												G_CALLBACK(_esdashboard_applications_search_provider_on_application_changed),
+												self);
 
-	/* Unlock for thread-safety */
-	G_UNLOCK(_esdashboard_applications_search_provider_statistics_lock);
+	/* Remove old entry first as its desktop ID is the key in hash-table and
+	 * is stored in the entry's memory which is released when removing it.
+	 */
+	g_mutex_lock(&priv->entriesLock);
+	g_hash_table_remove(priv->entries, entry->desktopID);
+	g_hash_table_insert(priv->entries, (gpointer)entry->desktopID, entry);
+	g_mutex_unlock(&priv->entriesLock);
 }
 
-/* An application was added to database */
-static void _esdashboard_applications_search_provider_on_application_added(EsdashboardApplicationsSearchProvider *self,
-																			GAppInfo *inAppInfo,
-																			gpointer inUserData)
+/* Create search entries for all applications in database */
+static void _esdashboard_applications_search_provider_create_entries(EsdashboardApplicationsSearchProvider *self)
 {
 	EsdashboardApplicationsSearchProviderPrivate	*priv;
+	GList											*allApps;
+	GList											*iter;
 
 	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
 
 	priv=self->priv;
 
-	/* Release current list of all installed applications */
-	if(priv->allApps)
+	/* Remove all existing entries */
+	g_mutex_lock(&priv->entriesLock);
+	g_hash_table_remove_all(priv->entries);
+	g_mutex_unlock(&priv->entriesLock);
+
+	/* Create entry for each installed application */
+	allApps=esdashboard_application_database_get_all_applications(priv->appDB);
+	for(iter=allApps; iter; iter=g_list_next(iter))
 	{
-		g_list_free_full(priv->allApps, g_object_unref);
-		priv->allApps=NULL;
+		_esdashboard_applications_search_provider_add_entry(self, G_APP_INFO(iter->data));
 	}
 
-	/* Get new list of all installed applications */
-	priv->allApps=esdashboard_application_database_get_all_applications(priv->appDB);
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Created search entries for %u applications",
+						g_hash_table_size(priv->entries));
+
+	/* Release allocated resources */
+	if(allApps) g_list_free_full(allApps, g_object_unref);
 }
 
-/* An application was removed to database */
-static void _esdashboard_applications_search_provider_on_application_removed(EsdashboardApplicationsSearchProvider *self,
-																				GAppInfo *inAppInfo,
+/* Get search entry for desktop ID. Search entries are only modified in main
+ * thread while holding the lock, so this function can be called without lock
+ * from main thread but must be called with lock held from other threads.
+ */
+static EsdashboardApplicationsSearchProviderEntry* _esdashboard_applications_search_provider_get_entry(EsdashboardApplicationsSearchProvider *self,
+																										const gchar *inDesktopID)
+{
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), NULL);
+	g_return_val_if_fail(inDesktopID, NULL);
+
+	return((EsdashboardApplicationsSearchProviderEntry*)g_hash_table_lookup(self->priv->entries, inDesktopID));
+}
+
+/* An application in database has changed */
+static void _esdashboard_applications_search_provider_on_application_changed(EsdashboardApplicationsSearchProvider *self,
+																				gpointer inUserData)
+{
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
+	g_return_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(inUserData));
+
+	/* Rebuild search entry of application. The previous result set may not
+	 * contain this application but it could match now, so the next search
+	 * must be a full one.
+	 */
+	_esdashboard_applications_search_provider_add_entry(self, G_APP_INFO(inUserData));
+
+	g_mutex_lock(&self->priv->entriesLock);
+	self->priv->allAppsChanged=TRUE;
+	g_mutex_unlock(&self->priv->entriesLock);
+}
+
+/* Applications were added to or removed from database */
+static void _esdashboard_applications_search_provider_on_applications_changed(EsdashboardApplicationsSearchProvider *self,
+																				GList *inAdded,
+																				GList *inRemoved,
+																				GList *inChanged,
 																				gpointer inUserData)
 {
 	EsdashboardApplicationsSearchProviderPrivate	*priv;
+	GList											*iter;
 
 	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
 
 	priv=self->priv;
 
-	/* Release current list of all installed applications */
-	if(priv->allApps)
+	/* Create search entries for new applications. Changed applications
+	 * rebuild their search entries when their 'changed' signal is emitted.
+	 */
+	for(iter=inAdded; iter; iter=g_list_next(iter))
+	{
+		_esdashboard_applications_search_provider_add_entry(self, G_APP_INFO(iter->data));
+	}
+
+	/* Remove search entries of applications removed. An incremental search
+	 * is still possible as it skips all items without a search entry. But
+	 * the previous result set does not know about new applications, so the
+	 * next search must be a full one.
+	 */
+	g_mutex_lock(&priv->entriesLock);
+	for(iter=inRemoved; iter; iter=g_list_next(iter))
 	{
-		g_list_free_full(priv->allApps, g_object_unref);
-		priv->allApps=NULL;
+		const gchar									*desktopID;
+
+		desktopID=g_app_info_get_id(G_APP_INFO(iter->data));
+		if(desktopID) g_hash_table_remove(priv->entries, desktopID);
 	}
+	if(inAdded) priv->allAppsChanged=TRUE;
+	g_mutex_unlock(&priv->entriesLock);
+}
+
+/* Application database was loaded or unloaded */
+static void _esdashboard_applications_search_provider_on_application_database_loaded(EsdashboardApplicationsSearchProvider *self,
+																						GParamSpec *inSpec,
+																						gpointer inUserData)
+{
+	EsdashboardApplicationsSearchProviderPrivate	*priv;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATION_DATABASE(inUserData));
 
-	/* Get new list of all installed applications */
-	priv->allApps=esdashboard_application_database_get_all_applications(priv->appDB);
+	priv=self->priv;
+
+	/* Remember state of application database for searches in worker threads */
+	g_mutex_lock(&priv->entriesLock);
+	priv->appDBLoaded=esdashboard_application_database_is_loaded(priv->appDB);
+	g_mutex_unlock(&priv->entriesLock);
 }
 
 /* User selected to open a new window or to launch that application at pop-up menu */
@@ -920,30 +2029,181 @@ static void _esdashboard_applications_search_provider_on_drag_end(ClutterDragAct
 	}
 }
 
-/* Check if given app info matches search terms and return score as fraction
- * between 0.0and 1.0 - so called "relevance". A negative score means that
- * the given app info does not match at all.
+/* Set up fuzzy pattern for a case-folded search term. Terms too short for a
+ * meaningful fuzzy match or too long to fit into one machine word will only
+ * be matched exactly.
+ */
+static void _esdashboard_applications_search_provider_fuzzy_pattern_init(EsdashboardApplicationsSearchProviderFuzzyPattern *ioPattern,
+																			const gchar *inTerm)
+{
+	glong												termLength;
+	guint												i;
+
+	g_return_if_fail(ioPattern);
+	g_return_if_fail(inTerm);
+
+	memset(ioPattern, 0, sizeof(EsdashboardApplicationsSearchProviderFuzzyPattern));
+
+	/* Check if term qualifies for fuzzy matching. The number of errors
+	 * allowed depends on the number of characters (not bytes) in term.
+	 */
+	ioPattern->length=strlen(inTerm);
+	if(ioPattern->length==0 || ioPattern->length>FUZZY_MAX_PATTERN_LENGTH) return;
+
+	termLength=g_utf8_strlen(inTerm, -1);
+	if(termLength<FUZZY_MIN_TERM_LENGTH) return;
+		else if(termLength<FUZZY_TWO_ERRORS_TERM_LENGTH) ioPattern->maxErrors=1;
+		else ioPattern->maxErrors=2;
+
+	/* Build bit masks of positions where each byte occurs in term */
+	for(i=0; i<ioPattern->length; i++)
+	{
+		ioPattern->peq[(guchar)inTerm[i]]|=(G_GUINT64_CONSTANT(1) << i);
+	}
+}
+
+/* Get lowest edit distance of fuzzy pattern to any prefix of text using the
+ * bit-parallel algorithm of Gene Myers. All columns of the dynamic programming
+ * matrix are computed at once in a single machine word so each byte of text
+ * costs only a handful of bit operations. Returns a distance greater than the
+ * maximum errors allowed if text does not match.
+ */
+static guint _esdashboard_applications_search_provider_fuzzy_prefix_distance(const EsdashboardApplicationsSearchProviderFuzzyPattern *inPattern,
+																				const guchar *inText)
+{
+	guint64												pv, mv;
+	guint64												eq, xv, xh, ph, mh;
+	guint64												lastBit;
+	guint												distance;
+	guint												bestDistance;
+	guint												maxTextLength;
+	guint												i;
+
+	/* Initialize vertical deltas. Only the lowest bits up to length of pattern
+	 * are relevant as carries are only propagated to higher bits.
+	 */
+	pv=G_MAXUINT64;
+	mv=0;
+	lastBit=(G_GUINT64_CONSTANT(1) << (inPattern->length-1));
+	distance=inPattern->length;
+	bestDistance=distance;
+
+	/* A prefix longer than pattern plus allowed errors cannot be matched
+	 * within these errors so stop there.
+	 */
+	maxTextLength=inPattern->length+inPattern->maxErrors;
+	for(i=0; i<maxTextLength && inText[i]; i++)
+	{
+		eq=inPattern->peq[inText[i]];
+		xv=eq | mv;
+		xh=(((eq & pv)+pv) ^ pv) | eq;
+		ph=mv | ~(xh | pv);
+		mh=pv & xh;
+
+		/* Update distance at last row of matrix */
+		if(ph & lastBit) distance++;
+			else if(mh & lastBit) distance--;
+
+		/* Matches are anchored at start of text so the horizontal delta
+		 * of first row is always one which is shifted in.
+		 */
+		ph=(ph << 1) | 1;
+		mh<<=1;
+		pv=mh | ~(xv | ph);
+		mv=ph & xv;
+
+		/* Remember lowest distance seen and stop early at an exact match */
+		if(distance<bestDistance)
+		{
+			bestDistance=distance;
+			if(bestDistance==0) break;
+		}
+	}
+
+	/* Return lowest distance found */
+	return(bestDistance);
+}
+
+/* Get lowest edit distance of fuzzy pattern to the beginning of any word in
+ * text. Matching only at word starts keeps short patterns with an error from
+ * matching nearly any text at an arbitrary position. A word starts at the
+ * beginning of text and after any ASCII character which is not alpha-numeric,
+ * e.g. spaces, dashes, dots or slashes.
+ */
+static guint _esdashboard_applications_search_provider_fuzzy_distance(const EsdashboardApplicationsSearchProviderFuzzyPattern *inPattern,
+																		const gchar *inText)
+{
+	guint												distance;
+	guint												bestDistance;
+	const guchar										*iter;
+	guchar												previous;
+
+	g_return_val_if_fail(inPattern, G_MAXUINT);
+	g_return_val_if_fail(inText, G_MAXUINT);
+
+	/* Check if pattern can be matched fuzzy at all */
+	if(inPattern->maxErrors==0) return(G_MAXUINT);
+
+	/* Match pattern at each word start and keep lowest distance */
+	bestDistance=G_MAXUINT;
+	previous=' ';
+	for(iter=(const guchar*)inText; *iter; iter++)
+	{
+		if(previous<0x80 && !g_ascii_isalnum(previous))
+		{
+			distance=_esdashboard_applications_search_provider_fuzzy_prefix_distance(inPattern, iter);
+			if(distance<bestDistance)
+			{
+				bestDistance=distance;
+				if(bestDistance==0) break;
+			}
+		}
+
+		previous=*iter;
+	}
+
+	/* Return lowest distance found */
+	return(bestDistance);
+}
+
+/* Get points for a fuzzy match of pattern against text. The weight of the
+ * field matched is reduced by the number of errors needed to match. Returns
+ * zero if text does not match within the allowed errors.
+ */
+static gfloat _esdashboard_applications_search_provider_fuzzy_points(const EsdashboardApplicationsSearchProviderFuzzyPattern *inPattern,
+																		const gchar *inText,
+																		gfloat inWeight)
+{
+	guint												distance;
+
+	if(!inText) return(0.0f);
+
+	distance=_esdashboard_applications_search_provider_fuzzy_distance(inPattern, inText);
+	if(distance>inPattern->maxErrors) return(0.0f);
+
+	return(inWeight/(distance+1));
+}
+
+/* Check if search entry of application matches search terms and return score
+ * as fraction between 0.0and 1.0 - so called "relevance". A negative score means
+ * that the given application does not match at all.
  */
 static gfloat _esdashboard_applications_search_provider_score(EsdashboardApplicationsSearchProvider *self,
 																gchar **inSearchTerms,
-																GAppInfo *inAppInfo)
+																const EsdashboardApplicationsSearchProviderFuzzyPattern *inFuzzyPatterns,
+																const EsdashboardApplicationsSearchProviderEntry *inEntry)
 {
 	EsdashboardApplicationsSearchProviderPrivate		*priv;
-	gchar												*title;
-	gchar												*description;
-	GList												*keywords;
-	const gchar											*command;
-	const gchar											*value;
 	gint												matchesFound, matchesExpected;
 	gfloat												pointsSearch;
+	gboolean											fuzzyMatch;
 	gfloat												score;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), -1.0f);
-	g_return_val_if_fail(G_IS_APP_INFO(inAppInfo), -1.0f);
+	g_return_val_if_fail(inEntry, -1.0f);
 
 	priv=self->priv;
 	score=-1.0f;
-	keywords=NULL;
 
 	/* Empty search term matches no menu item */
 	if(!inSearchTerms) return(0.0f);
@@ -966,35 +2226,24 @@ static gfloat _esdashboard_applications_search_provider_score(EsdashboardApplica
 	 * the total weight "points" by the number of search terms to get the average
 	 * which is also the result score when *not* taking the launch count of
 	 * application into account.
+	 *
+	 * All strings of search entry are already case-folded so they can be
+	 * matched against the lower-case search terms directly.
+	 *
+	 * If fuzzy patterns are given and a search term does not match exactly
+	 * then title, keywords and command are matched again allowing a few typos.
+	 * Such a fuzzy match gets only a fraction of the points of an exact one.
+	 * Furthermore the final score of an application needing any fuzzy match
+	 * is mapped to a range below the one of applications matching all search
+	 * terms exactly, so fuzzy hits are always ranked after exact ones.
 	 */
-	value=g_app_info_get_display_name(inAppInfo);
-	if(value) title=g_utf8_strdown(value, -1);
-		else title=NULL;
-
-	value=g_app_info_get_description(inAppInfo);
-	if(value) description=g_utf8_strdown(value, -1);
-		else description=NULL;
-
-	command=g_app_info_get_executable(inAppInfo);
-
-	if(ESDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo))
-	{
-		GList											*appKeywords;
-		GList											*iter;
-
-		appKeywords=esdashboard_desktop_app_info_get_keywords(ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo));
-		for(iter=appKeywords; iter; iter=g_list_next(iter))
-		{
-			keywords=g_list_prepend(keywords, g_utf8_strdown(iter->data, -1));
-		}
-	}
-
 	matchesFound=0;
 	pointsSearch=0.0f;
+	fuzzyMatch=FALSE;
 	while(*inSearchTerms)
 	{
 		gboolean										termMatch;
-		gchar											*commandPos;
+		const gchar										*commandPos;
 		gfloat											pointsTerm;
 
 		/* Reset "found" indicator and score of current search term */
@@ -1002,21 +2251,20 @@ static gfloat _esdashboard_applications_search_provider_score(EsdashboardApplica
 		pointsTerm=0.0f;
 
 		/* Check for current search term */
-		if(title &&
-			g_strstr_len(title, -1, *inSearchTerms))
+		if(inEntry->title &&
+			g_strstr_len(inEntry->title, -1, *inSearchTerms))
 		{
 			pointsTerm+=0.4;
 			termMatch=TRUE;
 		}
 
-		if(keywords)
+		if(inEntry->keywords)
 		{
-			GList						*iter;
+			const gchar					*keyword;
 
-			for(iter=keywords; iter; iter=g_list_next(iter))
+			for(keyword=inEntry->keywords; *keyword; keyword+=strlen(keyword)+1)
 			{
-				if(iter->data &&
-					g_strstr_len(iter->data, -1, *inSearchTerms))
+				if(g_strstr_len(keyword, -1, *inSearchTerms))
 				{
 					pointsTerm+=0.25;
 					termMatch=TRUE;
@@ -1025,24 +2273,54 @@ static gfloat _esdashboard_applications_search_provider_score(EsdashboardApplica
 			}
 		}
 
-		if(command)
+		if(inEntry->command)
 		{
-			commandPos=g_strstr_len(command, -1, *inSearchTerms);
+			commandPos=g_strstr_len(inEntry->command, -1, *inSearchTerms);
 			if(commandPos &&
-				(commandPos==command || *(commandPos-1)==G_DIR_SEPARATOR))
+				(commandPos==inEntry->command || *(commandPos-1)==G_DIR_SEPARATOR))
 			{
 				pointsTerm+=0.25;
 				termMatch=TRUE;
 			}
 		}
 
-		if(description &&
-			g_strstr_len(description, -1, *inSearchTerms))
+		if(inEntry->description &&
+			g_strstr_len(inEntry->description, -1, *inSearchTerms))
 		{
 			pointsTerm+=0.1;
 			termMatch=TRUE;
 		}
 
+		/* If search term does not match exactly try a fuzzy match */
+		if(!termMatch && inFuzzyPatterns && inFuzzyPatterns->maxErrors>0)
+		{
+			pointsTerm+=_esdashboard_applications_search_provider_fuzzy_points(inFuzzyPatterns, inEntry->title, 0.4);
+
+			if(inEntry->keywords)
+			{
+				const gchar					*keyword;
+				gfloat						pointsKeyword;
+
+				for(keyword=inEntry->keywords; *keyword; keyword+=strlen(keyword)+1)
+				{
+					pointsKeyword=_esdashboard_applications_search_provider_fuzzy_points(inFuzzyPatterns, keyword, 0.25);
+					if(pointsKeyword>0.0f)
+					{
+						pointsTerm+=pointsKeyword;
+						break;
+					}
+				}
+			}
+
+			pointsTerm+=_esdashboard_applications_search_provider_fuzzy_points(inFuzzyPatterns, inEntry->command, 0.25);
+
+			if(pointsTerm>0.0f)
+			{
+				termMatch=TRUE;
+				fuzzyMatch=TRUE;
+			}
+		}
+
 		/* Increase match counter if we found a match */
 		if(termMatch)
 		{
@@ -1052,6 +2330,7 @@ static gfloat _esdashboard_applications_search_provider_score(EsdashboardApplica
 
 		/* Continue with next search term */
 		inSearchTerms++;
+		if(inFuzzyPatterns) inFuzzyPatterns++;
 	}
 
 	/* If we got a match in either title, description or command for each search term
@@ -1082,10 +2361,35 @@ static gfloat _esdashboard_applications_search_provider_score(EsdashboardApplica
 		 */
 		if(priv->currentSortMode & ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_MOST_USED)
 		{
+			/* Lock for thread-safety as searches may run in worker threads */
+			G_LOCK(_esdashboard_applications_search_provider_statistics_lock);
+
 			maxPoints+=(_esdashboard_applications_search_provider_statistics.maxUsedCounter*1.0f);
 
-			stats=_esdashboard_applications_search_provider_statistics_get(g_app_info_get_id(inAppInfo));
+			stats=_esdashboard_applications_search_provider_statistics_get(inEntry->desktopID);
 			if(stats) currentPoints+=(stats->usedCounter*1.0f);
+
+			/* Unlock for thread-safety */
+			G_UNLOCK(_esdashboard_applications_search_provider_statistics_lock);
+		}
+
+		/* If frecency should be taken into calculation add the frecency of this
+		 * application relative to the highest frecency of any application. As
+		 * frecency decays with time an application launched very often long
+		 * ago does not outweigh the applications used recently.
+		 */
+		if(priv->currentSortMode & ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_FRECENCY)
+		{
+			/* Lock for thread-safety as searches may run in worker threads */
+			G_LOCK(_esdashboard_applications_search_provider_statistics_lock);
+
+			maxPoints+=1.0f;
+
+			stats=_esdashboard_applications_search_provider_statistics_get(inEntry->desktopID);
+			if(stats) currentPoints+=(gfloat)_esdashboard_applications_search_provider_statistics_get_relative_frecency(stats);
+
+			/* Unlock for thread-safety */
+			G_UNLOCK(_esdashboard_applications_search_provider_statistics_lock);
 		}
 
 		/* Calculate score but if maximum points is still zero we should do a simple
@@ -1093,12 +2397,16 @@ static gfloat _esdashboard_applications_search_provider_score(EsdashboardApplica
 		 */
 		if(maxPoints>0.0f) score=currentPoints/maxPoints;
 			else score=1.0f;
-	}
 
-	/* Release allocated resources */
-	if(keywords) g_list_free_full(keywords, g_free);
-	if(description) g_free(description);
-	if(title) g_free(title);
+		/* If fuzzy matching is enabled move score of fuzzy matches into lower
+		 * range and score of exact matches into the upper one.
+		 */
+		if(inFuzzyPatterns)
+		{
+			if(fuzzyMatch) score*=FUZZY_MAX_SCORE;
+				else score=FUZZY_EXACT_MIN_SCORE+(score*(1.0f-FUZZY_EXACT_MIN_SCORE));
+		}
+	}
 
 	/* Return score of this application for requested search terms */
 	return(score);
@@ -1110,54 +2418,42 @@ static gint _esdashboard_applications_search_provider_sort_result_set(GVariant *
 																		gpointer inUserData)
 {
 	EsdashboardApplicationsSearchProvider				*self;
-	EsdashboardApplicationsSearchProviderPrivate		*priv;
-	const gchar											*leftID;
-	const gchar											*rightID;
-	GAppInfo											*leftAppInfo;
-	GAppInfo											*rightAppInfo;
-	const gchar											*leftName;
-	const gchar											*rightName;
-	gchar												*lowerLeftName;
-	gchar												*lowerRightName;
-	gint												result;
+	EsdashboardApplicationsSearchProviderEntry			*leftEntry;
+	EsdashboardApplicationsSearchProviderEntry			*rightEntry;
 
 	g_return_val_if_fail(inLeft, 0);
 	g_return_val_if_fail(inRight, 0);
 	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(inUserData), 0);
 
 	self=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER(inUserData);
-	priv=self->priv;
 
-	/* Get desktop IDs of both items */
-	leftID=g_variant_get_string(inLeft, NULL);
-	rightID=g_variant_get_string(inRight, NULL);
+	/* Get search entries of both items */
+	leftEntry=_esdashboard_applications_search_provider_get_entry(self, g_variant_get_string(inLeft, NULL));
+	rightEntry=_esdashboard_applications_search_provider_get_entry(self, g_variant_get_string(inRight, NULL));
 
-	/* Get desktop application information of both items */
-	leftAppInfo=esdashboard_application_database_lookup_desktop_id(priv->appDB, leftID);
-	if(leftAppInfo) leftName=g_app_info_get_display_name(G_APP_INFO(leftAppInfo));
-		else leftName=NULL;
+	/* Return result of comparing the case-folded titles of both items */
+	return(g_strcmp0(leftEntry ? leftEntry->title : NULL, rightEntry ? rightEntry->title : NULL));
+}
 
-	rightAppInfo=esdashboard_application_database_lookup_desktop_id(priv->appDB, rightID);
-	if(rightAppInfo) rightName=g_app_info_get_display_name(G_APP_INFO(rightAppInfo));
-		else rightName=NULL;
+/* Notify about changed number of incremental searches in main loop */
+static gboolean _esdashboard_applications_search_provider_notify_incremental_search_count(gpointer inUserData)
+{
+	EsdashboardApplicationsSearchProvider				*self;
+	EsdashboardApplicationsSearchProviderPrivate		*priv;
 
-	/* Get result of comparing both desktop application information objects */
-	if(leftName) lowerLeftName=g_utf8_strdown(leftName, -1);
-		else lowerLeftName=NULL;
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(inUserData), G_SOURCE_REMOVE);
 
-	if(rightName) lowerRightName=g_utf8_strdown(rightName, -1);
-		else lowerRightName=NULL;
+	self=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER(inUserData);
+	priv=self->priv;
 
-	result=g_strcmp0(lowerLeftName, lowerRightName);
+	g_mutex_lock(&priv->entriesLock);
+	priv->incrementalSearchCountNotifyID=0;
+	g_mutex_unlock(&priv->entriesLock);
 
-	/* Release allocated resources */
-	if(rightAppInfo) g_object_unref(rightAppInfo);
-	if(leftAppInfo) g_object_unref(leftAppInfo);
-	if(lowerLeftName) g_free(lowerLeftName);
-	if(lowerRightName) g_free(lowerRightName);
+	g_object_notify_by_pspec(G_OBJECT(self), EsdashboardApplicationsSearchProviderProperties[PROP_INCREMENTAL_SEARCH_COUNT]);
 
-	/* Return result */
-	return(result);
+	/* Do not call this callback again */
+	return(G_SOURCE_REMOVE);
 }
 
 /* IMPLEMENTATION: EsdashboardSearchProvider */
@@ -1181,6 +2477,14 @@ static const gchar* _esdashboard_applications_search_provider_get_icon(Esdashboa
 	return("go-home");
 }
 
+/* This search provider only scores its search entries which are locked while
+ * searching, so it is thread-safe.
+ */
+static gboolean _esdashboard_applications_search_provider_is_thread_safe(EsdashboardSearchProvider *inProvider)
+{
+	return(TRUE);
+}
+
 /* Get result set for requested search terms */
 static EsdashboardSearchResultSet* _esdashboard_applications_search_provider_get_result_set(EsdashboardSearchProvider *inProvider,
 																							const gchar **inSearchTerms,
@@ -1192,17 +2496,15 @@ static EsdashboardSearchResultSet* _esdashboard_applications_search_provider_get
 	GList												*iter;
 	guint												numberTerms;
 	gchar												**terms, **termsIter;
-	EsdashboardDesktopAppInfo							*appInfo;
+	EsdashboardApplicationsSearchProviderEntry			*entry;
 	gfloat												score;
+	EsdashboardApplicationsSearchProviderFuzzyPattern	*fuzzyPatterns;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(inProvider), NULL);
 
 	self=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER(inProvider);
 	priv=self->priv;
 
-	/* Set new match mode */
-	priv->currentSortMode=priv->nextSortMode;
-
 	/* To perform case-insensitive searches through model convert all search terms
 	 * to lower-case before starting search.
 	 * Remember that string list must be NULL terminated.
@@ -1239,32 +2541,172 @@ static EsdashboardSearchResultSet* _esdashboard_applications_search_provider_get
 	/* Create empty result set to store matching result items */
 	resultSet=esdashboard_search_result_set_new();
 
-	/* Perform search */
-	for(iter=priv->allApps; iter; iter=g_list_next(iter))
+	/* Lock search entries for thread-safety as this search may run in a
+	 * worker thread while applications change in main thread. The sort mode
+	 * and state of application database are only changed with lock held, too.
+	 */
+	g_mutex_lock(&priv->entriesLock);
+
+	/* Stop here if search provider was disposed while this search was queued */
+	if(!priv->entries)
+	{
+		g_mutex_unlock(&priv->entriesLock);
+
+		/* Release allocated resources */
+		g_strfreev(terms);
+
+		return(resultSet);
+	}
+
+	/* Set new match mode */
+	priv->currentSortMode=priv->nextSortMode;
+
+	/* If fuzzy matching is enabled set up the fuzzy pattern of each search
+	 * term once for all applications to check.
+	 */
+	fuzzyPatterns=NULL;
+	if(priv->currentSortMode & ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_FUZZY)
 	{
-		/* Get app info to check for match */
-		appInfo=ESDASHBOARD_DESKTOP_APP_INFO(iter->data);
+		guint											i;
 
-		/* If desktop app info should be hidden then continue with next one */
-		if(!g_app_info_should_show(G_APP_INFO(appInfo)))
+		fuzzyPatterns=g_new(EsdashboardApplicationsSearchProviderFuzzyPattern, numberTerms);
+		for(i=0; i<numberTerms; i++)
 		{
-			continue;
+			_esdashboard_applications_search_provider_fuzzy_pattern_init(&fuzzyPatterns[i], terms[i]);
 		}
+	}
 
-		/* Check for a match against search terms */
-		score=_esdashboard_applications_search_provider_score(self, terms, G_APP_INFO(appInfo));
-		if(score>=0.0f)
-		{
-			GVariant									*resultItem;
+	/* Perform search. If a previous result set is given the search view has
+	 * determined that the current search terms are a refinement of the ones
+	 * used for previous result set. Each application not in previous result
+	 * set cannot match the refined search terms so only the items of previous
+	 * result set need to be checked. But if the list of installed applications
+	 * has changed since the last search a full search must be performed because
+	 * the previous result set does not know about the new applications.
+	 * Fuzzy matching always needs a full search as the number of errors
+	 * allowed grows with the length of search terms, so an application not
+	 * matching previous search terms may match the refined ones.
+	 */
+	if(inPreviousResultSet && !priv->allAppsChanged && !fuzzyPatterns)
+	{
+		GList											*previousItems;
 
-			/* Create result item */
-			resultItem=g_variant_new_string(g_app_info_get_id(G_APP_INFO(appInfo)));
+		/* Get all items of previous result set */
+		previousItems=esdashboard_search_result_set_get_all(inPreviousResultSet);
+
+		/* Check each application of previous result set for match */
+		for(iter=previousItems; iter; iter=g_list_next(iter))
+		{
+			GVariant									*previousItem;
+
+			/* Get search entry for result item of previous result set. If entry
+			 * could not be found the application was removed meanwhile so skip it.
+			 */
+			previousItem=(GVariant*)iter->data;
+			entry=_esdashboard_applications_search_provider_get_entry(self, g_variant_get_string(previousItem, NULL));
+			if(!entry || !entry->shouldShow) continue;
+
+			/* Check for a match against search terms */
+			score=_esdashboard_applications_search_provider_score(self, terms, fuzzyPatterns, entry);
+			if(score>=0.0f)
+			{
+				/* Add result item to result set */
+				esdashboard_search_result_set_add_item(resultSet, previousItem);
+				esdashboard_search_result_set_set_item_score(resultSet, previousItem, score);
+			}
+		}
 
-			/* Add result item to result set */
-			esdashboard_search_result_set_add_item(resultSet, resultItem);
-			esdashboard_search_result_set_set_item_score(resultSet, resultItem, score);
+		/* Count incremental searches performed but notify about property
+		 * change in main loop as this search may run in a worker thread.
+		 */
+		priv->incrementalSearchCount++;
+		if(!priv->incrementalSearchCountNotifyID)
+		{
+			priv->incrementalSearchCountNotifyID=g_idle_add_full(G_PRIORITY_DEFAULT_IDLE,
+																	_esdashboard_applications_search_provider_notify_incremental_search_count,
+																	g_object_ref(self),
+																	g_object_unref);
 		}
+
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Performed incremental search on %u of %u applications",
+							g_list_length(previousItems),
+							g_hash_table_size(priv->entries));
+
+		/* Release allocated resources */
+		if(previousItems) g_list_free_full(previousItems, (GDestroyNotify)g_variant_unref);
 	}
+		else
+		{
+			gboolean									useSearchIndex;
+			GList										*candidates;
+			GHashTableIter								entriesIter;
+
+			/* Ask application database for the applications which may match
+			 * the search terms by looking them up in its search index. If the
+			 * database is not loaded yet check all applications. The search
+			 * index only knows about exact substrings so it cannot be used
+			 * for fuzzy matching.
+			 */
+			candidates=NULL;
+			useSearchIndex=(!fuzzyPatterns && priv->appDBLoaded);
+			if(useSearchIndex)
+			{
+				candidates=esdashboard_application_database_get_search_candidates(priv->appDB, (const gchar**)terms);
+
+				ESDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Search index returned %u of %u applications as candidates",
+									g_list_length(candidates),
+									g_hash_table_size(priv->entries));
+
+				iter=candidates;
+			}
+				else g_hash_table_iter_init(&entriesIter, priv->entries);
+
+			while(TRUE)
+			{
+				/* Get next search entry to check either from list of candidates
+				 * or from all search entries.
+				 */
+				if(useSearchIndex)
+				{
+					if(!iter) break;
+
+					entry=_esdashboard_applications_search_provider_get_entry(self, (const gchar*)iter->data);
+					iter=g_list_next(iter);
+					if(!entry) continue;
+				}
+					else if(!g_hash_table_iter_next(&entriesIter, NULL, (gpointer*)&entry)) break;
+
+				/* If application should be hidden then continue with next one */
+				if(!entry->shouldShow) continue;
+
+				/* Check for a match against search terms */
+				score=_esdashboard_applications_search_provider_score(self, terms, fuzzyPatterns, entry);
+				if(score>=0.0f)
+				{
+					GVariant							*resultItem;
+
+					/* Create result item */
+					resultItem=g_variant_new_string(entry->desktopID);
+
+					/* Add result item to result set */
+					esdashboard_search_result_set_add_item(resultSet, resultItem);
+					esdashboard_search_result_set_set_item_score(resultSet, resultItem, score);
+				}
+			}
+
+			/* Release allocated resources */
+			if(candidates) g_list_free_full(candidates, g_free);
+
+			/* A full search was performed so the result set knows about all
+			 * installed applications.
+			 */
+			priv->allAppsChanged=FALSE;
+		}
+
+	/* Unlock search entries for thread-safety */
+	g_mutex_unlock(&priv->entriesLock);
 
 	/* Sort result set */
 	esdashboard_search_result_set_set_sort_func_full(resultSet,
@@ -1273,6 +2715,8 @@ static EsdashboardSearchResultSet* _esdashboard_applications_search_provider_get
 														g_object_unref);
 
 	/* Release allocated resources */
+	if(fuzzyPatterns) g_free(fuzzyPatterns);
+
 	if(terms)
 	{
 		termsIter=terms;
@@ -1337,6 +2781,38 @@ static ClutterActor* _esdashboard_applications_search_provider_create_result_act
 	return(actor);
 }
 
+/* Rebind actor created before to another result item */
+static gboolean _esdashboard_applications_search_provider_update_result_actor(EsdashboardSearchProvider *inProvider,
+																				GVariant *inResultItem,
+																				ClutterActor *inActor)
+{
+	EsdashboardApplicationsSearchProvider			*self;
+	EsdashboardApplicationsSearchProviderPrivate	*priv;
+	GAppInfo										*appInfo;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(inProvider), FALSE);
+	g_return_val_if_fail(inResultItem, FALSE);
+
+	self=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER(inProvider);
+	priv=self->priv;
+
+	/* Only application buttons created by this provider can be updated */
+	if(!ESDASHBOARD_IS_APPLICATION_BUTTON(inActor)) return(FALSE);
+
+	/* Get app info for result item */
+	appInfo=esdashboard_application_database_lookup_desktop_id(priv->appDB, g_variant_get_string(inResultItem, NULL));
+	if(!appInfo) appInfo=esdashboard_desktop_app_info_new_from_desktop_id(g_variant_get_string(inResultItem, NULL));
+	if(!appInfo) return(FALSE);
+
+	/* Set app info of new result item at actor */
+	esdashboard_application_button_set_app_info(ESDASHBOARD_APPLICATION_BUTTON(inActor), appInfo);
+
+	/* Release allocated resources */
+	g_object_unref(appInfo);
+
+	return(TRUE);
+}
+
 /* Activate result item */
 static gboolean _esdashboard_applications_search_provider_activate_result(EsdashboardSearchProvider* inProvider,
 																			GVariant *inResultItem,
@@ -1365,28 +2841,38 @@ static void _esdashboard_applications_search_provider_dispose(GObject *inObject)
 	/* Release allocated resouces */
 	if(priv->appDB)
 	{
-		if(priv->applicationAddedID)
+		if(priv->applicationsChangedID)
 		{
-			g_signal_handler_disconnect(priv->appDB, priv->applicationAddedID);
-			priv->applicationAddedID=0;
+			g_signal_handler_disconnect(priv->appDB, priv->applicationsChangedID);
+			priv->applicationsChangedID=0;
 		}
 
-		if(priv->applicationRemovedID)
+		if(priv->appDBLoadedID)
 		{
-			g_signal_handler_disconnect(priv->appDB, priv->applicationRemovedID);
-			priv->applicationRemovedID=0;
+			g_signal_handler_disconnect(priv->appDB, priv->appDBLoadedID);
+			priv->appDBLoadedID=0;
 		}
 
 		g_object_unref(priv->appDB);
 		priv->appDB=NULL;
 	}
 
-	if(priv->allApps)
+	g_mutex_lock(&priv->entriesLock);
+
+	if(priv->incrementalSearchCountNotifyID)
+	{
+		g_source_remove(priv->incrementalSearchCountNotifyID);
+		priv->incrementalSearchCountNotifyID=0;
+	}
+
+	if(priv->entries)
 	{
-		g_list_free_full(priv->allApps, g_object_unref);
-		priv->allApps=NULL;
+		g_hash_table_destroy(priv->entries);
+		priv->entries=NULL;
 	}
 
+	g_mutex_unlock(&priv->entriesLock);
+
 	if(priv->esconfSortModeBindingID)
 	{
 		esconf_g_property_unbind(priv->esconfSortModeBindingID);
@@ -1402,6 +2888,19 @@ static void _esdashboard_applications_search_provider_dispose(GObject *inObject)
 	G_OBJECT_CLASS(esdashboard_applications_search_provider_parent_class)->dispose(inObject);
 }
 
+/* Finalize this object */
+static void _esdashboard_applications_search_provider_finalize(GObject *inObject)
+{
+	EsdashboardApplicationsSearchProvider			*self=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER(inObject);
+	EsdashboardApplicationsSearchProviderPrivate	*priv=self->priv;
+
+	/* Release allocated resources */
+	g_mutex_clear(&priv->entriesLock);
+
+	/* Call parent's class finalize method */
+	G_OBJECT_CLASS(esdashboard_applications_search_provider_parent_class)->finalize(inObject);
+}
+
 /* Set/get properties */
 static void _esdashboard_applications_search_provider_set_property(GObject *inObject,
 																	guint inPropID,
@@ -1436,6 +2935,10 @@ static void _esdashboard_applications_search_provider_get_property(GObject *inOb
 			g_value_set_flags(outValue, priv->nextSortMode);
 			break;
 
+		case PROP_INCREMENTAL_SEARCH_COUNT:
+			g_value_set_uint(outValue, priv->incrementalSearchCount);
+			break;
+
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
 			break;
@@ -1453,14 +2956,17 @@ static void esdashboard_applications_search_provider_class_init(EsdashboardAppli
 
 	/* Override functions */
 	gobjectClass->dispose=_esdashboard_applications_search_provider_dispose;
+	gobjectClass->finalize=_esdashboard_applications_search_provider_finalize;
 	gobjectClass->set_property=_esdashboard_applications_search_provider_set_property;
 	gobjectClass->get_property=_esdashboard_applications_search_provider_get_property;
 
 	providerClass->initialize=_esdashboard_applications_search_provider_initialize;
 	providerClass->get_name=_esdashboard_applications_search_provider_get_name;
 	providerClass->get_icon=_esdashboard_applications_search_provider_get_icon;
+	providerClass->is_thread_safe=_esdashboard_applications_search_provider_is_thread_safe;
 	providerClass->get_result_set=_esdashboard_applications_search_provider_get_result_set;
 	providerClass->create_result_actor=_esdashboard_applications_search_provider_create_result_actor;
+	providerClass->update_result_actor=_esdashboard_applications_search_provider_update_result_actor;
 	providerClass->activate_result=_esdashboard_applications_search_provider_activate_result;
 
 	/* Define properties */
@@ -1472,6 +2978,14 @@ static void esdashboard_applications_search_provider_class_init(EsdashboardAppli
 							ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_NONE,
 							G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
 
+	EsdashboardApplicationsSearchProviderProperties[PROP_INCREMENTAL_SEARCH_COUNT]=
+		g_param_spec_uint("incremental-search-count",
+							"Incremental search count",
+							"Number of searches which were performed incrementally on previous result set",
+							0, G_MAXUINT,
+							0,
+							G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
 	g_object_class_install_properties(gobjectClass, PROP_LAST, EsdashboardApplicationsSearchProviderProperties);
 }
 
@@ -1488,20 +3002,30 @@ static void esdashboard_applications_search_provider_init(EsdashboardApplication
 	priv->esconfChannel=esdashboard_application_get_esconf_channel(NULL);
 	priv->currentSortMode=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_NONE;
 	priv->nextSortMode=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_NONE;
+	priv->allAppsChanged=FALSE;
+	priv->appDBLoaded=FALSE;
+	priv->incrementalSearchCount=0;
+	priv->incrementalSearchCountNotifyID=0;
+	g_mutex_init(&priv->entriesLock);
 
 	/* Get application database */
 	priv->appDB=esdashboard_application_database_get_default();
-	priv->applicationAddedID=g_signal_connect_swapped(priv->appDB,
-														"application-added",
-														G_CALLBACK(_esdashboard_applications_search_provider_on_application_added),
-														self);
-	priv->applicationRemovedID=g_signal_connect_swapped(priv->appDB,
-														"application-removed",
-														G_CALLBACK(_esdashboard_applications_search_provider_on_application_removed),
-														self);
-
-	/* Get list of all installed applications */
-	priv->allApps=esdashboard_application_database_get_all_applications(priv->appDB);
+	priv->applicationsChangedID=g_signal_connect_swapped(priv->appDB,
+															"applications-changed",
+															G_CALLBACK(_esdashboard_applications_search_provider_on_applications_changed),
+															self);
+	priv->appDBLoadedID=g_signal_connect_swapped(priv->appDB,
+													"notify::is-loaded",
+													G_CALLBACK(_esdashboard_applications_search_provider_on_application_database_loaded),
+													self);
+	priv->appDBLoaded=esdashboard_application_database_is_loaded(priv->appDB);
+
+	/* Create search entries for all installed applications */
+	priv->entries=g_hash_table_new_full(g_str_hash,
+											g_str_equal,
+											NULL,
+											(GDestroyNotify)_esdashboard_applications_search_provider_entry_free);
+	_esdashboard_applications_search_provider_create_entries(self);
 
 	/* Bind to esconf to react on changes */
 	priv->esconfSortModeBindingID=
@@ -1530,13 +3054,35 @@ void esdashboard_applications_search_provider_set_sort_mode(EsdashboardApplicati
 
 	priv=self->priv;
 
-	/* Set value if changed */
+	/* Set value if changed. Lock for thread-safety as it is read by searches
+	 * running in worker threads.
+	 */
 	if(priv->nextSortMode!=inMode)
 	{
 		/* Set value */
+		g_mutex_lock(&priv->entriesLock);
 		priv->nextSortMode=inMode;
+		g_mutex_unlock(&priv->entriesLock);
 
 		/* Notify about property change */
 		g_object_notify_by_pspec(G_OBJECT(self), EsdashboardApplicationsSearchProviderProperties[PROP_SORT_MODE]);
 	}
 }
+
+/* Get number of searches performed incrementally on previous result set */
+guint esdashboard_applications_search_provider_get_incremental_search_count(EsdashboardApplicationsSearchProvider *self)
+{
+	EsdashboardApplicationsSearchProviderPrivate	*priv;
+	guint											count;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), 0);
+
+	priv=self->priv;
+
+	/* Lock for thread-safety as it is counted by searches in worker threads */
+	g_mutex_lock(&priv->entriesLock);
+	count=priv->incrementalSearchCount;
+	g_mutex_unlock(&priv->entriesLock);
+
+	return(count);
+}
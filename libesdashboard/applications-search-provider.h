@@ -40,6 +40,8 @@ typedef enum /*< flags,prefix=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE
 
 	ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_NAMES=1 << 0,
 	ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_MOST_USED=1 << 1,
+	ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_FUZZY=1 << 2,
+	ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_FRECENCY=1 << 3,
 } EsdashboardApplicationsSearchProviderSortMode;
 
 
@@ -82,6 +84,8 @@ GType esdashboard_applications_search_provider_get_type(void) G_GNUC_CONST;
 EsdashboardApplicationsSearchProviderSortMode esdashboard_applications_search_provider_get_sort_mode(EsdashboardApplicationsSearchProvider *self);
 void esdashboard_applications_search_provider_set_sort_mode(EsdashboardApplicationsSearchProvider *self, const EsdashboardApplicationsSearchProviderSortMode inMode);
 
+guint esdashboard_applications_search_provider_get_incremental_search_count(EsdashboardApplicationsSearchProvider *self);
+
 G_END_DECLS
 
 #endif	/* __LIBESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER__ */
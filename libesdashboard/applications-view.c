@@ -72,6 +72,15 @@ struct _EsdashboardApplicationsViewPrivate
 
 	gpointer							selectedItem;
 
+	GHashTable							*menuElementActors;
+	ClutterActor						*parentMenuActor;
+	ClutterActor						*allAppsMenuActor;
+
+	GPtrArray							*allApps;
+	GHashTable							*allAppsActors;
+	GSList								*allAppsRecycledActors;
+	guint								allAppsUpdateID;
+
 	EsconfChannel						*esconfChannel;
 	gboolean							showAllAppsMenu;
 	guint								esconfShowAllAppsMenuBindingID;
@@ -104,6 +113,8 @@ static GParamSpec* EsdashboardApplicationsViewProperties[PROP_LAST]={ 0, };
 
 /* IMPLEMENTATION: Private variables and methods */
 #define ALL_APPLICATIONS_MENU_ICON		"applications-other"
+#define ALL_APPLICATIONS_INITIAL_ITEMS	40
+#define ALL_APPLICATIONS_OVERSCAN_ROWS	2
 #define SHOW_ALL_APPS_ESCONF_PROP		"/components/applications-view/show-all-apps"
 
 /* Forward declarations */
@@ -516,126 +527,804 @@ static gint _esdashboard_applications_view_on_all_applications_sort_app_info(Esd
 	return(0);
 }
 
-static void _esdashboard_applications_view_on_all_applications_menu_clicked(EsdashboardApplicationsView *self, gpointer inUserData)
+/* Release an actor of cache. If it is not a child of this view anymore
+ * it is not needed anymore and can be destroyed.
+ */
+static void _esdashboard_applications_view_release_cached_actor(gpointer inData)
+{
+	ClutterActor						*actor;
+
+	g_return_if_fail(CLUTTER_IS_ACTOR(inData));
+
+	actor=CLUTTER_ACTOR(inData);
+
+	if(!clutter_actor_get_parent(actor)) clutter_actor_destroy(actor);
+	g_object_unref(actor);
+}
+
+/* Create actor for an application shown in "All applications" menu */
+static ClutterActor* _esdashboard_applications_view_all_apps_create_actor(EsdashboardApplicationsView *self)
+{
+	ClutterActor						*actor;
+	ClutterAction						*clickAction;
+	ClutterAction						*dragAction;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+
+	/* Create actor. The application it shows is set when it gets realized */
+	actor=esdashboard_application_button_new();
+
+	g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_esdashboard_applications_view_on_item_clicked), self);
+
+	/* Set up and add pop-up menu click action */
+	clickAction=esdashboard_click_action_new();
+	g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_esdashboard_applications_view_on_popup_menu), self);
+	clutter_actor_add_action(actor, clickAction);
+
+	/* Add drag action to actor */
+	dragAction=esdashboard_drag_action_new_with_source(CLUTTER_ACTOR(self));
+	clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
+	clutter_actor_add_action(actor, dragAction);
+	g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_esdashboard_applications_view_on_drag_begin), self);
+	g_signal_connect(dragAction, "drag-end", G_CALLBACK(_esdashboard_applications_view_on_drag_end), self);
+
+	/* Adjust actor to current view mode */
+	_esdashboard_applications_view_setup_actor_for_view_mode(self, actor);
+
+	return(actor);
+}
+
+/* Create "parent menu" actor shown as first item in "All applications" menu */
+static ClutterActor* _esdashboard_applications_view_all_apps_create_parent_menu_actor(EsdashboardApplicationsView *self)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*actor;
+	gchar								*actorText;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+
+	priv=self->priv;
+
+	/* Create parent menu item */
+	actor=esdashboard_button_new();
+
+	if(priv->parentMenuIcon) esdashboard_label_set_icon_name(ESDASHBOARD_LABEL(actor), priv->parentMenuIcon);
+
+	if(priv->viewMode==ESDASHBOARD_VIEW_MODE_LIST) actorText=g_markup_printf_escaped(priv->formatTitleDescription, _("Back"), _("Go back to previous menu"));
+		else actorText=g_markup_printf_escaped(priv->formatTitleOnly, _("Back"));
+	esdashboard_label_set_text(ESDASHBOARD_LABEL(actor), actorText);
+	g_free(actorText);
+
+	g_signal_connect_swapped(actor,
+								"clicked",
+								G_CALLBACK(_esdashboard_applications_view_on_all_applications_menu_parent_menu_clicked),
+								self);
+
+	/* Adjust actor to current view mode */
+	_esdashboard_applications_view_setup_actor_for_view_mode(self, actor);
+
+	return(actor);
+}
+
+/* Get number of items in "All applications" menu including "parent menu" item */
+static gint _esdashboard_applications_view_all_apps_get_number_items(EsdashboardApplicationsView *self)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self), 0);
+
+	priv=self->priv;
+
+	if(!priv->allApps) return(0);
+	return(priv->allApps->len+1);
+}
+
+/* Determine geometry of items in "All applications" menu for given width. All
+ * items are expected to be of the same size so the largest natural size of all
+ * realized actors is used for every item. This way positions of all items can
+ * be computed without having an actor for each one.
+ */
+static void _esdashboard_applications_view_all_apps_get_layout_data(EsdashboardApplicationsView *self,
+																		gfloat inWidth,
+																		gint *outColumns,
+																		gfloat *outItemWidth,
+																		gfloat *outItemHeight,
+																		gfloat *outColumnSpacing,
+																		gfloat *outRowSpacing)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+	GHashTableIter						iter;
+	ClutterActor						*child;
+	gint								numberItems;
+	gint								columns;
+	gfloat								childWidth, childHeight;
+	gfloat								largestWidth, largestHeight;
+	gfloat								itemWidth;
+	gfloat								columnSpacing, rowSpacing;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+	numberItems=_esdashboard_applications_view_all_apps_get_number_items(self);
+
+	/* Determine largest natural width of all realized actors */
+	largestWidth=0.0f;
+	g_hash_table_iter_init(&iter, priv->allAppsActors);
+	while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&child))
+	{
+		clutter_actor_get_preferred_width(child, -1, NULL, &childWidth);
+		largestWidth=MAX(largestWidth, childWidth);
+	}
+
+	/* Determine number of columns and width of items */
+	if(priv->viewMode==ESDASHBOARD_VIEW_MODE_ICON)
+	{
+		columnSpacing=esdashboard_dynamic_table_layout_get_column_spacing(ESDASHBOARD_DYNAMIC_TABLE_LAYOUT(priv->layout));
+		rowSpacing=esdashboard_dynamic_table_layout_get_row_spacing(ESDASHBOARD_DYNAMIC_TABLE_LAYOUT(priv->layout));
+
+		if(inWidth<0.0f)
+		{
+			columns=numberItems;
+			itemWidth=largestWidth;
+		}
+			else
+			{
+				columns=esdashboard_dynamic_table_layout_compute_columns(ESDASHBOARD_DYNAMIC_TABLE_LAYOUT(priv->layout),
+																			numberItems,
+																			inWidth,
+																			largestWidth,
+																			&itemWidth);
+			}
+	}
+		else
+		{
+			columnSpacing=0.0f;
+			rowSpacing=priv->spacing;
+			columns=(numberItems>0 ? 1 : 0);
+			itemWidth=(inWidth<0.0f ? largestWidth : inWidth);
+		}
+
+	/* Determine largest natural height of all realized actors at item width */
+	largestHeight=0.0f;
+	g_hash_table_iter_init(&iter, priv->allAppsActors);
+	while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&child))
+	{
+		clutter_actor_get_preferred_height(child, itemWidth, NULL, &childHeight);
+		largestHeight=MAX(largestHeight, childHeight);
+	}
+
+	/* Store result */
+	if(outColumns) *outColumns=columns;
+	if(outItemWidth) *outItemWidth=itemWidth;
+	if(outItemHeight) *outItemHeight=largestHeight;
+	if(outColumnSpacing) *outColumnSpacing=columnSpacing;
+	if(outRowSpacing) *outRowSpacing=rowSpacing;
+}
+
+/* Get index of item in "All applications" menu a realized actor shows */
+static gint _esdashboard_applications_view_all_apps_get_index_for_actor(EsdashboardApplicationsView *self,
+																		ClutterActor *inActor)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+	GHashTableIter						iter;
+	gpointer							key;
+	gpointer							value;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self), -1);
+
+	priv=self->priv;
+
+	if(!priv->allApps) return(-1);
+
+	g_hash_table_iter_init(&iter, priv->allAppsActors);
+	while(g_hash_table_iter_next(&iter, &key, &value))
+	{
+		if(value==(gpointer)inActor) return(GPOINTER_TO_INT(key));
+	}
+
+	return(-1);
+}
+
+/* Get actor for item in "All applications" menu and realize it if needed by
+ * reusing an actor not needed anymore or by creating a new one.
+ */
+static ClutterActor* _esdashboard_applications_view_all_apps_realize(EsdashboardApplicationsView *self, gint inIndex)
 {
 	EsdashboardApplicationsViewPrivate	*priv;
 	ClutterActor						*actor;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(inIndex>=0 && inIndex<_esdashboard_applications_view_all_apps_get_number_items(self), NULL);
+
+	priv=self->priv;
+
+	/* Check if item is realized already */
+	actor=CLUTTER_ACTOR(g_hash_table_lookup(priv->allAppsActors, GINT_TO_POINTER(inIndex)));
+	if(actor) return(actor);
+
+	/* First item is always the "parent menu" item */
+	if(inIndex==0)
+	{
+		actor=_esdashboard_applications_view_all_apps_create_parent_menu_actor(self);
+	}
+		else
+		{
+			/* Reuse an actor not needed anymore if available otherwise create one */
+			if(priv->allAppsRecycledActors)
+			{
+				actor=CLUTTER_ACTOR(priv->allAppsRecycledActors->data);
+				priv->allAppsRecycledActors=g_slist_delete_link(priv->allAppsRecycledActors, priv->allAppsRecycledActors);
+			}
+				else
+				{
+					actor=g_object_ref_sink(_esdashboard_applications_view_all_apps_create_actor(self));
+				}
+
+			esdashboard_application_button_set_app_info(ESDASHBOARD_APPLICATION_BUTTON(actor),
+														G_APP_INFO(g_ptr_array_index(priv->allApps, inIndex-1)));
+		}
+
+	/* Add to view */
+	clutter_actor_add_child(CLUTTER_ACTOR(self), actor);
+	clutter_actor_show(actor);
+	g_hash_table_insert(priv->allAppsActors, GINT_TO_POINTER(inIndex), actor);
+
+	/* The view took the reference of recycled or newly created actor */
+	if(inIndex>0) g_object_unref(actor);
+
+	return(actor);
+}
+
+/* Remove realized actor of item in "All applications" menu from view and
+ * keep it for reuse.
+ */
+static void _esdashboard_applications_view_all_apps_unrealize(EsdashboardApplicationsView *self, gint inIndex)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*actor;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self));
+	g_return_if_fail(inIndex>0);
+
+	priv=self->priv;
+
+	actor=CLUTTER_ACTOR(g_hash_table_lookup(priv->allAppsActors, GINT_TO_POINTER(inIndex)));
+	if(!actor) return;
+
+	g_hash_table_remove(priv->allAppsActors, GINT_TO_POINTER(inIndex));
+
+	g_object_ref(actor);
+	clutter_actor_remove_child(CLUTTER_ACTOR(self), actor);
+	priv->allAppsRecycledActors=g_slist_prepend(priv->allAppsRecycledActors, actor);
+}
+
+/* Realize actors of items in "All applications" menu intersecting the visible
+ * part of view (plus some rows before and after it) and unrealize all others.
+ */
+static void _esdashboard_applications_view_all_apps_update(EsdashboardApplicationsView *self)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+	gint								numberItems;
+	gint								columns;
+	gfloat								itemHeight;
+	gfloat								rowSpacing;
+	gfloat								viewY, viewHeight;
+	gint								firstRow, lastRow;
+	gint								firstIndex, lastIndex;
+	gint								index;
+	GHashTableIter						iter;
+	gpointer							key;
+	gpointer							value;
+	GList								*unneeded;
+	GList								*listIter;
+	gboolean							changed;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	if(!priv->allApps) return;
+
+	/* Get geometry of items. If no item could be measured yet keep the
+	 * initially realized ones.
+	 */
+	_esdashboard_applications_view_all_apps_get_layout_data(self,
+																clutter_actor_get_width(CLUTTER_ACTOR(self)),
+																&columns,
+																NULL,
+																&itemHeight,
+																NULL,
+																&rowSpacing);
+	if(columns<=0 || itemHeight<=0.0f) return;
+
+	/* Get visible part of view. The viewpad scrolls this view by its clipping */
+	if(clutter_actor_has_clip(CLUTTER_ACTOR(self)))
+	{
+		clutter_actor_get_clip(CLUTTER_ACTOR(self), NULL, &viewY, NULL, &viewHeight);
+	}
+		else
+		{
+			viewY=0.0f;
+			viewHeight=clutter_actor_get_height(CLUTTER_ACTOR(self));
+		}
+
+	/* Determine range of items to realize */
+	numberItems=_esdashboard_applications_view_all_apps_get_number_items(self);
+
+	firstRow=MAX(0, (gint)floor(viewY/(itemHeight+rowSpacing))-ALL_APPLICATIONS_OVERSCAN_ROWS);
+	lastRow=(gint)floor((viewY+viewHeight)/(itemHeight+rowSpacing))+ALL_APPLICATIONS_OVERSCAN_ROWS;
+
+	firstIndex=MIN(firstRow*columns, numberItems);
+	lastIndex=MIN((lastRow+1)*columns, numberItems);
+
+	/* Unrealize all actors outside of range except the "parent menu" item
+	 * and the current selection.
+	 */
+	unneeded=NULL;
+	g_hash_table_iter_init(&iter, priv->allAppsActors);
+	while(g_hash_table_iter_next(&iter, &key, &value))
+	{
+		index=GPOINTER_TO_INT(key);
+
+		if(index>0 &&
+			(index<firstIndex || index>=lastIndex) &&
+			value!=priv->selectedItem)
+		{
+			unneeded=g_list_prepend(unneeded, key);
+		}
+	}
+
+	changed=(unneeded!=NULL);
+	for(listIter=unneeded; listIter; listIter=g_list_next(listIter))
+	{
+		_esdashboard_applications_view_all_apps_unrealize(self, GPOINTER_TO_INT(listIter->data));
+	}
+	g_list_free(unneeded);
+
+	/* Realize all missing actors in range */
+	for(index=firstIndex; index<lastIndex; index++)
+	{
+		if(!g_hash_table_contains(priv->allAppsActors, GINT_TO_POINTER(index)))
+		{
+			_esdashboard_applications_view_all_apps_realize(self, index);
+			changed=TRUE;
+		}
+	}
+
+	if(changed)
+	{
+		ESDASHBOARD_DEBUG(self, ACTOR,
+							"Realized %u of %d items in range %d-%d with %u actors kept for reuse",
+							g_hash_table_size(priv->allAppsActors),
+							numberItems,
+							firstIndex,
+							lastIndex,
+							g_slist_length(priv->allAppsRecycledActors));
+
+		clutter_actor_queue_relayout(CLUTTER_ACTOR(self));
+	}
+}
+
+/* Update realized actors of "All applications" menu before next frame is painted */
+static gboolean _esdashboard_applications_view_all_apps_on_update_repaint(gpointer inUserData)
+{
+	EsdashboardApplicationsView			*self;
+	EsdashboardApplicationsViewPrivate	*priv;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(inUserData), G_SOURCE_REMOVE);
+
+	self=ESDASHBOARD_APPLICATIONS_VIEW(inUserData);
+	priv=self->priv;
+
+	/* Update realized actors */
+	_esdashboard_applications_view_all_apps_update(self);
+
+	/* Do not call this callback again */
+	priv->allAppsUpdateID=0;
+	return(G_SOURCE_REMOVE);
+}
+
+/* Queue update of realized actors of "All applications" menu if shown. The
+ * update is deferred as actors must not be added or removed while allocating.
+ */
+static void _esdashboard_applications_view_all_apps_queue_update(EsdashboardApplicationsView *self)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	if(priv->allApps &&
+		priv->allAppsUpdateID==0)
+	{
+		priv->allAppsUpdateID=
+			clutter_threads_add_repaint_func_full(CLUTTER_REPAINT_FLAGS_QUEUE_REDRAW_ON_ADD | CLUTTER_REPAINT_FLAGS_PRE_PAINT,
+													_esdashboard_applications_view_all_apps_on_update_repaint,
+													self,
+													NULL);
+	}
+}
+
+/* Visible part of view changed as viewpad scrolls this view by its clipping */
+static void _esdashboard_applications_view_on_clip_changed(GObject *inObject,
+															GParamSpec *inSpec,
+															gpointer inUserData)
+{
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(inObject));
+
+	_esdashboard_applications_view_all_apps_queue_update(ESDASHBOARD_APPLICATIONS_VIEW(inObject));
+}
+
+/* Size of view changed */
+static void _esdashboard_applications_view_on_allocation_changed(ClutterActor *inActor,
+																	ClutterActorBox *inBox,
+																	ClutterAllocationFlags inFlags,
+																	gpointer inUserData)
+{
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(inActor));
+
+	_esdashboard_applications_view_all_apps_queue_update(ESDASHBOARD_APPLICATIONS_VIEW(inActor));
+}
+
+/* Ensure that item in "All applications" menu is visible by scrolling if needed.
+ * A newly realized actor has no allocation yet so the position is computed.
+ */
+static void _esdashboard_applications_view_all_apps_ensure_visible(EsdashboardApplicationsView *self, gint inIndex)
+{
+	gint								columns;
+	gfloat								itemHeight;
+	gfloat								rowSpacing;
+	gfloat								viewY, viewHeight;
+	gfloat								itemY;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self));
+	g_return_if_fail(inIndex>=0);
+
+	if(!clutter_actor_has_clip(CLUTTER_ACTOR(self))) return;
+
+	_esdashboard_applications_view_all_apps_get_layout_data(self,
+																clutter_actor_get_width(CLUTTER_ACTOR(self)),
+																&columns,
+																NULL,
+																&itemHeight,
+																NULL,
+																&rowSpacing);
+	if(columns<=0) return;
+
+	clutter_actor_get_clip(CLUTTER_ACTOR(self), NULL, &viewY, NULL, &viewHeight);
+
+	itemY=(inIndex/columns)*(itemHeight+rowSpacing);
+	if(itemY<viewY) esdashboard_view_scroll_to(ESDASHBOARD_VIEW(self), -1, itemY);
+		else if(itemY+itemHeight>viewY+viewHeight) esdashboard_view_scroll_to(ESDASHBOARD_VIEW(self), -1, itemY+itemHeight-viewHeight);
+}
+
+/* Leave "All applications" menu and release all actors and data of it */
+static void _esdashboard_applications_view_all_apps_clear(EsdashboardApplicationsView *self)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+	GHashTableIter						iter;
+	ClutterActor						*actor;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	if(priv->allAppsUpdateID)
+	{
+		clutter_threads_remove_repaint_func(priv->allAppsUpdateID);
+		priv->allAppsUpdateID=0;
+	}
+
+	if(priv->allAppsActors)
+	{
+		g_hash_table_iter_init(&iter, priv->allAppsActors);
+		while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&actor))
+		{
+			clutter_actor_destroy(actor);
+		}
+		g_hash_table_remove_all(priv->allAppsActors);
+	}
+
+	if(priv->allAppsRecycledActors)
+	{
+		g_slist_free_full(priv->allAppsRecycledActors, _esdashboard_applications_view_release_cached_actor);
+		priv->allAppsRecycledActors=NULL;
+	}
+
+	if(priv->allApps)
+	{
+		g_ptr_array_unref(priv->allApps);
+		priv->allApps=NULL;
+	}
+}
+
+/* Show sub-menu with all installed applications. As there could be a huge number
+ * of installed applications only actors for the visible ones are realized.
+ */
+static void _esdashboard_applications_view_on_all_applications_menu_clicked(EsdashboardApplicationsView *self, gpointer inUserData)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
 	GList								*allApps;
 	GList								*iter;
 	EsdashboardDesktopAppInfo			*appInfo;
 	EsdashboardApplicationDatabase		*appDB;
+	gint								numberItems;
+	gint								i;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	/* Remove all children. Cached actors of menu elements are kept alive
+	 * by cache to reuse them when returning to menu.
+	 */
+	esdashboard_focusable_set_selection(ESDASHBOARD_FOCUSABLE(self), NULL);
+	_esdashboard_applications_view_all_apps_clear(self);
+	clutter_actor_remove_all_children(CLUTTER_ACTOR(self));
+
+	/* Collect all installed applications which should be shown */
+	appDB=esdashboard_application_database_get_default();
+
+	allApps=esdashboard_application_database_get_all_applications(appDB);
+	allApps=g_list_sort(allApps, (GCompareFunc)_esdashboard_applications_view_on_all_applications_sort_app_info);
+
+	priv->allApps=g_ptr_array_new_with_free_func(g_object_unref);
+	for(iter=allApps; iter; iter=g_list_next(iter))
+	{
+		/* Get app info of application currently iterated */
+		appInfo=ESDASHBOARD_DESKTOP_APP_INFO(iter->data);
+
+		/* If desktop app info should be hidden then continue with next one */
+		if(!g_app_info_should_show(G_APP_INFO(appInfo)))
+		{
+			continue;
+		}
+
+		g_ptr_array_add(priv->allApps, g_object_ref(appInfo));
+	}
+
+	/* Realize "parent menu" item and an initial number of items. The visible
+	 * ones are realized as soon as the size of items is known.
+	 */
+	numberItems=_esdashboard_applications_view_all_apps_get_number_items(self);
+	for(i=0; i<MIN(numberItems, ALL_APPLICATIONS_INITIAL_ITEMS); i++)
+	{
+		_esdashboard_applications_view_all_apps_realize(self, i);
+	}
+	clutter_layout_manager_layout_changed(priv->layout);
+
+	/* Select "parent menu" automatically */
+	if(esdashboard_view_has_focus(ESDASHBOARD_VIEW(self)))
+	{
+		esdashboard_focusable_set_selection(ESDASHBOARD_FOCUSABLE(self),
+											_esdashboard_applications_view_all_apps_realize(self, 0));
+	}
+
+	/* Release allocated resources */
+	g_list_free_full(allApps, g_object_unref);
+	g_object_unref(appDB);
+}
+
+/* Clear cache of actors created for menu elements, e.g. because the menu
+ * was reloaded or the appearance of actors has changed.
+ */
+static void _esdashboard_applications_view_clear_actor_cache(EsdashboardApplicationsView *self)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+
+	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	if(priv->menuElementActors)
+	{
+		g_hash_table_remove_all(priv->menuElementActors);
+	}
+
+	if(priv->parentMenuActor)
+	{
+		_esdashboard_applications_view_release_cached_actor(priv->parentMenuActor);
+		priv->parentMenuActor=NULL;
+	}
+
+	if(priv->allAppsMenuActor)
+	{
+		_esdashboard_applications_view_release_cached_actor(priv->allAppsMenuActor);
+		priv->allAppsMenuActor=NULL;
+	}
+}
+
+/* Create actor for menu element. Support drag'n'drop at actor if menu element
+ * is a menu item.
+ */
+static ClutterActor* _esdashboard_applications_view_create_actor_for_menu_element(EsdashboardApplicationsView *self,
+																					MarkonMenuElement *inMenuElement)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*actor;
 	ClutterAction						*clickAction;
 	ClutterAction						*dragAction;
+	GAppInfo							*appInfo;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(MARKON_IS_MENU_ELEMENT(inMenuElement), NULL);
+
+	priv=self->priv;
+
+	if(MARKON_IS_MENU_ITEM(inMenuElement))
+	{
+		appInfo=esdashboard_desktop_app_info_new_from_menu_item(MARKON_MENU_ITEM(inMenuElement));
+		actor=esdashboard_application_button_new_from_app_info(appInfo);
+		g_object_unref(appInfo);
+
+		g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_esdashboard_applications_view_on_item_clicked), self);
+
+		/* Set up and add pop-up menu click action and drag action */
+		clickAction=esdashboard_click_action_new();
+		g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_esdashboard_applications_view_on_popup_menu), self);
+		clutter_actor_add_action(actor, clickAction);
+
+		dragAction=esdashboard_drag_action_new_with_source(CLUTTER_ACTOR(self));
+		clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
+		clutter_actor_add_action(actor, dragAction);
+		g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_esdashboard_applications_view_on_drag_begin), self);
+		g_signal_connect(dragAction, "drag-end", G_CALLBACK(_esdashboard_applications_view_on_drag_end), self);
+	}
+		else
+		{
+			gchar		*actorText;
+			const gchar	*iconName;
+			const gchar	*title;
+			const gchar	*description;
+
+			actor=esdashboard_button_new();
+
+			iconName=markon_menu_element_get_icon_name(inMenuElement);
+			if(iconName) esdashboard_label_set_icon_name(ESDASHBOARD_LABEL(actor), iconName);
+
+			title=markon_menu_element_get_name(inMenuElement);
+			description=markon_menu_element_get_comment(inMenuElement);
+
+			if(priv->viewMode==ESDASHBOARD_VIEW_MODE_LIST)
+			{
+				actorText=g_markup_printf_escaped(priv->formatTitleDescription,
+													title ? title : "",
+													description ? description : "");
+			}
+				else
+				{
+					actorText=g_markup_printf_escaped(priv->formatTitleOnly,
+														title ? title : "");
+				}
+			esdashboard_label_set_text(ESDASHBOARD_LABEL(actor), actorText);
+			g_free(actorText);
+
+			g_signal_connect(actor, "clicked", G_CALLBACK(_esdashboard_applications_view_on_menu_clicked), inMenuElement);
+		}
+
+	/* Adjust actor to current view mode */
+	_esdashboard_applications_view_setup_actor_for_view_mode(self, actor);
+
+	return(actor);
+}
+
+/* Get actor for menu element from cache or create and cache it if missing */
+static ClutterActor* _esdashboard_applications_view_get_actor_for_menu_element(EsdashboardApplicationsView *self,
+																				MarkonMenuElement *inMenuElement)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*actor;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(MARKON_IS_MENU_ELEMENT(inMenuElement), NULL);
+
+	priv=self->priv;
+
+	/* Return cached actor if available */
+	actor=CLUTTER_ACTOR(g_hash_table_lookup(priv->menuElementActors, inMenuElement));
+	if(actor) return(actor);
+
+	/* Create actor and store it in cache. The cache holds a reference on
+	 * menu element as it is used as user data at signal handler of actor.
+	 */
+	actor=_esdashboard_applications_view_create_actor_for_menu_element(self, inMenuElement);
+	g_object_ref_sink(actor);
+	g_hash_table_insert(priv->menuElementActors, g_object_ref(inMenuElement), actor);
+
+	ESDASHBOARD_DEBUG(self, ACTOR,
+						"Created actor for menu element '%s'",
+						markon_menu_element_get_name(inMenuElement));
+
+	return(actor);
+}
+
+/* Get actor of "parent menu" button and create it if missing */
+static ClutterActor* _esdashboard_applications_view_get_parent_menu_actor(EsdashboardApplicationsView *self)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
 	gchar								*actorText;
 
-	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self));
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
 
 	priv=self->priv;
 
-	/* Destroy all children */
-	esdashboard_focusable_set_selection(ESDASHBOARD_FOCUSABLE(self), NULL);
-	esdashboard_actor_destroy_all_children(CLUTTER_ACTOR(self));
-	clutter_layout_manager_layout_changed(priv->layout);
+	if(priv->parentMenuActor) return(priv->parentMenuActor);
 
-	/* Create parent menu item */
-	actor=esdashboard_button_new();
+	/* Create and adjust of "parent menu" button to application buttons */
+	priv->parentMenuActor=esdashboard_button_new();
+	g_object_ref_sink(priv->parentMenuActor);
 
-	if(priv->parentMenuIcon) esdashboard_label_set_icon_name(ESDASHBOARD_LABEL(actor), priv->parentMenuIcon);
+	if(priv->parentMenuIcon) esdashboard_label_set_icon_name(ESDASHBOARD_LABEL(priv->parentMenuActor), priv->parentMenuIcon);
 
 	if(priv->viewMode==ESDASHBOARD_VIEW_MODE_LIST) actorText=g_markup_printf_escaped(priv->formatTitleDescription, _("Back"), _("Go back to previous menu"));
 		else actorText=g_markup_printf_escaped(priv->formatTitleOnly, _("Back"));
-	esdashboard_label_set_text(ESDASHBOARD_LABEL(actor), actorText);
+	esdashboard_label_set_text(ESDASHBOARD_LABEL(priv->parentMenuActor), actorText);
 	g_free(actorText);
 
-	/* Add to view and layout */
-	_esdashboard_applications_view_setup_actor_for_view_mode(self, CLUTTER_ACTOR(actor));
-	clutter_actor_add_child(CLUTTER_ACTOR(self), CLUTTER_ACTOR(actor));
-	clutter_actor_show(actor);
-
-	g_signal_connect_swapped(actor,
-								"clicked",
-								G_CALLBACK(_esdashboard_applications_view_on_all_applications_menu_parent_menu_clicked),
-								self);
+	_esdashboard_applications_view_setup_actor_for_view_mode(self, priv->parentMenuActor);
 
-	/* Select "parent menu" automatically */
-	if(esdashboard_view_has_focus(ESDASHBOARD_VIEW(self)))
-	{
-		esdashboard_focusable_set_selection(ESDASHBOARD_FOCUSABLE(self), CLUTTER_ACTOR(actor));
-	}
+	g_signal_connect_swapped(priv->parentMenuActor, "clicked", G_CALLBACK(_esdashboard_applications_view_on_parent_menu_clicked), self);
 
-	/* Create menu items for all installed applications */
-	appDB=esdashboard_application_database_get_default();
+	return(priv->parentMenuActor);
+}
 
-	allApps=esdashboard_application_database_get_all_applications(appDB);
-	allApps=g_list_sort(allApps, (GCompareFunc)_esdashboard_applications_view_on_all_applications_sort_app_info);
+/* Get actor of "all applications" button and create it if missing */
+static ClutterActor* _esdashboard_applications_view_get_all_apps_menu_actor(EsdashboardApplicationsView *self)
+{
+	EsdashboardApplicationsViewPrivate	*priv;
+	gchar								*actorText;
 
-	for(iter=allApps; iter; iter=g_list_next(iter))
-	{
-		/* Get app info of application currently iterated */
-		appInfo=ESDASHBOARD_DESKTOP_APP_INFO(iter->data);
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
 
-		/* If desktop app info should be hidden then continue with next one */
-		if(!g_app_info_should_show(G_APP_INFO(appInfo)))
-		{
-			continue;
-		}
+	priv=self->priv;
 
-		/* Create actor for app info */
-		actor=esdashboard_application_button_new_from_app_info(G_APP_INFO(appInfo));
+	if(priv->allAppsMenuActor) return(priv->allAppsMenuActor);
 
-		g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_esdashboard_applications_view_on_item_clicked), self);
+	/* Create and adjust of "all applications" button to application buttons */
+	priv->allAppsMenuActor=esdashboard_button_new();
+	g_object_ref_sink(priv->allAppsMenuActor);
 
-		/* Set up and add pop-up menu click action */
-		clickAction=esdashboard_click_action_new();
-		g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_esdashboard_applications_view_on_popup_menu), self);
-		clutter_actor_add_action(actor, clickAction);
+	esdashboard_label_set_icon_name(ESDASHBOARD_LABEL(priv->allAppsMenuActor), ALL_APPLICATIONS_MENU_ICON);
 
-		/* Add to view and layout */
-		_esdashboard_applications_view_setup_actor_for_view_mode(self, CLUTTER_ACTOR(actor));
-		clutter_actor_add_child(CLUTTER_ACTOR(self), CLUTTER_ACTOR(actor));
-		clutter_actor_show(actor);
+	if(priv->viewMode==ESDASHBOARD_VIEW_MODE_LIST) actorText=g_markup_printf_escaped(priv->formatTitleDescription, _("All applications"), _("List of all installed applications"));
+		else actorText=g_markup_printf_escaped(priv->formatTitleOnly, _("All applications"));
+	esdashboard_label_set_text(ESDASHBOARD_LABEL(priv->allAppsMenuActor), actorText);
+	g_free(actorText);
 
-		/* Add drag action to actor */
-		dragAction=esdashboard_drag_action_new_with_source(CLUTTER_ACTOR(self));
-		clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
-		clutter_actor_add_action(actor, dragAction);
-		g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_esdashboard_applications_view_on_drag_begin), self);
-		g_signal_connect(dragAction, "drag-end", G_CALLBACK(_esdashboard_applications_view_on_drag_end), self);
+	_esdashboard_applications_view_setup_actor_for_view_mode(self, priv->allAppsMenuActor);
 
-		/* If no item was selected (i.e. no "parent menu" item) select this one
-		 * which is usually the first menu item.
-		 */
-		if(esdashboard_view_has_focus(ESDASHBOARD_VIEW(self)) &&
-			!esdashboard_focusable_get_selection(ESDASHBOARD_FOCUSABLE(self)))
-		{
-			esdashboard_focusable_set_selection(ESDASHBOARD_FOCUSABLE(self), CLUTTER_ACTOR(actor));
-		}
-	}
+	g_signal_connect_swapped(priv->allAppsMenuActor, "clicked", G_CALLBACK(_esdashboard_applications_view_on_all_applications_menu_clicked), self);
 
-	g_list_free_full(allApps, g_object_unref);
-	g_object_unref(appDB);
+	return(priv->allAppsMenuActor);
 }
 
 /* Filter to display applications has changed */
 static void _esdashboard_applications_view_on_filter_changed(EsdashboardApplicationsView *self, gpointer inUserData)
 {
 	EsdashboardApplicationsViewPrivate	*priv;
-	EsdashboardModelIter				*iterator;
+	EsdashboardModelRowIter				iterator;
 	ClutterActor						*actor;
+	ClutterActor						*child;
+	ClutterActor						*nextChild;
 	MarkonMenuElement					*menuElement=NULL;
 	MarkonMenu							*parentMenu=NULL;
-	ClutterAction						*clickAction;
-	ClutterAction						*dragAction;
-	GAppInfo							*appInfo;
+	GPtrArray							*actors;
+	GHashTable							*wantedActors;
+	guint								i;
 
 	g_return_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self));
 
 	priv=ESDASHBOARD_APPLICATIONS_VIEW(self)->priv;
 
-	/* Destroy all children */
+	/* Unset selection as the selected actor may be removed */
 	esdashboard_focusable_set_selection(ESDASHBOARD_FOCUSABLE(self), NULL);
-	esdashboard_actor_destroy_all_children(CLUTTER_ACTOR(self));
-	clutter_layout_manager_layout_changed(priv->layout);
+
+	/* Leave "All applications" menu if shown */
+	_esdashboard_applications_view_all_apps_clear(self);
+
+	/* Collect actors to show in the order they should be shown */
+	actors=g_ptr_array_new();
 
 	/* Get parent menu */
 	if(priv->currentRootMenuElement &&
@@ -647,154 +1336,84 @@ static void _esdashboard_applications_view_on_filter_changed(EsdashboardApplicat
 	/* If menu element to filter by is not the root menu element, add an "up ..." entry */
 	if(parentMenu)
 	{
-		gchar					*actorText;
-
-		/* Create and adjust of "parent menu" button to application buttons */
-		actor=esdashboard_button_new();
-
-		if(priv->parentMenuIcon) esdashboard_label_set_icon_name(ESDASHBOARD_LABEL(actor), priv->parentMenuIcon);
-
-		if(priv->viewMode==ESDASHBOARD_VIEW_MODE_LIST) actorText=g_markup_printf_escaped(priv->formatTitleDescription, _("Back"), _("Go back to previous menu"));
-			else actorText=g_markup_printf_escaped(priv->formatTitleOnly, _("Back"));
-		esdashboard_label_set_text(ESDASHBOARD_LABEL(actor), actorText);
-		g_free(actorText);
-
-		/* Add to view and layout */
-		_esdashboard_applications_view_setup_actor_for_view_mode(self, CLUTTER_ACTOR(actor));
-		clutter_actor_add_child(CLUTTER_ACTOR(self), CLUTTER_ACTOR(actor));
-		clutter_actor_show(actor);
-
-		g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_esdashboard_applications_view_on_parent_menu_clicked), self);
-
-		/* Select "parent menu" automatically */
-		if(esdashboard_view_has_focus(ESDASHBOARD_VIEW(self)))
-		{
-			esdashboard_focusable_set_selection(ESDASHBOARD_FOCUSABLE(self), CLUTTER_ACTOR(actor));
-		}
+		g_ptr_array_add(actors, _esdashboard_applications_view_get_parent_menu_actor(self));
 	}
 
 	if(priv->showAllAppsMenu &&
 		(!priv->currentRootMenuElement || !parentMenu))
 	{
-		gchar					*actorText;
+		g_ptr_array_add(actors, _esdashboard_applications_view_get_all_apps_menu_actor(self));
+	}
 
-		/* Create and adjust of "parent menu" button to application buttons */
-		actor=esdashboard_button_new();
-		esdashboard_label_set_icon_name(ESDASHBOARD_LABEL(actor), ALL_APPLICATIONS_MENU_ICON);
+	/* Iterate through rows not filtered in data model and get actor for each entry */
+	esdashboard_model_row_iter_init(&iterator, ESDASHBOARD_MODEL(priv->apps));
+	while(esdashboard_model_row_iter_next_filtered(&iterator))
+	{
+		/* Get data from model */
+		esdashboard_applications_menu_model_get_from_row_iter(priv->apps,
+																&iterator,
+																ESDASHBOARD_APPLICATIONS_MENU_MODEL_COLUMN_MENU_ELEMENT, &menuElement,
+																-1);
 
-		if(priv->viewMode==ESDASHBOARD_VIEW_MODE_LIST) actorText=g_markup_printf_escaped(priv->formatTitleDescription, _("All applications"), _("List of all installed applications"));
-			else actorText=g_markup_printf_escaped(priv->formatTitleOnly, _("All applications"));
-		esdashboard_label_set_text(ESDASHBOARD_LABEL(actor), actorText);
-		g_free(actorText);
+		if(!menuElement) continue;
 
-		/* Add to view and layout */
-		_esdashboard_applications_view_setup_actor_for_view_mode(self, CLUTTER_ACTOR(actor));
-		clutter_actor_add_child(CLUTTER_ACTOR(self), CLUTTER_ACTOR(actor));
-		clutter_actor_show(actor);
+		/* Get actor for menu element */
+		actor=_esdashboard_applications_view_get_actor_for_menu_element(self, menuElement);
+		g_ptr_array_add(actors, actor);
 
-		g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_esdashboard_applications_view_on_all_applications_menu_clicked), self);
+		/* Release allocated resources */
+		g_object_unref(menuElement);
+		menuElement=NULL;
+	}
 
-		/* Select "parent menu" automatically */
-		if(esdashboard_view_has_focus(ESDASHBOARD_VIEW(self)))
-		{
-			esdashboard_focusable_set_selection(ESDASHBOARD_FOCUSABLE(self), CLUTTER_ACTOR(actor));
-		}
+	/* Remove all children which should not be shown anymore. Removing cached
+	 * actors will keep them alive for the next time they are needed but all
+	 * other actors will be destroyed as the last reference is released.
+	 */
+	wantedActors=g_hash_table_new(g_direct_hash, g_direct_equal);
+	for(i=0; i<actors->len; i++)
+	{
+		g_hash_table_add(wantedActors, g_ptr_array_index(actors, i));
 	}
 
-	/* Iterate through (filtered) data model and create actor for each entry */
-	iterator=esdashboard_model_iter_new(ESDASHBOARD_MODEL(priv->apps));
-	if(iterator)
+	child=clutter_actor_get_first_child(CLUTTER_ACTOR(self));
+	while(child)
 	{
-		while(esdashboard_model_iter_next(iterator))
+		nextChild=clutter_actor_get_next_sibling(child);
+		if(!g_hash_table_contains(wantedActors, child))
 		{
-			/* If row is filtered continue with next one immediately */
-			if(!esdashboard_model_iter_filter(iterator)) continue;
-
-			/* Get data from model */
-			esdashboard_applications_menu_model_get(priv->apps,
-													iterator,
-													ESDASHBOARD_APPLICATIONS_MENU_MODEL_COLUMN_MENU_ELEMENT, &menuElement,
-													-1);
-
-			if(!menuElement) continue;
-
-			/* Create actor for menu element. Support drag'n'drop at actor if
-			 * menu element is a menu item.
-			 */
-			if(MARKON_IS_MENU_ITEM(menuElement))
-			{
-				appInfo=esdashboard_desktop_app_info_new_from_menu_item(MARKON_MENU_ITEM(menuElement));
-				actor=esdashboard_application_button_new_from_app_info(appInfo);
-				g_object_unref(appInfo);
-
-				g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_esdashboard_applications_view_on_item_clicked), self);
-			}
-				else
-				{
-					gchar		*actorText;
-					const gchar	*iconName;
-					const gchar	*title;
-					const gchar	*description;
-
-					actor=esdashboard_button_new();
-
-					iconName=markon_menu_element_get_icon_name(menuElement);
-					if(iconName) esdashboard_label_set_icon_name(ESDASHBOARD_LABEL(actor), iconName);
-
-					title=markon_menu_element_get_name(menuElement);
-					description=markon_menu_element_get_comment(menuElement);
-
-					if(priv->viewMode==ESDASHBOARD_VIEW_MODE_LIST)
-					{
-						actorText=g_markup_printf_escaped(priv->formatTitleDescription,
-															title ? title : "",
-															description ? description : "");
-					}
-						else
-						{
-							actorText=g_markup_printf_escaped(priv->formatTitleOnly,
-																title ? title : "");
-						}
-					esdashboard_label_set_text(ESDASHBOARD_LABEL(actor), actorText);
-					g_free(actorText);
+			clutter_actor_remove_child(CLUTTER_ACTOR(self), child);
+		}
+		child=nextChild;
+	}
 
-					g_signal_connect(actor, "clicked", G_CALLBACK(_esdashboard_applications_view_on_menu_clicked), menuElement);
-				}
+	/* Add missing actors and move existing ones into place */
+	for(i=0; i<actors->len; i++)
+	{
+		actor=CLUTTER_ACTOR(g_ptr_array_index(actors, i));
 
-			/* Add to view and layout */
-			_esdashboard_applications_view_setup_actor_for_view_mode(self, CLUTTER_ACTOR(actor));
-			clutter_actor_add_child(CLUTTER_ACTOR(self), CLUTTER_ACTOR(actor));
+		if(clutter_actor_get_parent(actor)!=CLUTTER_ACTOR(self))
+		{
+			clutter_actor_insert_child_at_index(CLUTTER_ACTOR(self), actor, i);
 			clutter_actor_show(actor);
-
-			/* Set up and add pop-up menu click action and drag action */
-			if(MARKON_IS_MENU_ITEM(menuElement))
-			{
-				clickAction=esdashboard_click_action_new();
-				g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_esdashboard_applications_view_on_popup_menu), self);
-				clutter_actor_add_action(actor, clickAction);
-
-				dragAction=esdashboard_drag_action_new_with_source(CLUTTER_ACTOR(self));
-				clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
-				clutter_actor_add_action(actor, dragAction);
-				g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_esdashboard_applications_view_on_drag_begin), self);
-				g_signal_connect(dragAction, "drag-end", G_CALLBACK(_esdashboard_applications_view_on_drag_end), self);
-			}
-
-			/* If no item was selected (i.e. no "parent menu" item) select this one
-			 * which is usually the first menu item.
-			 */
-			if(esdashboard_view_has_focus(ESDASHBOARD_VIEW(self)) &&
-				!esdashboard_focusable_get_selection(ESDASHBOARD_FOCUSABLE(self)))
+		}
+			else if(clutter_actor_get_child_at_index(CLUTTER_ACTOR(self), i)!=actor)
 			{
-				esdashboard_focusable_set_selection(ESDASHBOARD_FOCUSABLE(self), CLUTTER_ACTOR(actor));
+				clutter_actor_set_child_at_index(CLUTTER_ACTOR(self), actor, i);
 			}
+	}
+	clutter_layout_manager_layout_changed(priv->layout);
 
-			/* Release allocated resources */
-			g_object_unref(menuElement);
-			menuElement=NULL;
-		}
-		g_object_unref(iterator);
+	/* Select first item, i.e. the "parent menu" item if available, automatically */
+	if(actors->len>0 &&
+		esdashboard_view_has_focus(ESDASHBOARD_VIEW(self)))
+	{
+		esdashboard_focusable_set_selection(ESDASHBOARD_FOCUSABLE(self), CLUTTER_ACTOR(g_ptr_array_index(actors, 0)));
 	}
+
+	/* Release allocated resources */
+	g_hash_table_destroy(wantedActors);
+	g_ptr_array_free(actors, TRUE);
 }
 
 /* Application model has fully loaded */
@@ -807,8 +1426,10 @@ static void _esdashboard_applications_view_on_model_loaded(EsdashboardApplicatio
 	priv=ESDASHBOARD_APPLICATIONS_VIEW(self)->priv;
 
 	/* Reset to root menu as menu referenced will not be available anymore
-	 * and re-filter to update view
+	 * and re-filter to update view. Also forget all actors created for menu
+	 * elements of previous menu.
 	 */
+	_esdashboard_applications_view_clear_actor_cache(self);
 	priv->currentRootMenuElement=NULL;
 	esdashboard_applications_menu_model_filter_by_section(priv->apps, MARKON_MENU(priv->currentRootMenuElement));
 }
@@ -922,8 +1543,16 @@ static gboolean _esdashboard_applications_view_focusable_set_selection(Esdashboa
 		/* Add weak reference at new selection */
 		g_object_add_weak_pointer(G_OBJECT(priv->selectedItem), &priv->selectedItem);
 
-		/* Ensure new selection is visible */
-		esdashboard_view_child_ensure_visible(ESDASHBOARD_VIEW(self), priv->selectedItem);
+		/* Ensure new selection is visible. Actors in "All applications" menu
+		 * may just have been realized and are not allocated yet so their
+		 * position is computed.
+		 */
+		if(priv->allApps)
+		{
+			_esdashboard_applications_view_all_apps_ensure_visible(self,
+																	_esdashboard_applications_view_all_apps_get_index_for_actor(self, priv->selectedItem));
+		}
+			else esdashboard_view_child_ensure_visible(ESDASHBOARD_VIEW(self), priv->selectedItem);
 	}
 
 	/* New selection was set successfully */
@@ -1192,6 +1821,132 @@ static ClutterActor* _esdashboard_applications_view_get_selection_from_list_mode
 	return(selection);
 }
 
+/* Find requested selection target in "All applications" menu. Items are
+ * navigated by their index as only the visible ones have an actor.
+ */
+static ClutterActor* _esdashboard_applications_view_get_selection_from_all_apps(EsdashboardApplicationsView *self,
+																				ClutterActor *inSelection,
+																				EsdashboardSelectionTarget inDirection)
+{
+	gint									numberItems;
+	gint									rows;
+	gint									columns;
+	gint									pageRows;
+	gfloat									itemHeight;
+	gfloat									rowSpacing;
+	gfloat									viewHeight;
+	gint									currentSelectionIndex;
+	gint									currentSelectionRow;
+	gint									currentSelectionColumn;
+	gint									newSelectionIndex;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(CLUTTER_IS_ACTOR(inSelection), NULL);
+
+	/* Get index of current selection */
+	currentSelectionIndex=_esdashboard_applications_view_all_apps_get_index_for_actor(self, inSelection);
+	if(currentSelectionIndex<0) return(inSelection);
+
+	/* Get number of rows and columns and the number of rows visible at once */
+	numberItems=_esdashboard_applications_view_all_apps_get_number_items(self);
+	_esdashboard_applications_view_all_apps_get_layout_data(self,
+																clutter_actor_get_width(CLUTTER_ACTOR(self)),
+																&columns,
+																NULL,
+																&itemHeight,
+																NULL,
+																&rowSpacing);
+	if(columns<=0) return(inSelection);
+
+	rows=(numberItems+columns-1)/columns;
+
+	if(clutter_actor_has_clip(CLUTTER_ACTOR(self))) clutter_actor_get_clip(CLUTTER_ACTOR(self), NULL, NULL, NULL, &viewHeight);
+		else viewHeight=clutter_actor_get_height(CLUTTER_ACTOR(self));
+
+	pageRows=1;
+	if(itemHeight>0.0f) pageRows=MAX(1, (gint)floor((viewHeight+rowSpacing)/(itemHeight+rowSpacing)));
+
+	currentSelectionRow=(currentSelectionIndex / columns);
+	currentSelectionColumn=(currentSelectionIndex % columns);
+
+	/* Find target selection */
+	switch(inDirection)
+	{
+		case ESDASHBOARD_SELECTION_TARGET_LEFT:
+			if(currentSelectionColumn==0) newSelectionIndex=((currentSelectionRow+1)*columns)-1;
+				else newSelectionIndex=currentSelectionIndex-1;
+			break;
+
+		case ESDASHBOARD_SELECTION_TARGET_RIGHT:
+			if(currentSelectionColumn==columns-1 ||
+				currentSelectionIndex==numberItems-1)
+			{
+				newSelectionIndex=(currentSelectionRow*columns);
+			}
+				else newSelectionIndex=currentSelectionIndex+1;
+			break;
+
+		case ESDASHBOARD_SELECTION_TARGET_UP:
+			currentSelectionRow--;
+			if(currentSelectionRow<0) currentSelectionRow=rows-1;
+			newSelectionIndex=(currentSelectionRow*columns)+currentSelectionColumn;
+			break;
+
+		case ESDASHBOARD_SELECTION_TARGET_DOWN:
+			currentSelectionRow++;
+			if(currentSelectionRow>=rows) currentSelectionRow=0;
+			newSelectionIndex=(currentSelectionRow*columns)+currentSelectionColumn;
+			break;
+
+		case ESDASHBOARD_SELECTION_TARGET_PAGE_LEFT:
+			newSelectionIndex=(currentSelectionRow*columns);
+			break;
+
+		case ESDASHBOARD_SELECTION_TARGET_PAGE_RIGHT:
+			newSelectionIndex=((currentSelectionRow+1)*columns)-1;
+			break;
+
+		case ESDASHBOARD_SELECTION_TARGET_PAGE_UP:
+			currentSelectionRow=MAX(0, currentSelectionRow-pageRows);
+			newSelectionIndex=(currentSelectionRow*columns)+currentSelectionColumn;
+			break;
+
+		case ESDASHBOARD_SELECTION_TARGET_PAGE_DOWN:
+			currentSelectionRow=MIN(rows-1, currentSelectionRow+pageRows);
+			newSelectionIndex=(currentSelectionRow*columns)+currentSelectionColumn;
+			break;
+
+		case ESDASHBOARD_SELECTION_TARGET_FIRST:
+			newSelectionIndex=0;
+			break;
+
+		case ESDASHBOARD_SELECTION_TARGET_LAST:
+			newSelectionIndex=numberItems-1;
+			break;
+
+		case ESDASHBOARD_SELECTION_TARGET_NEXT:
+			if(currentSelectionIndex<numberItems-1) newSelectionIndex=currentSelectionIndex+1;
+				else newSelectionIndex=currentSelectionIndex-1;
+			break;
+
+		default:
+			{
+				gchar					*valueName;
+
+				valueName=esdashboard_get_enum_value_name(ESDASHBOARD_TYPE_SELECTION_TARGET, inDirection);
+				g_critical("Focusable object %s does not handle selection direction of type %s in all applications menu.",
+							G_OBJECT_TYPE_NAME(self),
+							valueName);
+				g_free(valueName);
+			}
+			return(inSelection);
+	}
+
+	/* Realize actor of new selection */
+	newSelectionIndex=CLAMP(newSelectionIndex, 0, numberItems-1);
+	return(_esdashboard_applications_view_all_apps_realize(self, newSelectionIndex));
+}
+
 static ClutterActor* _esdashboard_applications_view_focusable_find_selection(EsdashboardFocusable *inFocusable,
 																				ClutterActor *inSelection,
 																				EsdashboardSelectionTarget inDirection)
@@ -1215,7 +1970,8 @@ static ClutterActor* _esdashboard_applications_view_focusable_find_selection(Esd
 	/* If there is nothing selected, select first actor and return */
 	if(!inSelection)
 	{
-		newSelection=clutter_actor_get_first_child(CLUTTER_ACTOR(self));
+		if(priv->allApps) newSelection=_esdashboard_applications_view_all_apps_realize(self, 0);
+			else newSelection=clutter_actor_get_first_child(CLUTTER_ACTOR(self));
 
 		valueName=esdashboard_get_enum_value_name(ESDASHBOARD_TYPE_SELECTION_TARGET, inDirection);
 		ESDASHBOARD_DEBUG(self, ACTOR,
@@ -1242,6 +1998,12 @@ static ClutterActor* _esdashboard_applications_view_focusable_find_selection(Esd
 		return(NULL);
 	}
 
+	/* Items of "All applications" menu are navigated by index */
+	if(priv->allApps)
+	{
+		return(_esdashboard_applications_view_get_selection_from_all_apps(self, inSelection, inDirection));
+	}
+
 	/* Find target selection */
 	switch(inDirection)
 	{
@@ -1347,6 +2109,138 @@ void _esdashboard_applications_view_focusable_iface_init(EsdashboardFocusableInt
 	iface->activate_selection=_esdashboard_applications_view_focusable_activate_selection;
 }
 
+/* IMPLEMENTATION: ClutterActor */
+
+/* Get preferred width/height. In "All applications" menu the size is computed
+ * from geometry of items instead of asking layout manager for it.
+ */
+static void _esdashboard_applications_view_get_preferred_width(ClutterActor *inActor,
+																gfloat inForHeight,
+																gfloat *outMinWidth,
+																gfloat *outNaturalWidth)
+{
+	EsdashboardApplicationsView			*self=ESDASHBOARD_APPLICATIONS_VIEW(inActor);
+	EsdashboardApplicationsViewPrivate	*priv=self->priv;
+	gint								columns;
+	gfloat								itemWidth;
+	gfloat								columnSpacing;
+	gfloat								minWidth, naturalWidth;
+
+	/* Chain up to let layout manager determine size if not in "All applications" menu */
+	if(!priv->allApps)
+	{
+		CLUTTER_ACTOR_CLASS(esdashboard_applications_view_parent_class)->get_preferred_width(inActor,
+																								inForHeight,
+																								outMinWidth,
+																								outNaturalWidth);
+		return;
+	}
+
+	/* Minimum width is the width of one item and natural width is the width
+	 * of all items in one row.
+	 */
+	_esdashboard_applications_view_all_apps_get_layout_data(self, -1.0f, &columns, &itemWidth, NULL, &columnSpacing, NULL);
+
+	minWidth=itemWidth;
+	naturalWidth=itemWidth;
+	if(columns>1) naturalWidth=(columns*itemWidth)+((columns-1)*columnSpacing);
+
+	/* Store sizes computed */
+	if(outMinWidth) *outMinWidth=minWidth;
+	if(outNaturalWidth) *outNaturalWidth=naturalWidth;
+}
+
+static void _esdashboard_applications_view_get_preferred_height(ClutterActor *inActor,
+																gfloat inForWidth,
+																gfloat *outMinHeight,
+																gfloat *outNaturalHeight)
+{
+	EsdashboardApplicationsView			*self=ESDASHBOARD_APPLICATIONS_VIEW(inActor);
+	EsdashboardApplicationsViewPrivate	*priv=self->priv;
+	gint								numberItems;
+	gint								columns;
+	gint								rows;
+	gfloat								itemHeight;
+	gfloat								rowSpacing;
+	gfloat								height;
+
+	/* Chain up to let layout manager determine size if not in "All applications" menu */
+	if(!priv->allApps)
+	{
+		CLUTTER_ACTOR_CLASS(esdashboard_applications_view_parent_class)->get_preferred_height(inActor,
+																								inForWidth,
+																								outMinHeight,
+																								outNaturalHeight);
+		return;
+	}
+
+	/* Height is the height of all rows needed to show all items */
+	numberItems=_esdashboard_applications_view_all_apps_get_number_items(self);
+	_esdashboard_applications_view_all_apps_get_layout_data(self, inForWidth, &columns, NULL, &itemHeight, NULL, &rowSpacing);
+
+	height=0.0f;
+	if(columns>0)
+	{
+		rows=(numberItems+columns-1)/columns;
+		height=(rows*itemHeight)+((rows-1)*rowSpacing);
+	}
+
+	/* Store sizes computed */
+	if(outMinHeight) *outMinHeight=height;
+	if(outNaturalHeight) *outNaturalHeight=height;
+}
+
+/* Allocate position and size of actor and its children. In "All applications"
+ * menu only realized actors are allocated at the position of the item they show.
+ */
+static void _esdashboard_applications_view_allocate(ClutterActor *inActor,
+													const ClutterActorBox *inBox,
+													ClutterAllocationFlags inFlags)
+{
+	EsdashboardApplicationsView			*self=ESDASHBOARD_APPLICATIONS_VIEW(inActor);
+	EsdashboardApplicationsViewPrivate	*priv=self->priv;
+	gint								columns;
+	gfloat								itemWidth, itemHeight;
+	gfloat								columnSpacing, rowSpacing;
+	GHashTableIter						iter;
+	gpointer							key;
+	ClutterActor						*child;
+	gint								index;
+	ClutterActorBox						childBox;
+
+	/* Chain up to let layout manager allocate children if not in "All applications" menu */
+	if(!priv->allApps)
+	{
+		CLUTTER_ACTOR_CLASS(esdashboard_applications_view_parent_class)->allocate(inActor, inBox, inFlags);
+		return;
+	}
+
+	/* Store the allocation of the actor */
+	clutter_actor_set_allocation(inActor, inBox, inFlags);
+
+	/* Allocate realized actors */
+	_esdashboard_applications_view_all_apps_get_layout_data(self,
+																clutter_actor_box_get_width(inBox),
+																&columns,
+																&itemWidth,
+																&itemHeight,
+																&columnSpacing,
+																&rowSpacing);
+	if(columns<=0) return;
+
+	g_hash_table_iter_init(&iter, priv->allAppsActors);
+	while(g_hash_table_iter_next(&iter, &key, (gpointer*)&child))
+	{
+		index=GPOINTER_TO_INT(key);
+
+		childBox.x1=(index % columns)*(itemWidth+columnSpacing);
+		childBox.y1=(index / columns)*(itemHeight+rowSpacing);
+		childBox.x2=childBox.x1+itemWidth;
+		childBox.y2=childBox.y1+itemHeight;
+		clutter_actor_allocate(child, &childBox, inFlags);
+	}
+}
+
 /* IMPLEMENTATION: GObject */
 
 /* Dispose this object */
@@ -1362,6 +2256,20 @@ static void _esdashboard_applications_view_dispose(GObject *inObject)
 		priv->selectedItem=NULL;
 	}
 
+	_esdashboard_applications_view_all_apps_clear(self);
+	if(priv->allAppsActors)
+	{
+		g_hash_table_destroy(priv->allAppsActors);
+		priv->allAppsActors=NULL;
+	}
+
+	_esdashboard_applications_view_clear_actor_cache(self);
+	if(priv->menuElementActors)
+	{
+		g_hash_table_destroy(priv->menuElementActors);
+		priv->menuElementActors=NULL;
+	}
+
 	if(priv->esconfChannel)
 	{
 		priv->esconfChannel=NULL;
@@ -1498,9 +2406,14 @@ static void _esdashboard_applications_view_get_property(GObject *inObject,
 static void esdashboard_applications_view_class_init(EsdashboardApplicationsViewClass *klass)
 {
 	EsdashboardActorClass	*actorClass=ESDASHBOARD_ACTOR_CLASS(klass);
+	ClutterActorClass		*clutterActorClass=CLUTTER_ACTOR_CLASS(klass);
 	GObjectClass			*gobjectClass=G_OBJECT_CLASS(klass);
 
 	/* Override functions */
+	clutterActorClass->get_preferred_width=_esdashboard_applications_view_get_preferred_width;
+	clutterActorClass->get_preferred_height=_esdashboard_applications_view_get_preferred_height;
+	clutterActorClass->allocate=_esdashboard_applications_view_allocate;
+
 	gobjectClass->dispose=_esdashboard_applications_view_dispose;
 	gobjectClass->set_property=_esdashboard_applications_view_set_property;
 	gobjectClass->get_property=_esdashboard_applications_view_get_property;
@@ -1579,6 +2492,16 @@ static void esdashboard_applications_view_init(EsdashboardApplicationsView *self
 	priv->formatTitleOnly=g_strdup("%s");
 	priv->formatTitleDescription=g_strdup("%s\n%s");
 	priv->selectedItem=NULL;
+	priv->menuElementActors=g_hash_table_new_full(g_direct_hash,
+													g_direct_equal,
+													g_object_unref,
+													_esdashboard_applications_view_release_cached_actor);
+	priv->parentMenuActor=NULL;
+	priv->allAppsMenuActor=NULL;
+	priv->allApps=NULL;
+	priv->allAppsActors=g_hash_table_new(g_direct_hash, g_direct_equal);
+	priv->allAppsRecycledActors=NULL;
+	priv->allAppsUpdateID=0;
 	priv->showAllAppsMenu=FALSE;
 	priv->esconfChannel=esdashboard_application_get_esconf_channel(NULL);
 	priv->esconfShowAllAppsMenuBindingID=0;
@@ -1597,6 +2520,9 @@ static void esdashboard_applications_view_init(EsdashboardApplicationsView *self
 	g_signal_connect_swapped(priv->apps, "filter-changed", G_CALLBACK(_esdashboard_applications_view_on_filter_changed), self);
 	g_signal_connect_swapped(priv->apps, "loaded", G_CALLBACK(_esdashboard_applications_view_on_model_loaded), self);
 
+	g_signal_connect(self, "notify::clip-rect", G_CALLBACK(_esdashboard_applications_view_on_clip_changed), NULL);
+	g_signal_connect(self, "allocation-changed", G_CALLBACK(_esdashboard_applications_view_on_allocation_changed), NULL);
+
 	/* Connect signal to application */
 	application=esdashboard_application_get_default();
 	g_signal_connect_swapped(application, "resume", G_CALLBACK(_esdashboard_applications_view_on_application_resume), self);
@@ -1659,6 +2585,7 @@ void esdashboard_applications_view_set_view_mode(EsdashboardApplicationsView *se
 		}
 
 		/* Rebuild view */
+		_esdashboard_applications_view_clear_actor_cache(self);
 		_esdashboard_applications_view_on_filter_changed(self, NULL);
 
 		/* Notify about property change */
@@ -1740,6 +2667,7 @@ void esdashboard_applications_view_set_parent_menu_icon(EsdashboardApplicationsV
 		if(inIconName) priv->parentMenuIcon=g_strdup(inIconName);
 
 		/* Update actor */
+		_esdashboard_applications_view_clear_actor_cache(self);
 		_esdashboard_applications_view_on_filter_changed(self, NULL);
 
 		/* Notify about property change */
@@ -1772,7 +2700,11 @@ void esdashboard_applications_view_set_format_title_only(EsdashboardApplications
 		priv->formatTitleOnly=g_strdup(inFormat);
 
 		/* Update view only if view mode is list which uses this format string */
-		if(priv->viewMode==ESDASHBOARD_VIEW_MODE_ICON) _esdashboard_applications_view_on_filter_changed(self, NULL);
+		if(priv->viewMode==ESDASHBOARD_VIEW_MODE_ICON)
+		{
+			_esdashboard_applications_view_clear_actor_cache(self);
+			_esdashboard_applications_view_on_filter_changed(self, NULL);
+		}
 
 		/* Notify about property change */
 		g_object_notify_by_pspec(G_OBJECT(self), EsdashboardApplicationsViewProperties[PROP_FORMAT_TITLE_ONLY]);
@@ -1804,7 +2736,11 @@ void esdashboard_applications_view_set_format_title_description(EsdashboardAppli
 		priv->formatTitleDescription=g_strdup(inFormat);
 
 		/* Update view only if view mode is list which uses this format string */
-		if(priv->viewMode==ESDASHBOARD_VIEW_MODE_LIST) _esdashboard_applications_view_on_filter_changed(self, NULL);
+		if(priv->viewMode==ESDASHBOARD_VIEW_MODE_LIST)
+		{
+			_esdashboard_applications_view_clear_actor_cache(self);
+			_esdashboard_applications_view_on_filter_changed(self, NULL);
+		}
 
 		/* Notify about property change */
 		g_object_notify_by_pspec(G_OBJECT(self), EsdashboardApplicationsViewProperties[PROP_FORMAT_TITLE_DESCRIPTION]);
@@ -0,0 +1,195 @@
+/*
+ * bench-model-iter: Compares iterating a model with EsdashboardModelIter
+ *                   and with the lightweight EsdashboardModelRowIter
+ *
+ * Copyright 2012-2020 Stephan Haller <nomad@froevel.de>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ *
+ *
+ * This program fills a model with 10000 rows and walks all rows and all
+ * rows passing a filter repeatedly with EsdashboardModelIter,
+ * esdashboard_model_foreach() and EsdashboardModelRowIter. It prints the
+ * average time per walk of each and fails if they do not visit the same
+ * rows.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+
+#include <libesdashboard/model.h>
+
+
+/* Definitions */
+static gint				_bench_count=10000;
+static gint				_bench_iterations=1000;
+
+static GOptionEntry		_bench_options[]=
+{
+	{ "count", 'c', 0, G_OPTION_ARG_INT, &_bench_count, "Number of rows in model", "N" },
+	{ "iterations", 'i', 0, G_OPTION_ARG_INT, &_bench_iterations, "Number of times all rows are walked", "N" },
+	{ NULL }
+};
+
+/* Filter function keeping every second row */
+static gboolean _bench_filter(EsdashboardModelIter *inIter, gpointer inUserData)
+{
+	return((GPOINTER_TO_INT(esdashboard_model_iter_get(inIter)) % 2)==0);
+}
+
+/* Foreach function summing up data of rows */
+static void _bench_foreach(EsdashboardModelIter *inIter, gpointer inData, gpointer inUserData)
+{
+	*((gint64*)inUserData)+=GPOINTER_TO_INT(inData);
+}
+
+/* Walk all rows with model iterator */
+static gint64 _bench_walk_model_iter(EsdashboardModel *inModel, gboolean inFiltered)
+{
+	EsdashboardModelIter	*iter;
+	gint64					sum;
+
+	sum=0;
+	iter=esdashboard_model_iter_new(inModel);
+	while(esdashboard_model_iter_next(iter))
+	{
+		if(inFiltered && !esdashboard_model_iter_filter(iter)) continue;
+		sum+=GPOINTER_TO_INT(esdashboard_model_iter_get(iter));
+	}
+	g_object_unref(iter);
+
+	return(sum);
+}
+
+/* Walk all rows with model's foreach function */
+static gint64 _bench_walk_foreach(EsdashboardModel *inModel, gboolean inFiltered)
+{
+	gint64					sum;
+
+	sum=0;
+	esdashboard_model_foreach(inModel, _bench_foreach, &sum);
+
+	return(sum);
+}
+
+/* Walk all rows with row iterator */
+static gint64 _bench_walk_row_iter(EsdashboardModel *inModel, gboolean inFiltered)
+{
+	EsdashboardModelRowIter	iter;
+	gint64					sum;
+
+	sum=0;
+	esdashboard_model_row_iter_init(&iter, inModel);
+	if(inFiltered)
+	{
+		while(esdashboard_model_row_iter_next_filtered(&iter))
+		{
+			sum+=GPOINTER_TO_INT(esdashboard_model_row_iter_get(&iter));
+		}
+	}
+		else
+		{
+			while(esdashboard_model_row_iter_next(&iter))
+			{
+				sum+=GPOINTER_TO_INT(esdashboard_model_row_iter_get(&iter));
+			}
+		}
+
+	return(sum);
+}
+
+/* Time walking all rows and print result */
+static gint64 _bench_run(const gchar *inName,
+							EsdashboardModel *inModel,
+							gboolean inFiltered,
+							gint64 (*inWalkFunc)(EsdashboardModel*, gboolean))
+{
+	gint64					start;
+	gint64					elapsed;
+	gint64					sum;
+	gint					i;
+
+	sum=0;
+	start=g_get_monotonic_time();
+	for(i=0; i<_bench_iterations; i++) sum=inWalkFunc(inModel, inFiltered);
+	elapsed=g_get_monotonic_time()-start;
+
+	g_print("%-32s %12.1f us %16" G_GINT64_FORMAT "\n",
+			inName,
+			(gdouble)elapsed/_bench_iterations,
+			sum);
+
+	return(sum);
+}
+
+/* Main entry point */
+int main(int argc, char **argv)
+{
+	GOptionContext			*context;
+	EsdashboardModel		*model;
+	GError					*error;
+	gint64					expectedSum;
+	gboolean				success;
+	gint					i;
+
+	error=NULL;
+
+	/* Parse command-line options */
+	context=g_option_context_new("- benchmark iterating rows of model");
+	g_option_context_add_main_entries(context, _bench_options, NULL);
+	if(!g_option_context_parse(context, &argc, &argv, &error))
+	{
+		g_printerr("%s\n", (error && error->message) ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		g_option_context_free(context);
+		return(EXIT_FAILURE);
+	}
+	g_option_context_free(context);
+
+	/* Fill model with rows whose data is the row's number starting at one */
+	model=esdashboard_model_new();
+	for(i=0; i<_bench_count; i++)
+	{
+		esdashboard_model_append(model, GINT_TO_POINTER(i+1), NULL);
+	}
+
+	g_print("%d rows, %d iterations\n\n", _bench_count, _bench_iterations);
+	success=TRUE;
+
+	/* Walk all rows */
+	expectedSum=_bench_run("all rows: EsdashboardModelIter", model, FALSE, _bench_walk_model_iter);
+	if(_bench_run("all rows: foreach", model, FALSE, _bench_walk_foreach)!=expectedSum) success=FALSE;
+	if(_bench_run("all rows: EsdashboardModelRowIter", model, FALSE, _bench_walk_row_iter)!=expectedSum) success=FALSE;
+
+	/* Walk rows passing filter. The filter result is cached by model so the
+	 * first walk also includes evaluating the filter function of each row.
+	 */
+	esdashboard_model_set_filter(model, _bench_filter, NULL, NULL);
+	g_print("\n");
+
+	expectedSum=_bench_run("filtered: EsdashboardModelIter", model, TRUE, _bench_walk_model_iter);
+	if(_bench_run("filtered: EsdashboardModelRowIter", model, TRUE, _bench_walk_row_iter)!=expectedSum) success=FALSE;
+
+	if(!success) g_printerr("Iterators did not visit the same rows\n");
+
+	/* Release allocated resources */
+	g_object_unref(model);
+
+	return(success ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,399 @@
+/*
+ * bench-search-index: Compares the n-gram search index of application
+ *                     database with a linear scan over all applications
+ *
+ * Copyright 2012-2020 Stephan Haller <nomad@froevel.de>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ *
+ *
+ * This program writes a synthetic catalog of desktop files and a menu into
+ * a temporary directory, points the XDG base directories at it and loads the
+ * application database from there. Then it runs a set of queries through
+ * esdashboard_application_database_get_search_candidates() and through a
+ * linear scan which folds and matches the searchable fields of every
+ * application like the applications search provider did before the index
+ * existed. It prints the average time of both per query and fails if the
+ * index misses an application found by the linear scan.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <glib/gstdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libesdashboard/application-database.h>
+#include <libesdashboard/desktop-app-info.h>
+
+
+/* Definitions */
+static gint				_bench_count=10000;
+static gint				_bench_iterations=100;
+
+static GOptionEntry		_bench_options[]=
+{
+	{ "count", 'c', 0, G_OPTION_ARG_INT, &_bench_count, "Number of applications in synthetic catalog", "N" },
+	{ "iterations", 'i', 0, G_OPTION_ARG_INT, &_bench_iterations, "Number of times each query is run", "N" },
+	{ NULL }
+};
+
+static const gchar		*_bench_words[]=
+{
+	"text", "image", "audio", "video", "terminal", "browser", "mail", "office",
+	"calendar", "archive", "network", "monitor", "player", "viewer", "editor", "manager",
+	"settings", "scanner", "printer", "screen", "font", "disk", "clock", "notes",
+	NULL
+};
+
+static const gchar		*_bench_queries[][3]=
+{
+	{ "t", NULL },
+	{ "ed", NULL },
+	{ "edit", NULL },
+	{ "terminal", NULL },
+	{ "mail", "view", NULL },
+	{ "bench-app-04242", NULL },
+	{ "xyzzy", NULL },
+};
+
+/* Remove directory and all its content */
+static void _bench_remove_directory(const gchar *inPath)
+{
+	GDir				*directory;
+	const gchar			*name;
+
+	directory=g_dir_open(inPath, 0, NULL);
+	if(directory)
+	{
+		while((name=g_dir_read_name(directory)))
+		{
+			gchar		*path;
+
+			path=g_build_filename(inPath, name, NULL);
+			if(g_file_test(path, G_FILE_TEST_IS_DIR)) _bench_remove_directory(path);
+				else g_unlink(path);
+			g_free(path);
+		}
+
+		g_dir_close(directory);
+	}
+
+	g_rmdir(inPath);
+}
+
+/* Write synthetic catalog of desktop files and a menu including all of them */
+static gboolean _bench_create_catalog(const gchar *inBasePath, GError **outError)
+{
+	gchar				*path;
+	guint				wordsCount;
+	gint				i;
+	gboolean			success;
+
+	wordsCount=g_strv_length((gchar**)_bench_words);
+
+	/* Create menu */
+	path=g_build_filename(inBasePath, "config", "menus", NULL);
+	g_mkdir_with_parents(path, 0700);
+	g_free(path);
+
+	path=g_build_filename(inBasePath, "config", "menus", "applications.menu", NULL);
+	success=g_file_set_contents(path,
+								"<!DOCTYPE Menu PUBLIC \"-//freedesktop//DTD Menu 1.0//EN\"\n"
+								" \"http://www.freedesktop.org/standards/menu-spec/1.0/menu.dtd\">\n"
+								"<Menu>\n"
+								"  <Name>Applications</Name>\n"
+								"  <DefaultAppDirs/>\n"
+								"  <Include><All/></Include>\n"
+								"</Menu>\n",
+								-1,
+								outError);
+	g_free(path);
+	if(!success) return(FALSE);
+
+	/* Create desktop files */
+	path=g_build_filename(inBasePath, "data", "applications", NULL);
+	g_mkdir_with_parents(path, 0700);
+	g_free(path);
+
+	for(i=0; success && i<_bench_count; i++)
+	{
+		const gchar		*first;
+		const gchar		*second;
+		const gchar		*third;
+		gchar			*filename;
+		gchar			*content;
+
+		first=_bench_words[i % wordsCount];
+		second=_bench_words[(i / wordsCount) % wordsCount];
+		third=_bench_words[(i / (wordsCount * wordsCount)) % wordsCount];
+
+		content=g_strdup_printf("[Desktop Entry]\n"
+								"Type=Application\n"
+								"Name=%s %s %05d\n"
+								"Comment=Synthetic %s application for benchmark\n"
+								"Exec=bench-app-%05d %%U\n"
+								"Keywords=%s;%s;\n"
+								"Categories=Utility;\n",
+								first, second, i,
+								third,
+								i,
+								second, third);
+
+		filename=g_strdup_printf("bench-app-%05d.desktop", i);
+		path=g_build_filename(inBasePath, "data", "applications", filename, NULL);
+		success=g_file_set_contents(path, content, -1, outError);
+
+		/* Release allocated resources */
+		g_free(path);
+		g_free(filename);
+		g_free(content);
+	}
+
+	return(success);
+}
+
+/* Determine if application matches all search terms by scanning its fields */
+static gboolean _bench_linear_matches(GAppInfo *inAppInfo, gchar **inTerms)
+{
+	GString				*text;
+	gchar				*foldedText;
+	const gchar			*value;
+	GList				*iter;
+	gboolean			matches;
+
+	/* Collect and fold all searchable fields */
+	text=g_string_new(NULL);
+
+	value=g_app_info_get_display_name(inAppInfo);
+	if(value) g_string_append_printf(text, "%s\n", value);
+
+	value=g_app_info_get_description(inAppInfo);
+	if(value) g_string_append_printf(text, "%s\n", value);
+
+	value=g_app_info_get_executable(inAppInfo);
+	if(value) g_string_append_printf(text, "%s\n", value);
+
+	if(ESDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo))
+	{
+		for(iter=esdashboard_desktop_app_info_get_keywords(ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo)); iter; iter=g_list_next(iter))
+		{
+			if(iter->data) g_string_append_printf(text, "%s\n", (const gchar*)iter->data);
+		}
+	}
+
+	foldedText=g_utf8_strdown(text->str, text->len);
+
+	/* Check that each search term occurs */
+	matches=TRUE;
+	for(; matches && *inTerms; inTerms++)
+	{
+		if(!strstr(foldedText, *inTerms)) matches=FALSE;
+	}
+
+	/* Release allocated resources */
+	g_free(foldedText);
+	g_string_free(text, TRUE);
+
+	return(matches);
+}
+
+/* Run one query through index and linear scan and print timings */
+static gboolean _bench_run_query(EsdashboardApplicationDatabase *inAppDB,
+									GList *inApplications,
+									const gchar **inTerms)
+{
+	GHashTable			*candidateIDs;
+	GList				*candidates;
+	GList				*iter;
+	gchar				**foldedTerms;
+	gchar				*query;
+	gint64				start;
+	gint64				indexTime;
+	gint64				linearTime;
+	guint				candidatesCount;
+	guint				matchesCount;
+	guint				missedCount;
+	gint				i;
+
+	query=g_strjoinv(" ", (gchar**)inTerms);
+
+	foldedTerms=g_new0(gchar*, g_strv_length((gchar**)inTerms)+1);
+	for(i=0; inTerms[i]; i++) foldedTerms[i]=g_utf8_strdown(inTerms[i], -1);
+
+	/* Time look-up of candidates in search index */
+	candidates=NULL;
+	start=g_get_monotonic_time();
+	for(i=0; i<_bench_iterations; i++)
+	{
+		if(candidates) g_list_free_full(candidates, g_free);
+		candidates=esdashboard_application_database_get_search_candidates(inAppDB, inTerms);
+	}
+	indexTime=g_get_monotonic_time()-start;
+
+	/* Time linear scan over all applications */
+	matchesCount=0;
+	start=g_get_monotonic_time();
+	for(i=0; i<_bench_iterations; i++)
+	{
+		matchesCount=0;
+		for(iter=inApplications; iter; iter=g_list_next(iter))
+		{
+			if(_bench_linear_matches(G_APP_INFO(iter->data), foldedTerms)) matchesCount++;
+		}
+	}
+	linearTime=g_get_monotonic_time()-start;
+
+	/* Check that each application found by linear scan is a candidate */
+	candidateIDs=g_hash_table_new(g_str_hash, g_str_equal);
+	candidatesCount=0;
+	for(iter=candidates; iter; iter=g_list_next(iter))
+	{
+		g_hash_table_add(candidateIDs, iter->data);
+		candidatesCount++;
+	}
+
+	missedCount=0;
+	for(iter=inApplications; iter; iter=g_list_next(iter))
+	{
+		if(_bench_linear_matches(G_APP_INFO(iter->data), foldedTerms) &&
+			!g_hash_table_contains(candidateIDs, g_app_info_get_id(G_APP_INFO(iter->data))))
+		{
+			missedCount++;
+		}
+	}
+
+	g_print("%-20s %10u %10u %14.1f %14.1f %8.1fx\n",
+			query,
+			candidatesCount,
+			matchesCount,
+			(gdouble)indexTime/_bench_iterations,
+			(gdouble)linearTime/_bench_iterations,
+			indexTime>0 ? (gdouble)linearTime/indexTime : 0.0);
+
+	if(missedCount>0)
+	{
+		g_printerr("Search index missed %u applications matching '%s'\n", missedCount, query);
+	}
+
+	/* Release allocated resources */
+	g_hash_table_destroy(candidateIDs);
+	g_list_free_full(candidates, g_free);
+	g_strfreev(foldedTerms);
+	g_free(query);
+
+	return(missedCount==0);
+}
+
+/* Main entry point */
+int main(int argc, char **argv)
+{
+	GOptionContext						*context;
+	EsdashboardApplicationDatabase		*appDB;
+	GList								*applications;
+	GError								*error;
+	gchar								*basePath;
+	gchar								*path;
+	gint64								start;
+	gboolean							success;
+	guint								i;
+
+	error=NULL;
+
+	/* Parse command-line options */
+	context=g_option_context_new("- benchmark search index of application database");
+	g_option_context_add_main_entries(context, _bench_options, NULL);
+	if(!g_option_context_parse(context, &argc, &argv, &error))
+	{
+		g_printerr("%s\n", (error && error->message) ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		g_option_context_free(context);
+		return(EXIT_FAILURE);
+	}
+	g_option_context_free(context);
+
+	/* Create synthetic catalog and point XDG base directories at it. This has
+	 * to be done before anything asks GLib for these directories as it caches
+	 * them.
+	 */
+	basePath=g_dir_make_tmp("esdashboard-bench-XXXXXX", &error);
+	if(!basePath || !_bench_create_catalog(basePath, &error))
+	{
+		g_printerr("Could not create synthetic catalog: %s\n", (error && error->message) ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		if(basePath)
+		{
+			_bench_remove_directory(basePath);
+			g_free(basePath);
+		}
+		return(EXIT_FAILURE);
+	}
+
+	path=g_build_filename(basePath, "data", NULL);
+	g_setenv("XDG_DATA_HOME", path, TRUE);
+	g_setenv("XDG_DATA_DIRS", path, TRUE);
+	g_free(path);
+
+	path=g_build_filename(basePath, "config", NULL);
+	g_setenv("XDG_CONFIG_HOME", path, TRUE);
+	g_setenv("XDG_CONFIG_DIRS", path, TRUE);
+	g_free(path);
+
+	path=g_build_filename(basePath, "cache", NULL);
+	g_setenv("XDG_CACHE_HOME", path, TRUE);
+	g_free(path);
+
+	g_setenv("XDG_MENU_PREFIX", "", TRUE);
+
+	/* Load application database which builds the search index */
+	appDB=esdashboard_application_database_get_default();
+
+	start=g_get_monotonic_time();
+	if(!esdashboard_application_database_load(appDB, &error))
+	{
+		g_printerr("Could not load application database: %s\n", (error && error->message) ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		g_object_unref(appDB);
+		_bench_remove_directory(basePath);
+		g_free(basePath);
+		return(EXIT_FAILURE);
+	}
+
+	applications=esdashboard_application_database_get_all_applications(appDB);
+	g_print("Loaded %u applications in %.1f ms, %d iterations per query\n\n",
+			g_list_length(applications),
+			(gdouble)(g_get_monotonic_time()-start)/1000.0,
+			_bench_iterations);
+
+	/* Run queries */
+	g_print("%-20s %10s %10s %14s %14s %9s\n", "query", "candidates", "matches", "index (us)", "linear (us)", "speedup");
+
+	success=TRUE;
+	for(i=0; i<G_N_ELEMENTS(_bench_queries); i++)
+	{
+		if(!_bench_run_query(appDB, applications, _bench_queries[i])) success=FALSE;
+	}
+
+	/* Release allocated resources */
+	g_list_free_full(applications, g_object_unref);
+	g_object_unref(appDB);
+	_bench_remove_directory(basePath);
+	g_free(basePath);
+
+	return(success ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -53,14 +53,27 @@ struct _EsdashboardDesktopAppInfoPrivate
 	guint				itemChangedID;
 
 	GKeyFile			*secondarySource;
+	gsize				secondarySourceSize;
 
 	gchar				*binaryExecutable;
 
 	gboolean			needActions;
 	GList				*actions;
+	GVariant			*rawActions;
 
 	gboolean			needKeywords;
 	GList				*keywords;
+	GVariant			*rawKeywords;
+
+	/* Values taken from cache of application database which are used until
+	 * menu item is loaded on-demand.
+	 */
+	gboolean			hasCachedValues;
+	gchar				*cachedName;
+	gchar				*cachedComment;
+	gchar				*cachedCommand;
+	gchar				*cachedIconName;
+	gboolean			cachedVisible;
 };
 
 G_DEFINE_TYPE_WITH_CODE(EsdashboardDesktopAppInfo,
@@ -69,6 +82,20 @@ G_DEFINE_TYPE_WITH_CODE(EsdashboardDesktopAppInfo,
 						G_ADD_PRIVATE(EsdashboardDesktopAppInfo)
 						G_IMPLEMENT_INTERFACE(G_TYPE_APP_INFO, _esdashboard_desktop_app_info_gappinfo_iface_init))
 
+/* Number and size of secondary sources currently kept in memory by all
+ * desktop app infos.
+ */
+static gint		_esdashboard_desktop_app_info_secondary_sources_count=0;
+static gsize	_esdashboard_desktop_app_info_secondary_sources_size=0;
+G_LOCK_DEFINE_STATIC(_esdashboard_desktop_app_info_secondary_sources_lock);
+
+/* Number and size of raw values of keywords and application actions currently
+ * kept in memory by all desktop app infos until they are loaded on-demand.
+ */
+static gint		_esdashboard_desktop_app_info_raw_values_count=0;
+static gsize	_esdashboard_desktop_app_info_raw_values_size=0;
+G_LOCK_DEFINE_STATIC(_esdashboard_desktop_app_info_raw_values_lock);
+
 /* Properties */
 enum
 {
@@ -102,11 +129,131 @@ typedef struct
 	gchar	*desktopFile;
 } EsdashboardDesktopAppInfoChildSetupData;
 
+/* Release values taken from cache */
+static void _esdashboard_desktop_app_info_clear_cached_values(EsdashboardDesktopAppInfo *self)
+{
+	EsdashboardDesktopAppInfoPrivate		*priv;
+
+	g_return_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(self));
+
+	priv=self->priv;
+
+	/* Release allocated resources */
+	if(priv->cachedName)
+	{
+		g_free(priv->cachedName);
+		priv->cachedName=NULL;
+	}
+
+	if(priv->cachedComment)
+	{
+		g_free(priv->cachedComment);
+		priv->cachedComment=NULL;
+	}
+
+	if(priv->cachedCommand)
+	{
+		g_free(priv->cachedCommand);
+		priv->cachedCommand=NULL;
+	}
+
+	if(priv->cachedIconName)
+	{
+		g_free(priv->cachedIconName);
+		priv->cachedIconName=NULL;
+	}
+
+	priv->cachedVisible=FALSE;
+	priv->hasCachedValues=FALSE;
+}
+
+/* Menu item has changed */
+static void _esdashboard_desktop_app_info_on_item_changed(EsdashboardDesktopAppInfo *self,
+															gpointer inUserData)
+{
+	g_return_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(self));
+
+	/* Emit 'changed' signal for this desktop app info */
+	g_signal_emit(self, EsdashboardDesktopAppInfoSignals[SIGNAL_CHANGED], 0);
+}
+
+/* Load menu item if it was deferred because values were taken from cache.
+ * Returns TRUE if menu item is available.
+ */
+static gboolean _esdashboard_desktop_app_info_ensure_item(EsdashboardDesktopAppInfo *self)
+{
+	EsdashboardDesktopAppInfoPrivate		*priv;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(self), FALSE);
+
+	priv=self->priv;
+
+	if(!priv->item && priv->hasCachedValues && priv->file)
+	{
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Loading deferred menu item for desktop ID '%s'",
+							priv->desktopID);
+
+		priv->item=markon_menu_item_new(priv->file);
+		if(priv->item)
+		{
+			priv->itemChangedID=g_signal_connect_swapped(priv->item,
+															"changed",
+															G_CALLBACK(_esdashboard_desktop_app_info_on_item_changed),
+															self);
+		}
+	}
+
+	return(priv->item!=NULL);
+}
+
+/* Get command of application either from cache or menu item */
+static const gchar* _esdashboard_desktop_app_info_get_command(EsdashboardDesktopAppInfo *self)
+{
+	EsdashboardDesktopAppInfoPrivate		*priv;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(self), NULL);
+
+	priv=self->priv;
+
+	if(priv->hasCachedValues) return(priv->cachedCommand);
+	if(priv->item) return(markon_menu_item_get_command(priv->item));
+	return(NULL);
+}
+
+/* Release secondary source and update memory counter */
+static void _esdashboard_desktop_app_info_release_secondary_source(EsdashboardDesktopAppInfo *self)
+{
+	EsdashboardDesktopAppInfoPrivate		*priv;
+
+	g_return_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(self));
+
+	priv=self->priv;
+
+	if(!priv->secondarySource) return;
+
+	G_LOCK(_esdashboard_desktop_app_info_secondary_sources_lock);
+	_esdashboard_desktop_app_info_secondary_sources_count--;
+	_esdashboard_desktop_app_info_secondary_sources_size-=priv->secondarySourceSize;
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Released secondary source of desktop ID '%s' - %d secondary sources with %" G_GSIZE_FORMAT " bytes left",
+						priv->desktopID,
+						_esdashboard_desktop_app_info_secondary_sources_count,
+						_esdashboard_desktop_app_info_secondary_sources_size);
+	G_UNLOCK(_esdashboard_desktop_app_info_secondary_sources_lock);
+
+	/* Release allocated resources */
+	g_key_file_unref(priv->secondarySource);
+	priv->secondarySource=NULL;
+	priv->secondarySourceSize=0;
+}
+
 /* Load secondary source file if not already done.
  * Note: It is called secondary source although it is the same file as used
  * for MarkonMenuItem. But it is not the same source because the file is loaded
  * via a GKeyFile object to get access to entries not provided by markon or
- * implemented in an unusable way for esdashboard.
+ * implemented in an unusable way for esdashboard. It is only kept until the
+ * raw values of application actions and keywords were taken from it.
  */
 static gboolean _esdashboard_desktop_app_info_load_secondary_source(EsdashboardDesktopAppInfo *self)
 {
@@ -122,18 +269,26 @@ static gboolean _esdashboard_desktop_app_info_load_secondary_source(EsdashboardD
 	{
 		GKeyFile							*keyfile;
 		gchar								*secondarySourceFilename;
+		gchar								*contents;
+		gsize								contentsLength;
 		GError								*error;
 
 		error=NULL;
+		contents=NULL;
+		contentsLength=0;
 
 		/* Get path to secondary source file */
 		secondarySourceFilename=g_file_get_path(priv->file);
 
-		/* Load secondary source file */
+		/* Load secondary source file. Translations for other locales than
+		 * the current one are not needed and not kept.
+		 */
 		keyfile=g_key_file_new();
-		if(!g_key_file_load_from_file(keyfile,
-										secondarySourceFilename,
-										G_KEY_FILE_KEEP_TRANSLATIONS,
+		if(!g_file_get_contents(secondarySourceFilename, &contents, &contentsLength, &error) ||
+			!g_key_file_load_from_data(keyfile,
+										contents,
+										contentsLength,
+										G_KEY_FILE_NONE,
 										&error))
 		{
 			/* Show warning */
@@ -144,6 +299,7 @@ static gboolean _esdashboard_desktop_app_info_load_secondary_source(EsdashboardD
 
 			/* Release allocated resources */
 			if(error) g_error_free(error);
+			if(contents) g_free(contents);
 			if(secondarySourceFilename) g_free(secondarySourceFilename);
 			if(keyfile) g_key_file_unref(keyfile);
 
@@ -153,8 +309,20 @@ static gboolean _esdashboard_desktop_app_info_load_secondary_source(EsdashboardD
 
 		/* Use secondary source */
 		priv->secondarySource=g_key_file_ref(keyfile);
+		priv->secondarySourceSize=contentsLength;
+
+		G_LOCK(_esdashboard_desktop_app_info_secondary_sources_lock);
+		_esdashboard_desktop_app_info_secondary_sources_count++;
+		_esdashboard_desktop_app_info_secondary_sources_size+=contentsLength;
+		ESDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Loaded secondary source of desktop ID '%s' - %d secondary sources with %" G_GSIZE_FORMAT " bytes in use",
+							priv->desktopID,
+							_esdashboard_desktop_app_info_secondary_sources_count,
+							_esdashboard_desktop_app_info_secondary_sources_size);
+		G_UNLOCK(_esdashboard_desktop_app_info_secondary_sources_lock);
 
 		/* Release allocated resources */
+		if(contents) g_free(contents);
 		if(secondarySourceFilename) g_free(secondarySourceFilename);
 		if(keyfile) g_key_file_unref(keyfile);
 	}
@@ -168,6 +336,245 @@ static gboolean _esdashboard_desktop_app_info_load_secondary_source(EsdashboardD
 	return(TRUE);
 }
 
+/* Add keywords as stored in desktop file to raw values */
+static void _esdashboard_desktop_app_info_add_raw_keywords(GKeyFile *inKeyFile,
+															GVariantBuilder *ioKeywords)
+{
+	gchar								**keywords;
+	gchar								**iter;
+
+	g_return_if_fail(inKeyFile);
+	g_return_if_fail(ioKeywords);
+
+	keywords=g_key_file_get_string_list(inKeyFile,
+										G_KEY_FILE_DESKTOP_GROUP,
+										"Keywords",
+										NULL,
+										NULL);
+	if(!keywords) return;
+
+	for(iter=keywords; *iter; iter++)
+	{
+		g_variant_builder_add(ioKeywords, "s", *iter);
+	}
+
+	/* Release allocated resources */
+	g_strfreev(keywords);
+}
+
+/* Add application actions as stored in desktop file to raw values */
+static void _esdashboard_desktop_app_info_add_raw_actions(GKeyFile *inKeyFile,
+															GVariantBuilder *ioActions)
+{
+	gchar								**itemActions;
+	gchar								**iter;
+
+	g_return_if_fail(inKeyFile);
+	g_return_if_fail(ioActions);
+
+	itemActions=g_key_file_get_string_list(inKeyFile,
+											G_KEY_FILE_DESKTOP_GROUP,
+											G_KEY_FILE_DESKTOP_KEY_ACTIONS,
+											NULL,
+											NULL);
+	if(!itemActions) return;
+
+	for(iter=itemActions; *iter; iter++)
+	{
+		gchar							*itemActionGroup;
+		gchar							*itemActionName;
+		gchar							*itemActionIcon;
+		gchar							*itemActionExec;
+
+		/* Get display name of application action. According to the specification,
+		 * it says only the "Name" keyword is required. So skip application
+		 * actions without display name.
+		 */
+		itemActionGroup=g_strdup_printf("Desktop Action %s", *iter);
+		itemActionName=g_key_file_get_locale_string(inKeyFile,
+													itemActionGroup,
+													G_KEY_FILE_DESKTOP_KEY_NAME,
+													NULL,
+													NULL);
+		if(itemActionName)
+		{
+			itemActionIcon=g_key_file_get_string(inKeyFile, itemActionGroup, G_KEY_FILE_DESKTOP_KEY_ICON, NULL);
+			itemActionExec=g_key_file_get_string(inKeyFile, itemActionGroup, G_KEY_FILE_DESKTOP_KEY_EXEC, NULL);
+
+			g_variant_builder_add(ioActions, "(smsms)", itemActionName, itemActionIcon, itemActionExec);
+
+			/* Release allocated resources */
+			if(itemActionExec) g_free(itemActionExec);
+			if(itemActionIcon) g_free(itemActionIcon);
+			g_free(itemActionName);
+		}
+
+		/* Release allocated resources */
+		g_free(itemActionGroup);
+	}
+
+	/* Release allocated resources */
+	g_strfreev(itemActions);
+}
+
+/* Set or release raw values and update memory counter */
+static void _esdashboard_desktop_app_info_set_raw_value(GVariant **ioRawValue, GVariant *inValue)
+{
+	G_LOCK(_esdashboard_desktop_app_info_raw_values_lock);
+
+	if(*ioRawValue)
+	{
+		_esdashboard_desktop_app_info_raw_values_count--;
+		_esdashboard_desktop_app_info_raw_values_size-=g_variant_get_size(*ioRawValue);
+
+		g_variant_unref(*ioRawValue);
+		*ioRawValue=NULL;
+	}
+
+	if(inValue)
+	{
+		*ioRawValue=g_variant_ref_sink(inValue);
+
+		_esdashboard_desktop_app_info_raw_values_count++;
+		_esdashboard_desktop_app_info_raw_values_size+=g_variant_get_size(*ioRawValue);
+	}
+
+	G_UNLOCK(_esdashboard_desktop_app_info_raw_values_lock);
+}
+
+/* Release all raw values of keywords and application actions */
+static void _esdashboard_desktop_app_info_release_raw_values(EsdashboardDesktopAppInfo *self)
+{
+	g_return_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(self));
+
+	_esdashboard_desktop_app_info_set_raw_value(&self->priv->rawKeywords, NULL);
+	_esdashboard_desktop_app_info_set_raw_value(&self->priv->rawActions, NULL);
+}
+
+/* Load raw values of keywords and application actions not loaded yet from
+ * secondary source. Both are taken at once, so the secondary source can be
+ * released immediately and is not kept until both were loaded on-demand.
+ */
+static void _esdashboard_desktop_app_info_load_raw_values(EsdashboardDesktopAppInfo *self)
+{
+	EsdashboardDesktopAppInfoPrivate		*priv;
+	GVariantBuilder							builder;
+
+	g_return_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(self));
+
+	priv=self->priv;
+
+	/* Check if any raw value is missing */
+	if((!priv->needKeywords || priv->rawKeywords) &&
+		(!priv->needActions || priv->rawActions))
+	{
+		return;
+	}
+
+	/* Load secondary source to get raw values from */
+	if(!_esdashboard_desktop_app_info_load_secondary_source(self)) return;
+
+	if(priv->needKeywords && !priv->rawKeywords)
+	{
+		g_variant_builder_init(&builder, G_VARIANT_TYPE("as"));
+		_esdashboard_desktop_app_info_add_raw_keywords(priv->secondarySource, &builder);
+		_esdashboard_desktop_app_info_set_raw_value(&priv->rawKeywords, g_variant_builder_end(&builder));
+	}
+
+	if(priv->needActions && !priv->rawActions)
+	{
+		g_variant_builder_init(&builder, G_VARIANT_TYPE("a(smsms)"));
+		_esdashboard_desktop_app_info_add_raw_actions(priv->secondarySource, &builder);
+		_esdashboard_desktop_app_info_set_raw_value(&priv->rawActions, g_variant_builder_end(&builder));
+	}
+
+	/* Secondary source is not needed anymore */
+	_esdashboard_desktop_app_info_release_secondary_source(self);
+
+	G_LOCK(_esdashboard_desktop_app_info_raw_values_lock);
+	ESDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Loaded raw values of desktop ID '%s' - %d raw values with %" G_GSIZE_FORMAT " bytes in use",
+						priv->desktopID,
+						_esdashboard_desktop_app_info_raw_values_count,
+						_esdashboard_desktop_app_info_raw_values_size);
+	G_UNLOCK(_esdashboard_desktop_app_info_raw_values_lock);
+}
+
+/* Determine visibility of application from values stored in desktop file in
+ * the same way as markon does for menu items. It depends on the current
+ * desktop environment and the executables found in $PATH, so it is not stored
+ * in cache but determined each time the cache is loaded.
+ */
+static gboolean _esdashboard_desktop_app_info_get_visible_from_values(gboolean inNoDisplay,
+																		gchar **inOnlyShowIn,
+																		gchar **inNotShowIn,
+																		const gchar *inTryExec)
+{
+	const gchar								*environment;
+	gchar									**environments;
+	gchar									**iter;
+	gboolean								visible;
+
+	/* Check if application should be shown in current desktop environment.
+	 * According to the specification there is either a OnlyShowIn or
+	 * a NotShowIn list.
+	 */
+	environment=markon_get_environment();
+	if(environment)
+	{
+		environments=g_strsplit(environment, ":", 0);
+
+		visible=TRUE;
+		if(inOnlyShowIn && *inOnlyShowIn)
+		{
+			visible=FALSE;
+			for(iter=inOnlyShowIn; *iter && !visible; iter++)
+			{
+				if(g_strv_contains((const gchar* const*)environments, *iter)) visible=TRUE;
+			}
+		}
+			else if(inNotShowIn)
+			{
+				for(iter=inNotShowIn; *iter && visible; iter++)
+				{
+					if(g_strv_contains((const gchar* const*)environments, *iter)) visible=FALSE;
+				}
+			}
+
+		g_strfreev(environments);
+
+		if(!visible) return(FALSE);
+	}
+
+	/* Check if application should not be displayed at all */
+	if(inNoDisplay) return(FALSE);
+
+	/* Check if executable to try exists either at absolute path or in $PATH */
+	if(inTryExec)
+	{
+		gchar								**argv;
+		gchar								*program;
+
+		if(g_shell_parse_argv(inTryExec, NULL, &argv, NULL))
+		{
+			visible=g_file_test(argv[0], G_FILE_TEST_EXISTS);
+			if(!visible)
+			{
+				program=g_find_program_in_path(argv[0]);
+				visible=(program!=NULL);
+				g_free(program);
+			}
+
+			g_strfreev(argv);
+
+			return(visible);
+		}
+	}
+
+	/* If we get here the application is visible */
+	return(TRUE);
+}
+
 /* Get or update path to executable file for this application */
 static void _esdashboard_desktop_app_info_update_binary_executable(EsdashboardDesktopAppInfo *self)
 {
@@ -187,13 +594,13 @@ static void _esdashboard_desktop_app_info_update_binary_executable(EsdashboardDe
 		priv->binaryExecutable=NULL;
 	}
 
-	if(priv->item)
+	if(_esdashboard_desktop_app_info_get_command(self))
 	{
 		const gchar						*command;
 		const gchar						*commandStart;
 		const gchar						*commandEnd;
 
-		command=markon_menu_item_get_command(priv->item);
+		command=_esdashboard_desktop_app_info_get_command(self);
 
 		while(*command==' ') command++;
 		commandStart=command;
@@ -283,91 +690,21 @@ static void _esdashboard_desktop_app_info_update_actions(EsdashboardDesktopAppIn
 	 * application actions of a desktop entry and the first version providing
 	 * these function return the action in an unpredictable order but not the
 	 * order as listed in "Action" keyword of desktop entry. So we need to
-	 * load the secondary source and grab them ourselve.
+	 * grab them ourselve from raw values which were either taken from cache
+	 * or loaded from secondary source.
 	 */
-	if(_esdashboard_desktop_app_info_load_secondary_source(self))
-	{
-		gchar								**itemActions;
-		gchar								**iter;
-		gchar								*itemActionGroup;
-		gchar								*itemActionName;
-		gchar								*itemActionIcon;
-		gchar								*itemActionExec;
+	_esdashboard_desktop_app_info_load_raw_values(self);
+	if(priv->rawActions)
+	{
+		GVariantIter						iter;
+		const gchar							*itemActionName;
+		const gchar							*itemActionIcon;
+		const gchar							*itemActionExec;
 		EsdashboardDesktopAppInfoAction		*action;
-		GError								*error;
-
-		error=NULL;
-
-		/* Get list of actions and their order from "Action" keyword */
-		itemActions=g_key_file_get_string_list(priv->secondarySource,
-												G_KEY_FILE_DESKTOP_GROUP,
-												G_KEY_FILE_DESKTOP_KEY_ACTIONS,
-												NULL,
-												&error);
-		if(!itemActions)
-		{
-			ESDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Could not fetch list of actions from secondary source for desktop ID '%s': %s",
-								priv->desktopID,
-								error ? error->message : "Unknown error");
-
-			/* Release allocated resources */
-			if(error) g_error_free(error);
-
-			/* Return from here as we cannot collect any list of actions */
-			return;
-		}
 
-		/* Get action currently iterated from string list of secondary source */
-		for(iter=itemActions; *iter; iter++)
+		g_variant_iter_init(&iter, priv->rawActions);
+		while(g_variant_iter_next(&iter, "(&sm&sm&s)", &itemActionName, &itemActionIcon, &itemActionExec))
 		{
-			/* Determine group name in desktop file to retrieve data about
-			 * application action currently iterated.
-			 */
-			itemActionGroup=g_strdup_printf("Desktop Action %s", *iter);
-
-			/* Get display name of application action. According to the specification,
-			 * it says only the "Name" keyword is required. So do not create a
-			 * desktop info action object if it is missing, but fail silenty and
-			 * continue with next action in list.
-			 */
-			itemActionName=g_key_file_get_locale_string(priv->secondarySource,
-														itemActionGroup,
-														G_KEY_FILE_DESKTOP_KEY_NAME,
-														NULL,
-														&error);
-			if(!itemActionName)
-			{
-				ESDASHBOARD_DEBUG(self, APPLICATIONS,
-									"Could not get name of action '%s' from secondary source for desktop ID '%s': %s",
-									*iter,
-									priv->desktopID,
-									error ? error->message : "Unknown error");
-
-				/* Release allocated resources */
-				if(itemActionGroup) g_free(itemActionGroup);
-				if(error)
-				{
-					g_error_free(error);
-					error=NULL;
-				}
-
-				/* Continue with next action */
-				continue;
-			}
-
-			/* Get optional icon name of application action */
-			itemActionIcon=g_key_file_get_string(priv->secondarySource,
-													itemActionGroup,
-													G_KEY_FILE_DESKTOP_KEY_ICON,
-													NULL);
-
-			/* Get optional command of application action */
-			itemActionExec=g_key_file_get_string(priv->secondarySource,
-													itemActionGroup,
-													G_KEY_FILE_DESKTOP_KEY_EXEC,
-													NULL);
-
 			/* Create desktop info action object and add to list */
 			action=ESDASHBOARD_DESKTOP_APP_INFO_ACTION
 					(
@@ -380,25 +717,19 @@ static void _esdashboard_desktop_app_info_update_actions(EsdashboardDesktopAppIn
 			priv->actions=g_list_prepend(priv->actions, action);
 
 			ESDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Created application action '%s' for desktop ID '%s' from secondary source",
+								"Created application action '%s' for desktop ID '%s' from raw values",
 								esdashboard_desktop_app_info_action_get_name(action),
 								priv->desktopID);
-
-			/* Release allocated resources */
-			if(itemActionExec) g_free(itemActionExec);
-			if(itemActionIcon) g_free(itemActionIcon);
-			if(itemActionName) g_free(itemActionName);
-			if(itemActionGroup) g_free(itemActionGroup);
 		}
 		priv->actions=g_list_reverse(priv->actions);
-
-		/* Release allocated resources */
-		if(itemActions) g_strfreev(itemActions);
 	}
 #endif
 
 	/* Set flag that application actions are loaded and do not need futher updates */
 	priv->needActions=FALSE;
+
+	/* Raw values of application actions are not needed anymore */
+	_esdashboard_desktop_app_info_set_raw_value(&priv->rawActions, NULL);
 }
 
 /* (Re-)Load keywords */
@@ -442,67 +773,36 @@ static void _esdashboard_desktop_app_info_update_keywords(EsdashboardDesktopAppI
 	}
 #else
 	/* Markon does not provide an accessor function to get keywords for desktop
-	 * entries in any official released version yet. So load them ourselve from
-	 * secondary source.
+	 * entries in any official released version yet. So take them ourselve from
+	 * raw values which were either taken from cache or loaded from secondary
+	 * source.
 	 */
-	if(_esdashboard_desktop_app_info_load_secondary_source(self))
+	_esdashboard_desktop_app_info_load_raw_values(self);
+	if(priv->rawKeywords)
 	{
-		gchar								**keywords;
-		gchar								**iter;
-		GError								*error;
-
-		error=NULL;
-
-		/* Get keywords from secondary source */
-		keywords=g_key_file_get_string_list(priv->secondarySource,
-												G_KEY_FILE_DESKTOP_GROUP,
-												"Keywords",
-												NULL,
-												&error);
-		if(!keywords)
-		{
-			ESDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Could not fetch list of keywords from secondary source for desktop ID '%s': %s",
-								priv->desktopID,
-								error ? error->message : "Unknown error");
-
-			/* Release allocated resources */
-			if(error) g_error_free(error);
-
-			/* Return from here as we cannot collect any list of actions */
-			return;
-		}
+		GVariantIter						iter;
+		const gchar							*keyword;
 
-		/* Get action currently iterated from string list of secondary source */
-		for(iter=keywords; *iter; iter++)
+		g_variant_iter_init(&iter, priv->rawKeywords);
+		while(g_variant_iter_next(&iter, "&s", &keyword))
 		{
 			/* Create copy a currently iterated keyword and prepend to list */
-			priv->keywords=g_list_prepend(priv->keywords, g_strdup(*iter));
+			priv->keywords=g_list_prepend(priv->keywords, g_strdup(keyword));
 
 			ESDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Added keyword '%s' for desktop ID '%s' from secondary source",
-								*iter,
+								"Added keyword '%s' for desktop ID '%s' from raw values",
+								keyword,
 								priv->desktopID);
 		}
 		priv->keywords=g_list_reverse(priv->keywords);
-
-		/* Release allocated resources */
-		if(keywords) g_strfreev(keywords);
 	}
 #endif
 
 	/* Set flag that keywords are loaded and do not need futher updates */
 	priv->needKeywords=FALSE;
-}
-
-/* Menu item has changed */
-static void _esdashboard_desktop_app_info_on_item_changed(EsdashboardDesktopAppInfo *self,
-															gpointer inUserData)
-{
-	g_return_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(self));
 
-	/* Emit 'changed' signal for this desktop app info */
-	g_signal_emit(self, EsdashboardDesktopAppInfoSignals[SIGNAL_CHANGED], 0);
+	/* Raw values of keywords are not needed anymore */
+	_esdashboard_desktop_app_info_set_raw_value(&priv->rawKeywords, NULL);
 }
 
 /* Set desktop ID */
@@ -551,12 +851,12 @@ static void _esdashboard_desktop_app_info_set_file(EsdashboardDesktopAppInfo *se
 		/* Freeze notification */
 		g_object_freeze_notify(G_OBJECT(self));
 
-		/* Release secondard source */
-		if(priv->secondarySource)
-		{
-			g_key_file_unref(priv->secondarySource);
-			priv->secondarySource=NULL;
-		}
+		/* Release values taken from cache as they belong to old file */
+		_esdashboard_desktop_app_info_clear_cached_values(self);
+
+		/* Release secondard source and raw values */
+		_esdashboard_desktop_app_info_release_secondary_source(self);
+		_esdashboard_desktop_app_info_release_raw_values(self);
 
 		/* Replace current file to menu item with new one */
 		if(priv->file)
@@ -907,6 +1207,20 @@ static gboolean _esdashboard_desktop_app_info_launch_appinfo_internal(Esdashboar
 	argv=NULL;
 	error=NULL;
 
+	/* Launching needs the menu item so load it if it was deferred */
+	if(!_esdashboard_desktop_app_info_ensure_item(self))
+	{
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						G_IO_ERROR_FAILED,
+						"Could not load desktop file for desktop ID '%s'",
+						priv->desktopID);
+
+		/* Return error state */
+		return(FALSE);
+	}
+
 	/* Get command-line with expanded macros */
 	expanded=g_string_new(NULL);
 	if(!expanded ||
@@ -1179,6 +1493,20 @@ static gboolean _esdashboard_desktop_app_info_launch_appinfo_internal(Esdashboar
 	argv=NULL;
 	error=NULL;
 
+	/* Launching needs the menu item so load it if it was deferred */
+	if(!_esdashboard_desktop_app_info_ensure_item(self))
+	{
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						G_IO_ERROR_FAILED,
+						"Could not load desktop file for desktop ID '%s'",
+						priv->desktopID);
+
+		/* Return error state */
+		return(FALSE);
+	}
+
 	/* Get command-line with expanded macros */
 	name=markon_menu_item_get_name(priv->item);
 	uri=markon_menu_item_get_uri(priv->item);
@@ -1455,7 +1783,11 @@ static gboolean _esdashboard_desktop_app_info_gappinfo_equal(GAppInfo *inLeft, G
 	right=ESDASHBOARD_DESKTOP_APP_INFO(inRight);
 
 	/* If one of both instance do not have a menu item return FALSE */
-	if(!left->priv->item || !right->priv->item) return(FALSE);
+	if(!_esdashboard_desktop_app_info_ensure_item(left) ||
+		!_esdashboard_desktop_app_info_ensure_item(right))
+	{
+		return(FALSE);
+	}
 
 	/* Return result of check if menu item of both GAppInfos are equal */
 	return(markon_menu_element_equal(MARKON_MENU_ELEMENT(left->priv->item),
@@ -1488,6 +1820,9 @@ static const gchar* _esdashboard_desktop_app_info_gappinfo_get_name(GAppInfo *in
 	self=ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
 
+	/* Return name from cache if available */
+	if(priv->hasCachedValues) return(priv->cachedName);
+
 	/* If desktop app info has no item return NULL here */
 	if(!priv->item) return(NULL);
 
@@ -1506,6 +1841,9 @@ static const gchar* _esdashboard_desktop_app_info_gappinfo_get_description(GAppI
 	self=ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
 
+	/* Return comment from cache if available */
+	if(priv->hasCachedValues) return(priv->cachedComment);
+
 	/* If desktop app info has no item return NULL here */
 	if(!priv->item) return(NULL);
 
@@ -1542,10 +1880,12 @@ static GIcon* _esdashboard_desktop_app_info_gappinfo_get_icon(GAppInfo *inAppInf
 	priv=self->priv;
 	icon=NULL;
 
-	/* Create icon from path of menu item */
-	if(priv->item)
+	/* Create icon from path of menu item or from cache if available */
+	if(priv->hasCachedValues || priv->item)
 	{
-		iconFilename=markon_menu_item_get_icon_name(priv->item);
+		if(priv->hasCachedValues) iconFilename=priv->cachedIconName;
+			else iconFilename=markon_menu_item_get_icon_name(priv->item);
+
 		if(iconFilename)
 		{
 			if(!g_path_is_absolute(iconFilename)) icon=g_themed_icon_new(iconFilename);
@@ -1568,27 +1908,22 @@ static GIcon* _esdashboard_desktop_app_info_gappinfo_get_icon(GAppInfo *inAppInf
 static gboolean _esdashboard_desktop_app_info_gappinfo_supports_uris(GAppInfo *inAppInfo)
 {
 	EsdashboardDesktopAppInfo			*self;
-	EsdashboardDesktopAppInfoPrivate	*priv;
 	gboolean							result;
 	const gchar							*command;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), FALSE);
 
 	self=ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
 	result=FALSE;
 
 	/* Check if command at menu item contains "%u" or "%U"
 	 * indicating URIs as command-line parameters.
 	 */
-	if(priv->item)
+	command=_esdashboard_desktop_app_info_get_command(self);
+	if(command)
 	{
-		command=markon_menu_item_get_command(priv->item);
-		if(command)
-		{
-			if(!result && strstr(command, "%u")) result=TRUE;
-			if(!result && strstr(command, "%U")) result=TRUE;
-		}
+		if(!result && strstr(command, "%u")) result=TRUE;
+		if(!result && strstr(command, "%U")) result=TRUE;
 	}
 
 	/* Return result of check */
@@ -1599,27 +1934,22 @@ static gboolean _esdashboard_desktop_app_info_gappinfo_supports_uris(GAppInfo *i
 static gboolean _esdashboard_desktop_app_info_gappinfo_supports_files(GAppInfo *inAppInfo)
 {
 	EsdashboardDesktopAppInfo			*self;
-	EsdashboardDesktopAppInfoPrivate	*priv;
 	gboolean							result;
 	const gchar							*command;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), FALSE);
 
 	self=ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
 	result=FALSE;
 
 	/* Check if command at menu item contains "%f" or "%F"
 	 * indicating file paths as command-line parameters.
 	 */
-	if(priv->item)
+	command=_esdashboard_desktop_app_info_get_command(self);
+	if(command)
 	{
-		command=markon_menu_item_get_command(priv->item);
-		if(command)
-		{
-			if(!result && strstr(command, "%f")) result=TRUE;
-			if(!result && strstr(command, "%F")) result=TRUE;
-		}
+		if(!result && strstr(command, "%f")) result=TRUE;
+		if(!result && strstr(command, "%F")) result=TRUE;
 	}
 
 	/* Return result of check */
@@ -1633,7 +1963,6 @@ static gboolean _esdashboard_desktop_app_info_gappinfo_launch(GAppInfo *inAppInf
 																GError **outError)
 {
 	EsdashboardDesktopAppInfo			*self;
-	EsdashboardDesktopAppInfoPrivate	*priv;
 	GList								*iter;
 	GList								*uris;
 	gchar								*uri;
@@ -1644,7 +1973,6 @@ static gboolean _esdashboard_desktop_app_info_gappinfo_launch(GAppInfo *inAppInf
 	g_return_val_if_fail(outError && *outError==NULL, FALSE);
 
 	self=ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
 	uris=NULL;
 
 	/* Create list of URIs for files */
@@ -1657,7 +1985,7 @@ static gboolean _esdashboard_desktop_app_info_gappinfo_launch(GAppInfo *inAppInf
 
 	/* Call function to launch application of EsdashboardDesktopAppInfo with URIs */
 	result=_esdashboard_desktop_app_info_launch_appinfo_internal(self,
-																	markon_menu_item_get_command(priv->item),
+																	_esdashboard_desktop_app_info_get_command(self),
 																	uris,
 																	inContext,
 																	outError);
@@ -1675,7 +2003,6 @@ static gboolean _esdashboard_desktop_app_info_gappinfo_launch_uris(GAppInfo *inA
 																	GError **outError)
 {
 	EsdashboardDesktopAppInfo			*self;
-	EsdashboardDesktopAppInfoPrivate	*priv;
 	gboolean							result;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), FALSE);
@@ -1683,11 +2010,10 @@ static gboolean _esdashboard_desktop_app_info_gappinfo_launch_uris(GAppInfo *inA
 	g_return_val_if_fail(outError && *outError==NULL, FALSE);
 
 	self=ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
 
 	/* Call function to launch application of EsdashboardDesktopAppInfo with URIs */
 	result=_esdashboard_desktop_app_info_launch_appinfo_internal(self,
-																	markon_menu_item_get_command(priv->item),
+																	_esdashboard_desktop_app_info_get_command(self),
 																	inURIs,
 																	inContext,
 																	outError);
@@ -1706,6 +2032,9 @@ static gboolean _esdashboard_desktop_app_info_gappinfo_should_show(GAppInfo *inA
 	self=ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
 
+	/* Return visibility from cache if available */
+	if(priv->hasCachedValues) return(priv->cachedVisible);
+
 	/* If desktop app info has no item return FALSE here */
 	if(!priv->item) return(FALSE);
 
@@ -1717,18 +2046,13 @@ static gboolean _esdashboard_desktop_app_info_gappinfo_should_show(GAppInfo *inA
 static const gchar* _esdashboard_desktop_app_info_gappinfo_get_commandline(GAppInfo *inAppInfo)
 {
 	EsdashboardDesktopAppInfo			*self;
-	EsdashboardDesktopAppInfoPrivate	*priv;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), NULL);
 
 	self=ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
-
-	/* If desktop app info has no item return NULL here */
-	if(!priv->item) return(NULL);
 
-	/* Return command of menu item */
-	return(markon_menu_item_get_command(priv->item));
+	/* Return command of menu item or from cache */
+	return(_esdashboard_desktop_app_info_get_command(self));
 }
 
 /* Get display name of GAppInfo */
@@ -1742,6 +2066,9 @@ static const gchar* _esdashboard_desktop_app_info_gappinfo_get_display_name(GApp
 	self=ESDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
 
+	/* Return name from cache if available */
+	if(priv->hasCachedValues) return(priv->cachedName);
+
 	/* If desktop app info has no item return NULL here */
 	if(!priv->item) return(NULL);
 
@@ -1799,6 +2126,8 @@ static void _esdashboard_desktop_app_info_dispose(GObject *inObject)
 		priv->binaryExecutable=NULL;
 	}
 
+	_esdashboard_desktop_app_info_clear_cached_values(self);
+
 	if(priv->item)
 	{
 		if(priv->itemChangedID)
@@ -1811,11 +2140,8 @@ static void _esdashboard_desktop_app_info_dispose(GObject *inObject)
 		priv->item=NULL;
 	}
 
-	if(priv->secondarySource)
-	{
-		g_key_file_unref(priv->secondarySource);
-		priv->secondarySource=NULL;
-	}
+	_esdashboard_desktop_app_info_release_secondary_source(self);
+	_esdashboard_desktop_app_info_release_raw_values(self);
 
 	if(priv->file)
 	{
@@ -1954,8 +2280,11 @@ static void esdashboard_desktop_app_info_init(EsdashboardDesktopAppInfo *self)
 	priv->binaryExecutable=NULL;
 	priv->actions=NULL;
 	priv->needActions=TRUE;
+	priv->rawActions=NULL;
 	priv->keywords=NULL;
 	priv->needKeywords=TRUE;
+	priv->rawKeywords=NULL;
+	priv->hasCachedValues=FALSE;
 }
 
 /* IMPLEMENTATION: Public API */
@@ -2061,6 +2390,216 @@ GAppInfo* esdashboard_desktop_app_info_new_from_menu_item(MarkonMenuItem *inMenu
 	return(G_APP_INFO(instance));
 }
 
+/* Create new instance from data stored in cache of application database.
+ * The desktop file is not parsed until data not stored in cache is needed,
+ * e.g. when launching the application.
+ */
+GAppInfo* esdashboard_desktop_app_info_new_from_cache_data(const gchar *inDesktopID,
+															GFile *inFile,
+															GVariant *inCacheData)
+{
+	EsdashboardDesktopAppInfo			*instance;
+	EsdashboardDesktopAppInfoPrivate	*priv;
+	gchar								*name;
+	gchar								*comment;
+	gchar								*command;
+	gchar								*iconName;
+	gboolean							noDisplay;
+	gchar								**onlyShowIn;
+	gchar								**notShowIn;
+	const gchar							*tryExec;
+	GVariant							*keywords;
+	GVariant							*actions;
+
+	g_return_val_if_fail(inDesktopID && *inDesktopID, NULL);
+	g_return_val_if_fail(G_IS_FILE(inFile), NULL);
+	g_return_val_if_fail(inCacheData && g_variant_is_of_type(inCacheData, ESDASHBOARD_DESKTOP_APP_INFO_CACHE_DATA_TYPE), NULL);
+
+	/* Create this class instance but set file directly to prevent the
+	 * property setter function _esdashboard_desktop_app_info_set_file
+	 * to be called which would load menu item from desktop file.
+	 */
+	instance=ESDASHBOARD_DESKTOP_APP_INFO(g_object_new(ESDASHBOARD_TYPE_DESKTOP_APP_INFO,
+														"desktop-id", inDesktopID,
+														NULL));
+	priv=instance->priv;
+
+	priv->file=G_FILE(g_object_ref(inFile));
+
+	/* Take values from cache */
+	g_variant_get(inCacheData,
+					"(msmsmsmsb^as^asm&s@as@a(smsms))",
+					&name,
+					&comment,
+					&command,
+					&iconName,
+					&noDisplay,
+					&onlyShowIn,
+					&notShowIn,
+					&tryExec,
+					&keywords,
+					&actions);
+
+	priv->cachedName=name;
+	priv->cachedComment=comment;
+	priv->cachedCommand=command;
+	priv->cachedIconName=iconName;
+	priv->cachedVisible=_esdashboard_desktop_app_info_get_visible_from_values(noDisplay, onlyShowIn, notShowIn, tryExec);
+	priv->hasCachedValues=TRUE;
+
+	/* Keep keywords and application actions as raw values until they are
+	 * loaded on-demand. They refer to the data of the cache and do not
+	 * need to be copied.
+	 */
+	_esdashboard_desktop_app_info_set_raw_value(&priv->rawKeywords, keywords);
+	_esdashboard_desktop_app_info_set_raw_value(&priv->rawActions, actions);
+
+	/* Get path to executable file for this application */
+	_esdashboard_desktop_app_info_update_binary_executable(instance);
+
+	/* Desktop app info is inited and valid now as only valid ones are cached */
+	priv->inited=TRUE;
+	priv->isValid=TRUE;
+
+	/* Release allocated resources */
+	g_strfreev(onlyShowIn);
+	g_strfreev(notShowIn);
+	g_variant_unref(keywords);
+	g_variant_unref(actions);
+
+	/* Return created instance */
+	return(G_APP_INFO(instance));
+}
+
+/* Get data of desktop app info to store in cache of application database.
+ * Keywords and application actions not loaded yet are taken from raw values,
+ * so they are still loaded on-demand only.
+ * Returns a floating reference to a GVariant of type
+ * ESDASHBOARD_DESKTOP_APP_INFO_CACHE_DATA_TYPE or NULL if it is invalid or
+ * its desktop file cannot be read.
+ */
+GVariant* esdashboard_desktop_app_info_get_cache_data(EsdashboardDesktopAppInfo *self)
+{
+	EsdashboardDesktopAppInfoPrivate	*priv;
+	GAppInfo							*appInfo;
+	GVariantBuilder						keywords;
+	GVariantBuilder						actions;
+	GList								*iter;
+	const gchar							*iconName;
+	gboolean							noDisplay;
+	gchar								**onlyShowIn;
+	gchar								**notShowIn;
+	gchar								*tryExec;
+	GVariant							*result;
+	const gchar							*emptyList[]={ NULL };
+
+	g_return_val_if_fail(ESDASHBOARD_IS_DESKTOP_APP_INFO(self), NULL);
+
+	priv=self->priv;
+
+	/* Only valid desktop app infos can be cached */
+	if(!priv->isValid ||
+		(!priv->hasCachedValues && !priv->item))
+	{
+		return(NULL);
+	}
+
+	appInfo=G_APP_INFO(self);
+
+	/* Get values from desktop file which visibility of application depends on.
+	 * The visibility itself is not stored as it depends on the environment.
+	 */
+	if(!_esdashboard_desktop_app_info_load_secondary_source(self)) return(NULL);
+
+	noDisplay=g_key_file_get_boolean(priv->secondarySource, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_NO_DISPLAY, NULL);
+	onlyShowIn=g_key_file_get_string_list(priv->secondarySource, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_ONLY_SHOW_IN, NULL, NULL);
+	notShowIn=g_key_file_get_string_list(priv->secondarySource, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_NOT_SHOW_IN, NULL, NULL);
+	tryExec=g_key_file_get_string(priv->secondarySource, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_TRY_EXEC, NULL);
+
+	/* Get raw values of keywords and actions if they were not loaded yet.
+	 * This releases the secondary source also, otherwise release it now.
+	 */
+	_esdashboard_desktop_app_info_load_raw_values(self);
+	_esdashboard_desktop_app_info_release_secondary_source(self);
+
+	/* Collect keywords and actions */
+	g_variant_builder_init(&keywords, G_VARIANT_TYPE("as"));
+	if(priv->needKeywords && priv->rawKeywords)
+	{
+		GVariantIter					rawIter;
+		GVariant						*value;
+
+		g_variant_iter_init(&rawIter, priv->rawKeywords);
+		while((value=g_variant_iter_next_value(&rawIter)))
+		{
+			g_variant_builder_add_value(&keywords, value);
+			g_variant_unref(value);
+		}
+	}
+		else
+		{
+			for(iter=esdashboard_desktop_app_info_get_keywords(self); iter; iter=g_list_next(iter))
+			{
+				g_variant_builder_add(&keywords, "s", (const gchar*)iter->data);
+			}
+		}
+
+	g_variant_builder_init(&actions, G_VARIANT_TYPE("a(smsms)"));
+	if(priv->needActions && priv->rawActions)
+	{
+		GVariantIter					rawIter;
+		GVariant						*value;
+
+		g_variant_iter_init(&rawIter, priv->rawActions);
+		while((value=g_variant_iter_next_value(&rawIter)))
+		{
+			g_variant_builder_add_value(&actions, value);
+			g_variant_unref(value);
+		}
+	}
+		else
+		{
+			for(iter=esdashboard_desktop_app_info_get_actions(self); iter; iter=g_list_next(iter))
+			{
+				EsdashboardDesktopAppInfoAction	*action;
+
+				action=ESDASHBOARD_DESKTOP_APP_INFO_ACTION(iter->data);
+				if(!esdashboard_desktop_app_info_action_get_name(action)) continue;
+
+				g_variant_builder_add(&actions,
+										"(smsms)",
+										esdashboard_desktop_app_info_action_get_name(action),
+										esdashboard_desktop_app_info_action_get_icon_name(action),
+										esdashboard_desktop_app_info_action_get_command(action));
+			}
+		}
+
+	/* Get icon name as stored in desktop file */
+	if(priv->hasCachedValues) iconName=priv->cachedIconName;
+		else iconName=markon_menu_item_get_icon_name(priv->item);
+
+	/* Build data to cache */
+	result=g_variant_new("(msmsmsmsb^as^asmsasa(smsms))",
+							g_app_info_get_name(appInfo),
+							g_app_info_get_description(appInfo),
+							g_app_info_get_commandline(appInfo),
+							iconName,
+							noDisplay,
+							onlyShowIn ? (const gchar**)onlyShowIn : emptyList,
+							notShowIn ? (const gchar**)notShowIn : emptyList,
+							tryExec,
+							&keywords,
+							&actions);
+
+	/* Release allocated resources */
+	if(onlyShowIn) g_strfreev(onlyShowIn);
+	if(notShowIn) g_strfreev(notShowIn);
+	if(tryExec) g_free(tryExec);
+
+	/* Return data to cache */
+	return(result);
+}
+
 /* Determine if desktop app info is valid */
 gboolean esdashboard_desktop_app_info_is_valid(EsdashboardDesktopAppInfo *self)
 {
@@ -2089,12 +2628,18 @@ gboolean esdashboard_desktop_app_info_reload(EsdashboardDesktopAppInfo *self)
 	success=FALSE;
 
 	/* Release secondary source if available to enforce reload when updating
-	 * data depending secondard source.
+	 * data depending secondard source. Raw values may be outdated also.
 	 */
-	if(priv->secondarySource)
+	_esdashboard_desktop_app_info_release_secondary_source(self);
+	_esdashboard_desktop_app_info_release_raw_values(self);
+
+	/* If values were taken from cache load menu item now and drop cached
+	 * values as they may be outdated.
+	 */
+	if(priv->hasCachedValues)
 	{
-		g_key_file_unref(priv->secondarySource);
-		priv->secondarySource=NULL;
+		_esdashboard_desktop_app_info_ensure_item(self);
+		_esdashboard_desktop_app_info_clear_cached_values(self);
 	}
 
 	/* Reload menu item */
@@ -2198,6 +2743,9 @@ gboolean esdashboard_desktop_app_info_launch_action_by_name(EsdashboardDesktopAp
 
 	priv=self->priv;
 
+	/* Update list of application actions */
+	_esdashboard_desktop_app_info_update_actions(self);
+
 	/* Find application action data by name */
 	action=NULL;
 	for(iter=priv->actions; iter && !action; iter=g_list_next(iter))
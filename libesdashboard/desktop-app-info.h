@@ -34,6 +34,11 @@
 
 G_BEGIN_DECLS
 
+/* Public definitions */
+#define ESDASHBOARD_DESKTOP_APP_INFO_CACHE_DATA_TYPE_STRING	"(msmsmsmsbasasmsasa(smsms))"
+#define ESDASHBOARD_DESKTOP_APP_INFO_CACHE_DATA_TYPE			(G_VARIANT_TYPE(ESDASHBOARD_DESKTOP_APP_INFO_CACHE_DATA_TYPE_STRING))
+
+/* Object declaration */
 #define ESDASHBOARD_TYPE_DESKTOP_APP_INFO				(esdashboard_desktop_app_info_get_type())
 #define ESDASHBOARD_DESKTOP_APP_INFO(obj)				(G_TYPE_CHECK_INSTANCE_CAST((obj), ESDASHBOARD_TYPE_DESKTOP_APP_INFO, EsdashboardDesktopAppInfo))
 #define ESDASHBOARD_IS_DESKTOP_APP_INFO(obj)			(G_TYPE_CHECK_INSTANCE_TYPE((obj), ESDASHBOARD_TYPE_DESKTOP_APP_INFO))
@@ -73,6 +78,11 @@ GAppInfo* esdashboard_desktop_app_info_new_from_desktop_id(const gchar *inDeskto
 GAppInfo* esdashboard_desktop_app_info_new_from_path(const gchar *inPath);
 GAppInfo* esdashboard_desktop_app_info_new_from_file(GFile *inFile);
 GAppInfo* esdashboard_desktop_app_info_new_from_menu_item(MarkonMenuItem *inMenuItem);
+GAppInfo* esdashboard_desktop_app_info_new_from_cache_data(const gchar *inDesktopID,
+															GFile *inFile,
+															GVariant *inCacheData);
+
+GVariant* esdashboard_desktop_app_info_get_cache_data(EsdashboardDesktopAppInfo *self);
 
 gboolean esdashboard_desktop_app_info_is_valid(EsdashboardDesktopAppInfo *self);
 
@@ -1106,3 +1106,57 @@ void esdashboard_dynamic_table_layout_set_fixed_columns(EsdashboardDynamicTableL
 		clutter_layout_manager_layout_changed(CLUTTER_LAYOUT_MANAGER(self));
 	}
 }
+
+/* Determine number of columns and width of each column for a number of children
+ * all having the same natural width without the need of having these children
+ * in a container, e.g. to lay out only a visible part of a large number of items.
+ */
+gint esdashboard_dynamic_table_layout_compute_columns(EsdashboardDynamicTableLayout *self,
+														gint inNumberChildren,
+														gfloat inWidth,
+														gfloat inChildWidth,
+														gfloat *outColumnWidth)
+{
+	EsdashboardDynamicTableLayoutPrivate	*priv;
+	gint									columns;
+	gfloat									width;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_DYNAMIC_TABLE_LAYOUT(self), 0);
+	g_return_val_if_fail(inNumberChildren>=0, 0);
+
+	priv=self->priv;
+
+	/* Without children or available width there are no columns */
+	if(inNumberChildren==0 || inWidth<=0.0f)
+	{
+		if(outColumnWidth) *outColumnWidth=0.0f;
+		return(0);
+	}
+
+	/* Determine number of columns and width of columns in the same way as
+	 * the layout data is determined in fixed and dynamic mode.
+	 */
+	if(priv->fixedColumns>0)
+	{
+		columns=priv->fixedColumns;
+		width=inWidth/columns;
+	}
+		else
+		{
+			if(inChildWidth>0.0f) columns=MIN(ceil(inWidth/inChildWidth), inNumberChildren)+1;
+				else columns=inNumberChildren+1;
+
+			do
+			{
+				columns--;
+				width=(columns*inChildWidth)+((columns-1)*priv->columnSpacing);
+			}
+			while(columns>1 && width>inWidth);
+
+			width=floor(inWidth-((columns-1)*priv->columnSpacing))/columns;
+		}
+
+	/* Return number of columns and width of a column */
+	if(outColumnWidth) *outColumnWidth=width;
+	return(columns);
+}
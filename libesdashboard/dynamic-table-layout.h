@@ -83,6 +83,12 @@ void esdashboard_dynamic_table_layout_set_column_spacing(EsdashboardDynamicTable
 gint esdashboard_dynamic_table_layout_get_fixed_columns(EsdashboardDynamicTableLayout *self);
 void esdashboard_dynamic_table_layout_set_fixed_columns(EsdashboardDynamicTableLayout *self, gint inColumns);
 
+gint esdashboard_dynamic_table_layout_compute_columns(EsdashboardDynamicTableLayout *self,
+														gint inNumberChildren,
+														gfloat inWidth,
+														gfloat inChildWidth,
+														gfloat *outColumnWidth);
+
 G_END_DECLS
 
 #endif	/* __LIBESDASHBOARD_DYNAMIC_TABLE_LAYOUT__ */
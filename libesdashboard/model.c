@@ -44,6 +44,8 @@ struct _EsdashboardModelPrivate
 	EsdashboardModelFilterFunc	filterCallback;
 	gpointer					filterUserData;
 	GDestroyNotify				filterUserDataDestroyCallback;
+
+	GArray						*filteredRows;
 };
 
 G_DEFINE_TYPE_WITH_PRIVATE(EsdashboardModel,
@@ -93,6 +95,18 @@ static guint EsdashboardModelSignals[SIGNAL_LAST]={ 0, };
 
 /* IMPLEMENTATION: Private variables and methods */
 
+/* Real layout of public structure EsdashboardModelRowIter */
+typedef struct _EsdashboardModelRealRowIter		EsdashboardModelRealRowIter;
+struct _EsdashboardModelRealRowIter
+{
+	EsdashboardModel			*model;
+	GSequenceIter				*iter;
+	gint						row;
+	gint						filteredIndex;
+};
+
+G_STATIC_ASSERT(sizeof(EsdashboardModelRealRowIter)==sizeof(EsdashboardModelRowIter));
+
 typedef struct _EsdashboardModelSortData			EsdashboardModelSortData;
 struct _EsdashboardModelSortData
 {
@@ -179,6 +193,100 @@ static gint _esdashboard_model_sort_internal(GSequenceIter *inLeft,
 	return(result);
 }
 
+/* Invalidate cached list of rows not filtered. It is rebuilt on next access */
+static void _esdashboard_model_invalidate_filtered_rows(EsdashboardModel *self)
+{
+	EsdashboardModelPrivate			*priv;
+
+	g_return_if_fail(ESDASHBOARD_IS_MODEL(self));
+
+	priv=self->priv;
+
+	if(priv->filteredRows)
+	{
+		g_array_free(priv->filteredRows, TRUE);
+		priv->filteredRows=NULL;
+	}
+}
+
+/* Get list of rows not filtered in ascending order. The user supplied filter
+ * callback function is only called for each row if the list is not cached,
+ * i.e. if the filter or the model's data has changed since last access.
+ */
+static GArray* _esdashboard_model_get_filtered_rows(EsdashboardModel *self)
+{
+	EsdashboardModelPrivate			*priv;
+	EsdashboardModelIter			*iter;
+	GSequenceIter					*seqIter;
+	gint							row;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_MODEL(self), NULL);
+	g_return_val_if_fail(self->priv->filterCallback, NULL);
+
+	priv=self->priv;
+
+	/* Return cached list if available */
+	if(priv->filteredRows) return(priv->filteredRows);
+
+	/* Call user supplied filter callback function for each row. Only one
+	 * iterator is created and updated for each row as done when sorting.
+	 */
+	priv->filteredRows=g_array_sized_new(FALSE, FALSE, sizeof(gint), g_sequence_get_length(priv->data));
+
+	iter=esdashboard_model_iter_new(self);
+	seqIter=g_sequence_get_begin_iter(priv->data);
+	row=0;
+	while(!g_sequence_iter_is_end(seqIter))
+	{
+		iter->priv->iter=seqIter;
+		if((priv->filterCallback)(iter, priv->filterUserData))
+		{
+			g_array_append_val(priv->filteredRows, row);
+		}
+
+		seqIter=g_sequence_iter_next(seqIter);
+		row++;
+	}
+
+	/* Release allocated resources */
+	if(iter) g_object_unref(iter);
+
+	/* Return newly built list */
+	return(priv->filteredRows);
+}
+
+/* Check if requested row is in list of rows not filtered */
+static gboolean _esdashboard_model_is_filtered_row_visible(EsdashboardModel *self, gint inRow)
+{
+	GArray							*filteredRows;
+	gint							left, right, middle;
+	gint							row;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_MODEL(self), FALSE);
+
+	/* Without filter function every row is visible */
+	if(!self->priv->filterCallback) return(TRUE);
+
+	/* Do binary search as rows are stored in ascending order */
+	filteredRows=_esdashboard_model_get_filtered_rows(self);
+
+	left=0;
+	right=filteredRows->len-1;
+	while(left<=right)
+	{
+		middle=left+((right-left)/2);
+		row=g_array_index(filteredRows, gint, middle);
+
+		if(row==inRow) return(TRUE);
+
+		if(row<inRow) left=middle+1;
+			else right=middle-1;
+	}
+
+	/* If we get here the row was not found so it is filtered */
+	return(FALSE);
+}
+
 /* IMPLEMENTATION: GObject */
 
 /* Dispose this object of type EsdashboardModel */
@@ -206,6 +314,8 @@ static void _esdashboard_model_dispose(GObject *inObject)
 	priv->filterUserData=NULL;
 	priv->filterCallback=NULL;
 
+	_esdashboard_model_invalidate_filtered_rows(self);
+
 	if(priv->data)
 	{
 		g_sequence_free(priv->data);
@@ -388,6 +498,8 @@ static void esdashboard_model_init(EsdashboardModel *self)
 	priv->filterCallback=NULL;
 	priv->filterUserData=NULL;
 	priv->filterUserDataDestroyCallback=NULL;
+
+	priv->filteredRows=NULL;
 }
 
 /* Dispose this object of type EsdashboardModelIter */
@@ -498,6 +610,7 @@ gboolean esdashboard_model_append(EsdashboardModel *self,
 
 	/* Append data to model's data */
 	seqIter=g_sequence_append(priv->data, inData);
+	_esdashboard_model_invalidate_filtered_rows(self);
 
 	/* Create iterator for returned sequence iterator */
 	iter=esdashboard_model_iter_new(self);
@@ -532,6 +645,7 @@ gboolean esdashboard_model_prepend(EsdashboardModel *self,
 
 	/* Append data to model's data */
 	seqIter=g_sequence_prepend(priv->data, inData);
+	_esdashboard_model_invalidate_filtered_rows(self);
 
 	/* Create iterator for returned sequence iterator */
 	iter=esdashboard_model_iter_new(self);
@@ -574,6 +688,7 @@ gboolean esdashboard_model_insert(EsdashboardModel *self,
 
 	/* Insert data at "insert iterator" at model's data */
 	seqIter=g_sequence_insert_before(insertIter, inData);
+	_esdashboard_model_invalidate_filtered_rows(self);
 
 	/* Create iterator for returned sequence iterator */
 	iter=esdashboard_model_iter_new(self);
@@ -624,6 +739,7 @@ gboolean esdashboard_model_set(EsdashboardModel *self,
 
 	/* Set new data at iterator */
 	g_sequence_set(seqIter, inData);
+	_esdashboard_model_invalidate_filtered_rows(self);
 
 	/* Create iterator for returned sequence iterator */
 	iter=esdashboard_model_iter_new(self);
@@ -680,6 +796,7 @@ gboolean esdashboard_model_remove(EsdashboardModel *self, gint inRow)
 
 	/* Remove data from model's data */
 	g_sequence_remove(seqIter);
+	_esdashboard_model_invalidate_filtered_rows(self);
 
 	/* Release allocated resources */
 	if(iter) g_object_unref(iter);
@@ -729,6 +846,7 @@ void esdashboard_model_remove_all(EsdashboardModel *self)
 
 		/* Remove data from model's data */
 		g_sequence_remove(iter->priv->iter);
+		_esdashboard_model_invalidate_filtered_rows(self);
 
 		/* Move iterator to next item in model's data */
 		iter->priv->iter=g_sequence_iter_next(iter->priv->iter);
@@ -738,6 +856,48 @@ void esdashboard_model_remove_all(EsdashboardModel *self)
 	if(iter) g_object_unref(iter);
 }
 
+/* Replace all data in model's data with the items in array at once. The model
+ * takes ownership of the items but not of the array. No signal is emitted for
+ * the rows removed and added, so the caller has to notify about the new data
+ * itself, e.g. by a signal of its own when done.
+ */
+void esdashboard_model_replace_all(EsdashboardModel *self, GPtrArray *inData)
+{
+	EsdashboardModelPrivate			*priv;
+	GSequence						*oldData;
+	GSequenceIter					*seqIter;
+	guint							i;
+
+	g_return_if_fail(ESDASHBOARD_IS_MODEL(self));
+	g_return_if_fail(inData);
+
+	priv=self->priv;
+
+	/* Swap in new data */
+	oldData=priv->data;
+
+	priv->data=g_sequence_new(NULL);
+	for(i=0; i<inData->len; i++)
+	{
+		g_sequence_append(priv->data, g_ptr_array_index(inData, i));
+	}
+	_esdashboard_model_invalidate_filtered_rows(self);
+
+	/* If a function is provided to free data call it with each item of old data */
+	if(priv->freeDataCallback)
+	{
+		for(seqIter=g_sequence_get_begin_iter(oldData);
+			!g_sequence_iter_is_end(seqIter);
+			seqIter=g_sequence_iter_next(seqIter))
+		{
+			(priv->freeDataCallback)(g_sequence_get(seqIter));
+		}
+	}
+
+	/* Release allocated resources */
+	g_sequence_free(oldData);
+}
+
 /* Iterate through all items in model's data and call user supplied callback
  * function for each item.
  */
@@ -874,6 +1034,7 @@ void esdashboard_model_resort(EsdashboardModel *self)
 	 * calls user's sort function with adjusted parameters.
 	 */
 	g_sequence_sort_iter(priv->data, _esdashboard_model_sort_internal, &sortData);
+	_esdashboard_model_invalidate_filtered_rows(self);
 
 	/* Release allocated resources */
 	if(sortData.model) g_object_unref(sortData.model);
@@ -937,6 +1098,9 @@ void esdashboard_model_set_filter(EsdashboardModel *self,
 		priv->filterUserData=inUserData;
 		priv->filterUserDataDestroyCallback=inUserDataDestroyCallback;
 
+		/* Forget rows not filtered by previous filter function */
+		_esdashboard_model_invalidate_filtered_rows(self);
+
 		/* Get new "sort-set" value to determine if this property has
 		 * changed also.
 		 */
@@ -955,36 +1119,71 @@ void esdashboard_model_set_filter(EsdashboardModel *self,
 	}
 }
 
+/* Filter this model's data again with filter function set, e.g. if state
+ * the filter function depends on has changed.
+ */
+void esdashboard_model_refilter(EsdashboardModel *self)
+{
+	g_return_if_fail(ESDASHBOARD_IS_MODEL(self));
+
+	/* If no filter function is set return immediately because nothing is
+	 * filtered in this model.
+	 */
+	if(!self->priv->filterCallback) return;
+
+	/* Forget cached rows not filtered and emit signal that filter has changed */
+	_esdashboard_model_invalidate_filtered_rows(self);
+	g_signal_emit(self, EsdashboardModelSignals[SIGNAL_FILTER_CHANGED], 0);
+}
+
 /* Check if requested row is filtered */
 gboolean esdashboard_model_filter_row(EsdashboardModel *self, gint inRow)
 {
-	EsdashboardModelPrivate			*priv;
-	EsdashboardModelIter			*iter;
-	gboolean						isVisible;
-
 	g_return_val_if_fail(ESDASHBOARD_IS_MODEL(self), FALSE);
 	g_return_val_if_fail(_esdashboard_model_is_valid_row(self, inRow), FALSE);
 
+	/* Look up row in cached list of rows not filtered */
+	return(_esdashboard_model_is_filtered_row_visible(self, inRow));
+}
+
+/* Get number of rows not filtered */
+gint esdashboard_model_get_filtered_rows_count(EsdashboardModel *self)
+{
+	EsdashboardModelPrivate			*priv;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_MODEL(self), 0);
+
 	priv=self->priv;
-	isVisible=TRUE;
 
-	/* Call user supplied filter callback function to determine if this
-	 * row should be filtered or not but only if filter function is set.
-	 */
-	if(priv->filterCallback)
-	{
-		/* Create iterator */
-		iter=esdashboard_model_iter_new_for_row(self, inRow);
+	/* Without filter function no row is filtered */
+	if(!priv->filterCallback) return(g_sequence_get_length(priv->data));
+
+	return(_esdashboard_model_get_filtered_rows(self)->len);
+}
+
+/* Get row in model's data of requested index in list of rows not filtered */
+gint esdashboard_model_get_filtered_row(EsdashboardModel *self, gint inIndex)
+{
+	EsdashboardModelPrivate			*priv;
+	GArray							*filteredRows;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_MODEL(self), -1);
+	g_return_val_if_fail(inIndex>=0, -1);
 
-		/* Determine if row is filtered */
-		isVisible=(priv->filterCallback)(iter, priv->filterUserData);
+	priv=self->priv;
 
-		/* Release allocated resources */
-		if(iter) g_object_unref(iter);
+	/* Without filter function no row is filtered */
+	if(!priv->filterCallback)
+	{
+		if(!_esdashboard_model_is_valid_row(self, inIndex)) return(-1);
+		return(inIndex);
 	}
 
-	/* Return filter status */
-	return(isVisible);
+	/* Look up row in cached list of rows not filtered */
+	filteredRows=_esdashboard_model_get_filtered_rows(self);
+	if(inIndex>=(gint)filteredRows->len) return(-1);
+
+	return(g_array_index(filteredRows, gint, inIndex));
 }
 
 /* Create iterator for model */
@@ -1221,6 +1420,7 @@ gboolean esdashboard_model_iter_set(EsdashboardModelIter *self, gpointer inData)
 
 	/* Set new data at iterator */
 	g_sequence_set(priv->iter, inData);
+	_esdashboard_model_invalidate_filtered_rows(priv->model);
 
 	/* Emit signal */
 	g_signal_emit(self, EsdashboardModelSignals[SIGNAL_ROW_CHANGED], 0, self);
@@ -1261,6 +1461,7 @@ gboolean esdashboard_model_iter_remove(EsdashboardModelIter *self)
 
 	/* Remove data from model's data */
 	g_sequence_remove(priv->iter);
+	_esdashboard_model_invalidate_filtered_rows(priv->model);
 
 	/* Return TRUE for success */
 	return(TRUE);
@@ -1270,24 +1471,120 @@ gboolean esdashboard_model_iter_remove(EsdashboardModelIter *self)
 gboolean esdashboard_model_iter_filter(EsdashboardModelIter *self)
 {
 	EsdashboardModelIterPrivate		*priv;
-	EsdashboardModelPrivate			*modelPriv;
-	gboolean						isVisible;
 
 	g_return_val_if_fail(_esdashboard_model_iter_is_valid(self, TRUE), FALSE);
 
 	priv=self->priv;
-	modelPriv=priv->model->priv;
-	isVisible=TRUE;
 
-	/* Call user supplied filter callback function to determine if this
-	 * row should be filtered or not but only if filter function is set.
-	 */
-	if(modelPriv->filterCallback)
-	{
-		/* Determine if row is filtered */
-		isVisible=(modelPriv->filterCallback)(self, modelPriv->filterUserData);
-	}
+	/* Look up row in cached list of rows not filtered */
+	return(_esdashboard_model_is_filtered_row_visible(priv->model, g_sequence_iter_get_position(priv->iter)));
+}
+
+
+/* IMPLEMENTATION: Public API of EsdashboardModelRowIter */
+
+/* Initialize row iterator for model. A row iterator is a lightweight structure
+ * which is usually allocated on stack and does not need to be freed. It holds
+ * no reference on model and it becomes invalid if the model changes.
+ */
+void esdashboard_model_row_iter_init(EsdashboardModelRowIter *self, EsdashboardModel *inModel)
+{
+	EsdashboardModelRealRowIter		*realIter;
+
+	g_return_if_fail(self);
+	g_return_if_fail(ESDASHBOARD_IS_MODEL(inModel));
+
+	realIter=(EsdashboardModelRealRowIter*)self;
+
+	/* Set up iterator pointing before first row */
+	realIter->model=inModel;
+	realIter->iter=NULL;
+	realIter->row=-1;
+	realIter->filteredIndex=-1;
+}
+
+/* Move row iterator to next row in model's data */
+gboolean esdashboard_model_row_iter_next(EsdashboardModelRowIter *self)
+{
+	EsdashboardModelRealRowIter		*realIter;
+	GSequenceIter					*newIter;
+
+	g_return_val_if_fail(self, FALSE);
+
+	realIter=(EsdashboardModelRealRowIter*)self;
+	g_return_val_if_fail(ESDASHBOARD_IS_MODEL(realIter->model), FALSE);
+
+	/* Get iterator to first row if not iterated yet otherwise to next row */
+	if(!realIter->iter) newIter=g_sequence_get_begin_iter(realIter->model->priv->data);
+		else newIter=g_sequence_iter_next(realIter->iter);
+
+	/* If end of model's data is reached return FALSE here */
+	if(g_sequence_iter_is_end(newIter)) return(FALSE);
+
+	/* Set new position */
+	realIter->iter=newIter;
+	realIter->row++;
+
+	return(TRUE);
+}
+
+/* Move row iterator to next row in model's data which is not filtered.
+ * Do not mix with esdashboard_model_row_iter_next() at the same iterator.
+ */
+gboolean esdashboard_model_row_iter_next_filtered(EsdashboardModelRowIter *self)
+{
+	EsdashboardModelRealRowIter		*realIter;
+	GArray							*filteredRows;
+	gint							newRow;
+
+	g_return_val_if_fail(self, FALSE);
+
+	realIter=(EsdashboardModelRealRowIter*)self;
+	g_return_val_if_fail(ESDASHBOARD_IS_MODEL(realIter->model), FALSE);
+
+	/* Without filter function no row is filtered */
+	if(!realIter->model->priv->filterCallback) return(esdashboard_model_row_iter_next(self));
+
+	/* Get next row from cached list of rows not filtered */
+	filteredRows=_esdashboard_model_get_filtered_rows(realIter->model);
+	if(realIter->filteredIndex+1>=(gint)filteredRows->len) return(FALSE);
+
+	realIter->filteredIndex++;
+	newRow=g_array_index(filteredRows, gint, realIter->filteredIndex);
+
+	/* Move to row found */
+	if(!realIter->iter) realIter->iter=g_sequence_get_iter_at_pos(realIter->model->priv->data, newRow);
+		else realIter->iter=g_sequence_iter_move(realIter->iter, newRow-realIter->row);
+	realIter->row=newRow;
+
+	return(TRUE);
+}
+
+/* Get model of row iterator */
+EsdashboardModel* esdashboard_model_row_iter_get_model(EsdashboardModelRowIter *self)
+{
+	g_return_val_if_fail(self, NULL);
+
+	return(((EsdashboardModelRealRowIter*)self)->model);
+}
+
+/* Get row at model's data this row iterator points to currently */
+gint esdashboard_model_row_iter_get_row(EsdashboardModelRowIter *self)
+{
+	g_return_val_if_fail(self, -1);
+
+	return(((EsdashboardModelRealRowIter*)self)->row);
+}
+
+/* Get item at position of row iterator */
+gpointer esdashboard_model_row_iter_get(EsdashboardModelRowIter *self)
+{
+	EsdashboardModelRealRowIter		*realIter;
+
+	g_return_val_if_fail(self, NULL);
+
+	realIter=(EsdashboardModelRealRowIter*)self;
+	g_return_val_if_fail(realIter->iter, NULL);
 
-	/* Return filter status */
-	return(isVisible);
+	return(g_sequence_get(realIter->iter));
 }
@@ -107,6 +107,19 @@ struct _EsdashboardModelClass
 };
 
 
+/* Structure declaration: EsdashboardModelRowIter */
+typedef struct _EsdashboardModelRowIter		EsdashboardModelRowIter;
+
+struct _EsdashboardModelRowIter
+{
+	/*< private >*/
+	gpointer						dummy1;
+	gpointer						dummy2;
+	gint							dummy3;
+	gint							dummy4;
+};
+
+
 /* Public API */
 typedef void (*EsdashboardModelForeachFunc)(EsdashboardModelIter *inIter,
 											gpointer inData,
@@ -114,6 +127,10 @@ typedef void (*EsdashboardModelForeachFunc)(EsdashboardModelIter *inIter,
 typedef gint (*EsdashboardModelSortFunc)(EsdashboardModelIter *inLeftIter,
 											EsdashboardModelIter *inRightIter,
 											gpointer inUserData);
+/* The result of the filter function is cached for each row until the model's
+ * data or the filter function changes. If the filter function depends on
+ * other state which changes, call esdashboard_model_refilter() afterwards.
+ */
 typedef gboolean (*EsdashboardModelFilterFunc)(EsdashboardModelIter *inIter,
 												gpointer inUserData);
 
@@ -147,6 +164,7 @@ gboolean esdashboard_model_set(EsdashboardModel *self,
 								EsdashboardModelIter **outIter);
 gboolean esdashboard_model_remove(EsdashboardModel *self, gint inRow);
 void esdashboard_model_remove_all(EsdashboardModel *self);
+void esdashboard_model_replace_all(EsdashboardModel *self, GPtrArray *inData);
 
 /* Model foreach functions */
 void esdashboard_model_foreach(EsdashboardModel *self,
@@ -167,7 +185,10 @@ void esdashboard_model_set_filter(EsdashboardModel *self,
 									EsdashboardModelFilterFunc inFilterCallback,
 									gpointer inUserData,
 									GDestroyNotify inUserDataDestroyCallback);
+void esdashboard_model_refilter(EsdashboardModel *self);
 gboolean esdashboard_model_filter_row(EsdashboardModel *self, gint inRow);
+gint esdashboard_model_get_filtered_rows_count(EsdashboardModel *self);
+gint esdashboard_model_get_filtered_row(EsdashboardModel *self, gint inIndex);
 
 
 /* Model iterator functions */
@@ -192,6 +213,19 @@ gboolean esdashboard_model_iter_remove(EsdashboardModelIter *self);
 /* Model filter functions */
 gboolean esdashboard_model_iter_filter(EsdashboardModelIter *self);
 
+
+/* Model row iterator functions */
+void esdashboard_model_row_iter_init(EsdashboardModelRowIter *self, EsdashboardModel *inModel);
+gboolean esdashboard_model_row_iter_next(EsdashboardModelRowIter *self);
+gboolean esdashboard_model_row_iter_next_filtered(EsdashboardModelRowIter *self);
+
+/* Model row iterator information functions */
+EsdashboardModel* esdashboard_model_row_iter_get_model(EsdashboardModelRowIter *self);
+gint esdashboard_model_row_iter_get_row(EsdashboardModelRowIter *self);
+
+/* Model row iterator access functions */
+gpointer esdashboard_model_row_iter_get(EsdashboardModelRowIter *self);
+
 G_END_DECLS
 
 #endif	/* __LIBESDASHBOARD_MODEL__ */
@@ -40,6 +40,10 @@ struct _EsdashboardSearchProviderPrivate
 {
 	/* Properties related */
 	gchar					*providerID;
+	gdouble					latency;
+
+	/* Instance related */
+	gboolean				hasLatency;
 };
 
 G_DEFINE_ABSTRACT_TYPE_WITH_PRIVATE(EsdashboardSearchProvider,
@@ -52,6 +56,7 @@ enum
 	PROP_0,
 
 	PROP_PROVIDER_ID,
+	PROP_LATENCY,
 
 	PROP_LAST
 };
@@ -59,6 +64,8 @@ enum
 static GParamSpec* EsdashboardSearchProviderProperties[PROP_LAST]={ 0, };
 
 /* IMPLEMENTATION: Private variables and methods */
+#define ESDASHBOARD_SEARCH_PROVIDER_LATENCY_SMOOTHING		0.3
+
 #define ESDASHBOARD_SEARCH_PROVIDER_WARN_NOT_IMPLEMENTED(self, vfunc) \
 	g_warning("Search provider of type %s does not implement required virtual function EsdashboardSearchProvider::%s",\
 				G_OBJECT_TYPE_NAME(self), \
@@ -91,6 +98,246 @@ static void _esdashboard_search_provider_set_id(EsdashboardSearchProvider *self,
 	}
 }
 
+/* Data of task to get result set asynchronously by default implementation */
+typedef struct _EsdashboardSearchProviderResultSetTaskData		EsdashboardSearchProviderResultSetTaskData;
+struct _EsdashboardSearchProviderResultSetTaskData
+{
+	gchar						**searchTerms;
+	EsdashboardSearchResultSet	*previousResultSet;
+};
+
+static void _esdashboard_search_provider_result_set_task_data_free(EsdashboardSearchProviderResultSetTaskData *inData)
+{
+	g_return_if_fail(inData);
+
+	/* Release allocated resources */
+	if(inData->searchTerms) g_strfreev(inData->searchTerms);
+	if(inData->previousResultSet) g_object_unref(inData->previousResultSet);
+	g_free(inData);
+}
+
+/* Create a copy of result set containing the same items and scores. Result
+ * sets are not thread-safe, so a search in a worker thread gets its own copy
+ * of previous result set which is used by the caller in main loop.
+ */
+static EsdashboardSearchResultSet* _esdashboard_search_provider_copy_result_set(EsdashboardSearchResultSet *inResultSet)
+{
+	EsdashboardSearchResultSet					*copy;
+	GList										*items;
+	GList										*iter;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(inResultSet), NULL);
+
+	/* Add each item with its score to new result set */
+	copy=esdashboard_search_result_set_new();
+
+	items=esdashboard_search_result_set_get_all(inResultSet);
+	for(iter=items; iter; iter=g_list_next(iter))
+	{
+		GVariant								*item;
+
+		item=(GVariant*)iter->data;
+		esdashboard_search_result_set_add_item(copy, item);
+		esdashboard_search_result_set_set_item_score(copy,
+														item,
+														esdashboard_search_result_set_get_item_score(inResultSet, item));
+	}
+
+	/* Release allocated resources */
+	if(items) g_list_free_full(items, (GDestroyNotify)g_variant_unref);
+
+	/* Return copy of result set */
+	return(copy);
+}
+
+/* Search executor running searches of thread-safe search providers in a small
+ * pool of worker threads shared by all search providers. The result set is
+ * returned via the task so it is marshalled back to main loop of the caller.
+ */
+#define ESDASHBOARD_SEARCH_PROVIDER_EXECUTOR_MAX_THREADS		4
+
+static GThreadPool		*_esdashboard_search_provider_executor=NULL;
+G_LOCK_DEFINE_STATIC(_esdashboard_search_provider_executor_lock);
+
+static void _esdashboard_search_provider_executor_run(gpointer inData, gpointer inUserData)
+{
+	GTask										*task;
+	EsdashboardSearchProvider					*self;
+	EsdashboardSearchProviderResultSetTaskData	*data;
+	EsdashboardSearchResultSet					*resultSet;
+
+	g_return_if_fail(G_IS_TASK(inData));
+
+	task=G_TASK(inData);
+	self=ESDASHBOARD_SEARCH_PROVIDER(g_task_get_source_object(task));
+	data=(EsdashboardSearchProviderResultSetTaskData*)g_task_get_task_data(task);
+
+	/* Get result set and return it if task was not cancelled while it was queued */
+	if(!g_task_return_error_if_cancelled(task))
+	{
+		resultSet=esdashboard_search_provider_get_result_set(self,
+																(const gchar**)data->searchTerms,
+																data->previousResultSet);
+		g_task_return_pointer(task, resultSet, resultSet ? g_object_unref : NULL);
+	}
+
+	/* Release reference taken when task was pushed to executor */
+	g_object_unref(task);
+}
+
+static gboolean _esdashboard_search_provider_executor_push(GTask *inTask)
+{
+	GError										*error;
+	gboolean									success;
+
+	g_return_val_if_fail(G_IS_TASK(inTask), FALSE);
+
+	error=NULL;
+	success=FALSE;
+
+	/* Lock for thread-safety */
+	G_LOCK(_esdashboard_search_provider_executor_lock);
+
+	/* Create thread pool of executor if it does not exist yet. Keep one
+	 * processor free for main loop.
+	 */
+	if(!_esdashboard_search_provider_executor)
+	{
+		guint									maxThreads;
+
+		maxThreads=CLAMP(g_get_num_processors()-1, 1, ESDASHBOARD_SEARCH_PROVIDER_EXECUTOR_MAX_THREADS);
+		_esdashboard_search_provider_executor=g_thread_pool_new(_esdashboard_search_provider_executor_run,
+																NULL,
+																maxThreads,
+																FALSE,
+																&error);
+		if(!_esdashboard_search_provider_executor)
+		{
+			g_warning("Could not create thread pool for search executor: %s",
+						error ? error->message : "Unknown error");
+			goto done;
+		}
+
+		ESDASHBOARD_DEBUG(NULL, MISC,
+							"Created search executor with up to %u worker threads",
+							maxThreads);
+	}
+
+	/* Queue task at thread pool */
+	g_object_ref(inTask);
+	if(!g_thread_pool_push(_esdashboard_search_provider_executor, inTask, &error))
+	{
+		g_warning("Could not queue search at search executor: %s",
+					error ? error->message : "Unknown error");
+		g_object_unref(inTask);
+		goto done;
+	}
+
+	success=TRUE;
+
+done:
+	/* Unlock for thread-safety */
+	G_UNLOCK(_esdashboard_search_provider_executor_lock);
+
+	/* Release allocated resources */
+	if(error) g_error_free(error);
+
+	return(success);
+}
+
+/* Idle source of default implementation to get result set asynchronously was
+ * dispatched so get result set synchronously now if task was not cancelled.
+ */
+static gboolean _esdashboard_search_provider_get_result_set_async_on_idle(gpointer inUserData)
+{
+	GTask										*task;
+	EsdashboardSearchProvider					*self;
+	EsdashboardSearchProviderResultSetTaskData	*data;
+	EsdashboardSearchResultSet					*resultSet;
+
+	g_return_val_if_fail(G_IS_TASK(inUserData), G_SOURCE_REMOVE);
+
+	task=G_TASK(inUserData);
+	self=ESDASHBOARD_SEARCH_PROVIDER(g_task_get_source_object(task));
+	data=(EsdashboardSearchProviderResultSetTaskData*)g_task_get_task_data(task);
+
+	/* Do not search if task was cancelled in the meantime */
+	if(g_task_return_error_if_cancelled(task)) return(G_SOURCE_REMOVE);
+
+	/* Get result set and return it */
+	resultSet=esdashboard_search_provider_get_result_set(self,
+															(const gchar**)data->searchTerms,
+															data->previousResultSet);
+	g_task_return_pointer(task, resultSet, resultSet ? g_object_unref : NULL);
+
+	/* Do not call this callback again */
+	return(G_SOURCE_REMOVE);
+}
+
+/* Default implementation of virtual function "get_result_set_async". If the
+ * search provider is thread-safe the synchronous virtual function "get_result_set"
+ * is called in a worker thread of search executor. Otherwise it is deferred to
+ * an idle source in main loop, so each search provider gets its own iteration
+ * of main loop and events like key presses can be processed between search
+ * providers.
+ */
+static void _esdashboard_search_provider_real_get_result_set_async(EsdashboardSearchProvider *self,
+																	const gchar **inSearchTerms,
+																	EsdashboardSearchResultSet *inPreviousResultSet,
+																	GCancellable *inCancellable,
+																	GAsyncReadyCallback inCallback,
+																	gpointer inUserData)
+{
+	GTask										*task;
+	EsdashboardSearchProviderResultSetTaskData	*data;
+	GSource										*source;
+
+	/* Create task and store a copy of search terms and previous result set at it */
+	task=g_task_new(self, inCancellable, inCallback, inUserData);
+	g_task_set_source_tag(task, _esdashboard_search_provider_real_get_result_set_async);
+
+	data=g_new0(EsdashboardSearchProviderResultSetTaskData, 1);
+	data->searchTerms=g_strdupv((gchar**)inSearchTerms);
+	g_task_set_task_data(task, data, (GDestroyNotify)_esdashboard_search_provider_result_set_task_data_free);
+
+	/* Get result set in worker thread if search provider is thread-safe. The
+	 * worker thread gets a snapshot of previous result set taken here in main
+	 * thread as the caller keeps using the previous result set meanwhile.
+	 */
+	if(esdashboard_search_provider_is_thread_safe(self))
+	{
+		data->previousResultSet=(inPreviousResultSet ? _esdashboard_search_provider_copy_result_set(inPreviousResultSet) : NULL);
+		if(_esdashboard_search_provider_executor_push(task))
+		{
+			g_object_unref(task);
+			return;
+		}
+
+		/* Search could not be queued at executor so drop snapshot */
+		g_clear_object(&data->previousResultSet);
+	}
+
+	data->previousResultSet=(inPreviousResultSet ? g_object_ref(inPreviousResultSet) : NULL);
+
+	/* Get result set when main loop is idle */
+	source=g_idle_source_new();
+	g_source_set_priority(source, G_PRIORITY_DEFAULT_IDLE);
+	g_task_attach_source(task, source, _esdashboard_search_provider_get_result_set_async_on_idle);
+	g_source_unref(source);
+
+	/* Release allocated resources */
+	g_object_unref(task);
+}
+
+static EsdashboardSearchResultSet* _esdashboard_search_provider_real_get_result_set_finish(EsdashboardSearchProvider *self,
+																							GAsyncResult *inResult,
+																							GError **outError)
+{
+	g_return_val_if_fail(g_task_is_valid(inResult, self), NULL);
+
+	return(g_task_propagate_pointer(G_TASK(inResult), outError));
+}
+
 /* IMPLEMENTATION: GObject */
 
 /* Dispose this object */
@@ -143,6 +390,10 @@ static void _esdashboard_search_provider_get_property(GObject *inObject,
 			g_value_set_string(outValue, self->priv->providerID);
 			break;
 
+		case PROP_LATENCY:
+			g_value_set_double(outValue, self->priv->latency);
+			break;
+
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
 			break;
@@ -162,6 +413,9 @@ static void esdashboard_search_provider_class_init(EsdashboardSearchProviderClas
 	gobjectClass->get_property=_esdashboard_search_provider_get_property;
 	gobjectClass->dispose=_esdashboard_search_provider_dispose;
 
+	klass->get_result_set_async=_esdashboard_search_provider_real_get_result_set_async;
+	klass->get_result_set_finish=_esdashboard_search_provider_real_get_result_set_finish;
+
 	/* Define properties */
 	EsdashboardSearchProviderProperties[PROP_PROVIDER_ID]=
 		g_param_spec_string("provider-id",
@@ -170,6 +424,14 @@ static void esdashboard_search_provider_class_init(EsdashboardSearchProviderClas
 							NULL,
 							G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | G_PARAM_CONSTRUCT_ONLY);
 
+	EsdashboardSearchProviderProperties[PROP_LATENCY]=
+		g_param_spec_double("latency",
+							"Latency",
+							"The average time in milliseconds of recent searches at this search provider",
+							0.0, G_MAXDOUBLE,
+							0.0,
+							G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
 	g_object_class_install_properties(gobjectClass, PROP_LAST, EsdashboardSearchProviderProperties);
 }
 
@@ -184,6 +446,8 @@ static void esdashboard_search_provider_init(EsdashboardSearchProvider *self)
 
 	/* Set up default values */
 	priv->providerID=NULL;
+	priv->latency=0.0;
+	priv->hasLatency=FALSE;
 }
 
 /* IMPLEMENTATION: Public API */
@@ -253,6 +517,71 @@ const gchar* esdashboard_search_provider_get_icon(EsdashboardSearchProvider *sel
 	return(NULL);
 }
 
+/* Get average time in milliseconds of recent searches at search provider */
+gdouble esdashboard_search_provider_get_latency(EsdashboardSearchProvider *self)
+{
+	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_PROVIDER(self), 0.0);
+
+	return(self->priv->latency);
+}
+
+/* Add time in milliseconds a search took at search provider to its average
+ * time of recent searches. The average is an exponential moving average so
+ * recent searches are weighted more than older ones.
+ */
+void esdashboard_search_provider_add_latency_sample(EsdashboardSearchProvider *self, gdouble inLatency)
+{
+	EsdashboardSearchProviderPrivate	*priv;
+	gdouble								latency;
+
+	g_return_if_fail(ESDASHBOARD_IS_SEARCH_PROVIDER(self));
+	g_return_if_fail(inLatency>=0.0);
+
+	priv=self->priv;
+
+	/* Update average with new sample or take it if it is the first one */
+	if(priv->hasLatency)
+	{
+		latency=(ESDASHBOARD_SEARCH_PROVIDER_LATENCY_SMOOTHING*inLatency)+
+				((1.0-ESDASHBOARD_SEARCH_PROVIDER_LATENCY_SMOOTHING)*priv->latency);
+	}
+		else latency=inLatency;
+
+	priv->hasLatency=TRUE;
+
+	/* Set value if changed */
+	if(priv->latency!=latency)
+	{
+		priv->latency=latency;
+
+		/* Notify about property change */
+		g_object_notify_by_pspec(G_OBJECT(self), EsdashboardSearchProviderProperties[PROP_LATENCY]);
+	}
+}
+
+/* Check if search provider is thread-safe, i.e. its virtual function "get_result_set"
+ * can be called in any thread, so searches can be run in worker threads.
+ */
+gboolean esdashboard_search_provider_is_thread_safe(EsdashboardSearchProvider *self)
+{
+	EsdashboardSearchProviderClass	*klass;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_PROVIDER(self), FALSE);
+
+	klass=ESDASHBOARD_SEARCH_PROVIDER_GET_CLASS(self);
+
+	/* Return thread-safety of search provider */
+	if(klass->is_thread_safe)
+	{
+		return(klass->is_thread_safe(self));
+	}
+
+	/* If we get here the virtual function was not overridden so assume
+	 * the search provider is not thread-safe.
+	 */
+	return(FALSE);
+}
+
 /* Get result set for list of search terms from search provider. If a previous result set
  * is provided do an incremental search on basis of provided result set. The returned
  * result set must be a new allocated object and its entries must already be sorted
@@ -281,6 +610,62 @@ EsdashboardSearchResultSet* esdashboard_search_provider_get_result_set(Esdashboa
 	return(NULL);
 }
 
+/* Get result set for list of search terms from search provider asynchronously.
+ * When the search has finished the callback is called in thread-default main
+ * context of caller and esdashboard_search_provider_get_result_set_finish()
+ * must be called to get the result set. If the search is cancelled via the
+ * cancellable the finish function returns NULL and sets G_IO_ERROR_CANCELLED.
+ */
+void esdashboard_search_provider_get_result_set_async(EsdashboardSearchProvider *self,
+														const gchar **inSearchTerms,
+														EsdashboardSearchResultSet *inPreviousResultSet,
+														GCancellable *inCancellable,
+														GAsyncReadyCallback inCallback,
+														gpointer inUserData)
+{
+	EsdashboardSearchProviderClass	*klass;
+
+	g_return_if_fail(ESDASHBOARD_IS_SEARCH_PROVIDER(self));
+	g_return_if_fail(inSearchTerms);
+	g_return_if_fail(!inPreviousResultSet || ESDASHBOARD_IS_SEARCH_RESULT_SET(inPreviousResultSet));
+	g_return_if_fail(!inCancellable || G_IS_CANCELLABLE(inCancellable));
+
+	klass=ESDASHBOARD_SEARCH_PROVIDER_GET_CLASS(self);
+
+	/* Start getting result set of search provider */
+	if(klass->get_result_set_async)
+	{
+		klass->get_result_set_async(self, inSearchTerms, inPreviousResultSet, inCancellable, inCallback, inUserData);
+		return;
+	}
+
+	/* If we get here the virtual function was not overridden */
+	ESDASHBOARD_SEARCH_PROVIDER_WARN_NOT_IMPLEMENTED(self, "get_result_set_async");
+}
+
+EsdashboardSearchResultSet* esdashboard_search_provider_get_result_set_finish(EsdashboardSearchProvider *self,
+																				GAsyncResult *inResult,
+																				GError **outError)
+{
+	EsdashboardSearchProviderClass	*klass;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_PROVIDER(self), NULL);
+	g_return_val_if_fail(G_IS_ASYNC_RESULT(inResult), NULL);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, NULL);
+
+	klass=ESDASHBOARD_SEARCH_PROVIDER_GET_CLASS(self);
+
+	/* Return result set of search provider */
+	if(klass->get_result_set_finish)
+	{
+		return(klass->get_result_set_finish(self, inResult, outError));
+	}
+
+	/* If we get here the virtual function was not overridden */
+	ESDASHBOARD_SEARCH_PROVIDER_WARN_NOT_IMPLEMENTED(self, "get_result_set_finish");
+	return(NULL);
+}
+
 /* Returns an actor for requested result item */
 ClutterActor* esdashboard_search_provider_create_result_actor(EsdashboardSearchProvider *self,
 																GVariant *inResultItem)
@@ -303,6 +688,34 @@ ClutterActor* esdashboard_search_provider_create_result_actor(EsdashboardSearchP
 	return(NULL);
 }
 
+/* Rebinds an actor created by this search provider before to another result item
+ * so it can be reused instead of creating a new actor. Returns FALSE if the actor
+ * could not be updated and must not be used anymore.
+ */
+gboolean esdashboard_search_provider_update_result_actor(EsdashboardSearchProvider *self,
+															GVariant *inResultItem,
+															ClutterActor *inActor)
+{
+	EsdashboardSearchProviderClass	*klass;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_PROVIDER(self), FALSE);
+	g_return_val_if_fail(inResultItem, FALSE);
+	g_return_val_if_fail(CLUTTER_IS_ACTOR(inActor), FALSE);
+
+	klass=ESDASHBOARD_SEARCH_PROVIDER_GET_CLASS(self);
+
+	/* Update actor by search provider */
+	if(klass->update_result_actor)
+	{
+		return(klass->update_result_actor(self, inResultItem, inActor));
+	}
+
+	/* If we get here the virtual function was not overridden, so actors
+	 * cannot be reused by this search provider.
+	 */
+	return(FALSE);
+}
+
 /* Launch search in external service or application the search provider relies on
  * with provided list of search terms.
  */
@@ -29,6 +29,7 @@
 #endif
 
 #include <clutter/clutter.h>
+#include <gio/gio.h>
 
 #include <libesdashboard/search-result-set.h>
 
@@ -82,6 +83,25 @@ struct _EsdashboardSearchProviderClass
 								GVariant *inResultItem,
 								ClutterActor *inActor,
 								const gchar **inSearchTerms);
+
+	/* Virtual functions added later are appended here to keep the layout
+	 * of this structure compatible for existing search provider plugins.
+	 */
+	void (*get_result_set_async)(EsdashboardSearchProvider *self,
+									const gchar **inSearchTerms,
+									EsdashboardSearchResultSet *inPreviousResultSet,
+									GCancellable *inCancellable,
+									GAsyncReadyCallback inCallback,
+									gpointer inUserData);
+	EsdashboardSearchResultSet* (*get_result_set_finish)(EsdashboardSearchProvider *self,
+															GAsyncResult *inResult,
+															GError **outError);
+
+	gboolean (*is_thread_safe)(EsdashboardSearchProvider *self);
+
+	gboolean (*update_result_actor)(EsdashboardSearchProvider *self,
+									GVariant *inResultItem,
+									ClutterActor *inActor);
 };
 
 /* Public API */
@@ -93,12 +113,30 @@ gboolean esdashboard_search_provider_has_id(EsdashboardSearchProvider *self, con
 const gchar* esdashboard_search_provider_get_name(EsdashboardSearchProvider *self);
 const gchar* esdashboard_search_provider_get_icon(EsdashboardSearchProvider *self);
 
+gboolean esdashboard_search_provider_is_thread_safe(EsdashboardSearchProvider *self);
+
+gdouble esdashboard_search_provider_get_latency(EsdashboardSearchProvider *self);
+void esdashboard_search_provider_add_latency_sample(EsdashboardSearchProvider *self, gdouble inLatency);
+
 EsdashboardSearchResultSet* esdashboard_search_provider_get_result_set(EsdashboardSearchProvider *self,
 																		const gchar **inSearchTerms,
 																		EsdashboardSearchResultSet *inPreviousResultSet);
 
+void esdashboard_search_provider_get_result_set_async(EsdashboardSearchProvider *self,
+														const gchar **inSearchTerms,
+														EsdashboardSearchResultSet *inPreviousResultSet,
+														GCancellable *inCancellable,
+														GAsyncReadyCallback inCallback,
+														gpointer inUserData);
+EsdashboardSearchResultSet* esdashboard_search_provider_get_result_set_finish(EsdashboardSearchProvider *self,
+																				GAsyncResult *inResult,
+																				GError **outError);
+
 ClutterActor* esdashboard_search_provider_create_result_actor(EsdashboardSearchProvider *self,
 																GVariant *inResultItem);
+gboolean esdashboard_search_provider_update_result_actor(EsdashboardSearchProvider *self,
+															GVariant *inResultItem,
+															ClutterActor *inActor);
 
 gboolean esdashboard_search_provider_launch_search(EsdashboardSearchProvider *self,
 													const gchar **inSearchTerms);
@@ -70,6 +70,7 @@ struct _EsdashboardSearchResultContainerPrivate
 
 	GHashTable					*mapping;
 	EsdashboardSearchResultSet	*lastResultSet;
+	GQueue						*recycledActors;
 
 	gboolean					maxResultsItemsCountSet;
 	gint						maxResultsItemsCount;
@@ -117,6 +118,7 @@ static guint EsdashboardSearchResultContainerSignals[SIGNAL_LAST]={ 0, };
 #define DEFAULT_VIEW_MODE				ESDASHBOARD_VIEW_MODE_LIST
 #define DEFAULT_INITIAL_RESULT_SIZE		5
 #define DEFAULT_MORE_RESULT_SIZE		5
+#define MAX_RECYCLED_ACTORS				32
 
 /* Forward declarations */
 static void _esdashboard_search_result_container_update_selection(EsdashboardSearchResultContainer *self,
@@ -496,6 +498,97 @@ static ClutterActor* _esdashboard_search_result_container_result_item_actor_new(
 	return(actor);
 }
 
+/* Destroy all actors kept for reuse */
+static void _esdashboard_search_result_container_clear_recycled_actors(EsdashboardSearchResultContainer *self)
+{
+	EsdashboardSearchResultContainerPrivate		*priv;
+	ClutterActor								*actor;
+
+	g_return_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_CONTAINER(self));
+
+	priv=self->priv;
+
+	while((actor=CLUTTER_ACTOR(g_queue_pop_head(priv->recycledActors))))
+	{
+		/* First disconnect signal handlers from actor before destroying it */
+		g_signal_handlers_disconnect_by_data(actor, self);
+
+		/* Destroy actor and release reference taken when it was recycled */
+		clutter_actor_destroy(actor);
+		g_object_unref(actor);
+	}
+}
+
+/* Keep actor of a result item which was removed from this container for reuse
+ * if search provider can rebind it to another result item. Returns TRUE if actor
+ * was recycled or FALSE if it should be destroyed.
+ */
+static gboolean _esdashboard_search_result_container_recycle_result_item_actor(EsdashboardSearchResultContainer *self,
+																				ClutterActor *inActor)
+{
+	EsdashboardSearchResultContainerPrivate		*priv;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_CONTAINER(self), FALSE);
+	g_return_val_if_fail(CLUTTER_IS_ACTOR(inActor), FALSE);
+
+	priv=self->priv;
+
+	/* Check if search provider can rebind actors and if the pool is not full */
+	if(!priv->provider ||
+		!ESDASHBOARD_SEARCH_PROVIDER_GET_CLASS(priv->provider)->update_result_actor ||
+		g_queue_get_length(priv->recycledActors)>=MAX_RECYCLED_ACTORS)
+	{
+		return(FALSE);
+	}
+
+	/* Move selection away from actor as it would be done if it was destroyed */
+	if(inActor==priv->selectedItem)
+	{
+		_esdashboard_search_result_container_on_destroy_selection(self, inActor);
+	}
+
+	/* Take a reference on actor, remove it from items container and keep it.
+	 * The signal handlers stay connected as they only act on actors in mapping.
+	 */
+	g_object_ref(inActor);
+	clutter_actor_remove_child(priv->itemsContainer, inActor);
+	g_queue_push_head(priv->recycledActors, inActor);
+
+	return(TRUE);
+}
+
+/* Get actor kept for reuse and rebind it to result item. The reference taken
+ * when actor was recycled is passed to caller which must release it.
+ */
+static ClutterActor* _esdashboard_search_result_container_result_item_actor_reuse(EsdashboardSearchResultContainer *self,
+																					GVariant *inResultItem)
+{
+	EsdashboardSearchResultContainerPrivate		*priv;
+	ClutterActor								*actor;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_CONTAINER(self), NULL);
+	g_return_val_if_fail(inResultItem, NULL);
+
+	priv=self->priv;
+
+	while((actor=CLUTTER_ACTOR(g_queue_pop_head(priv->recycledActors))))
+	{
+		/* Ask search provider to rebind actor to result item */
+		if(esdashboard_search_provider_update_result_actor(priv->provider, inResultItem, actor))
+		{
+			return(actor);
+		}
+
+		/* Actor could not be rebound so destroy it */
+		g_signal_handlers_disconnect_by_data(actor, self);
+		clutter_actor_destroy(actor);
+		g_object_unref(actor);
+	}
+
+	/* No actor to reuse */
+	return(NULL);
+}
+
 /* Sets provider this result container is for */
 static void _esdashboard_search_result_container_set_provider(EsdashboardSearchResultContainer *self,
 																EsdashboardSearchProvider *inProvider)
@@ -535,11 +628,12 @@ static void _esdashboard_search_result_container_set_provider(EsdashboardSearchR
 static void _esdashboard_search_result_container_update_result_items(EsdashboardSearchResultContainer *self, EsdashboardSearchResultSet *inResultSet, gboolean inShowAllItems)
 {
 	EsdashboardSearchResultContainerPrivate		*priv;
-	GList										*allList;
+	gint										allItemsCount;
 	GList										*removeList;
 	GList										*iter;
 	GVariant									*resultItem;
 	ClutterActor								*actor;
+	gint										actorsCount;
 
 	g_return_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_CONTAINER(self));
 	g_return_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(inResultSet));
@@ -565,16 +659,84 @@ static void _esdashboard_search_result_container_update_result_items(Esdashboard
 	removeList=NULL;
 	if(priv->lastResultSet) removeList=esdashboard_search_result_set_complement(inResultSet, priv->lastResultSet);
 
-	/* Create actor for each item in list which is new to mapping */
-	allList=esdashboard_search_result_set_get_all(inResultSet);
-	if(allList)
+	/* Get current number of result actors but decrease it by the number
+	 * of actors which will be removed. Removed actors may stay in items
+	 * container while they are destroyed animated, so count them now.
+	 */
+	actorsCount=clutter_actor_get_n_children(priv->itemsContainer);
+	if(removeList)
 	{
-		ClutterActor							*lastActor;
-		gint									actorsCount;
-		gint									allItemsCount;
+		for(iter=removeList; iter && actorsCount>0; iter=g_list_next(iter))
+		{
+			/* Get result item to remove */
+			resultItem=(GVariant*)iter->data;
+
+			/* Get actor to remove */
+			if(g_hash_table_lookup_extended(priv->mapping, resultItem, NULL, (gpointer*)&actor))
+			{
+				if(actor) actorsCount--;
+			}
+		}
+	}
+
+	/* Remove the actor for each item in remove list first, so their actors are
+	 * kept for reuse by the actors created for new result items.
+	 */
+	if(removeList)
+	{
+		/* Iterate through list of items to remove and for each one remove actor
+		 * and its entry in mapping hash table.
+		 */
+		for(iter=removeList; iter; iter=g_list_next(iter))
+		{
+			/* Get result item to remove */
+			resultItem=(GVariant*)iter->data;
+
+			/* Get actor to remove */
+			if(g_hash_table_lookup_extended(priv->mapping, resultItem, NULL, (gpointer*)&actor))
+			{
+				/* Check if item has really an actor */
+				if(!CLUTTER_IS_ACTOR(actor))
+				{
+					gchar		*resultItemText;
 
-		/* Get number of all result items */
-		allItemsCount=g_list_length(allList);
+					resultItemText=g_variant_print(resultItem, TRUE);
+					g_critical("Failed to remove actor for result item %s of provider %s: Actor of type %s is not derived from class %s",
+								resultItemText,
+								G_OBJECT_TYPE_NAME(priv->provider),
+								G_IS_OBJECT(actor) ? G_OBJECT_TYPE_NAME(actor) : "<unknown>",
+								g_type_name(CLUTTER_TYPE_ACTOR));
+					g_free(resultItemText);
+
+					continue;
+				}
+
+				/* Keep a reference on actor while removing it from mapping hash table */
+				g_object_ref(actor);
+				g_hash_table_remove(priv->mapping, resultItem);
+
+				/* Keep actor for reuse if possible otherwise destroy it */
+				if(!_esdashboard_search_result_container_recycle_result_item_actor(self, actor))
+				{
+					/* First disconnect signal handlers from actor before destroying it */
+					g_signal_handlers_disconnect_by_data(actor, self);
+
+					/* Destroy actor */
+					esdashboard_actor_destroy(actor);
+				}
+
+				/* Release reference taken on actor */
+				g_object_unref(actor);
+			}
+		}
+	}
+
+	/* Create actor for each item in result set which is new to mapping */
+	allItemsCount=(gint)esdashboard_search_result_set_get_size(inResultSet);
+	if(allItemsCount>0)
+	{
+		ClutterActor							*lastActor;
+		GList									*items;
 
 		/* If this is the first time the maximum number of actors is determined
 		 * then set it to initial number.
@@ -590,31 +752,21 @@ static void _esdashboard_search_result_container_update_result_items(Esdashboard
 		 */
 		if(priv->maxResultsItemsCount<=0) inShowAllItems=TRUE;
 
-		/* Get current number of result actors but decrease it by the number
-		 * of actors which will be removed.
+		/* Get result items which may be shown. Each result item visited either
+		 * has an actor already, which is counted in number of actors, or gets
+		 * one, so not more than the maximum number of actors plus the one
+		 * exceeding it will be visited. Only these result items with highest
+		 * rank need to be sorted.
 		 */
-		actorsCount=clutter_actor_get_n_children(priv->itemsContainer);
-		if(removeList)
-		{
-			for(iter=removeList; iter && actorsCount>0; iter=g_list_next(iter))
-			{
-				/* Get result item to remove */
-				resultItem=(GVariant*)iter->data;
-
-				/* Get actor to remove */
-				if(g_hash_table_lookup_extended(priv->mapping, resultItem, NULL, (gpointer*)&actor))
-				{
-					if(actor) actorsCount--;
-				}
-			}
-		}
+		if(inShowAllItems) items=esdashboard_search_result_set_get_all(inResultSet);
+			else items=esdashboard_search_result_set_get_top(inResultSet, priv->maxResultsItemsCount+1);
 
 		/* Iterate through list of result items and add actor for each result item
 		 * which has no actor currently but do not exceed maximum number of actors
 		 * we just determined above.
 		 */
 		lastActor=NULL;
-		for(iter=allList; iter && (inShowAllItems || actorsCount<=priv->maxResultsItemsCount); iter=g_list_next(iter))
+		for(iter=items; iter && (inShowAllItems || actorsCount<=priv->maxResultsItemsCount); iter=g_list_next(iter))
 		{
 			/* Get result item to add */
 			resultItem=(GVariant*)iter->data;
@@ -632,8 +784,17 @@ static void _esdashboard_search_result_container_update_result_items(Esdashboard
 				actorsCount++;
 				if(!inShowAllItems && actorsCount>priv->maxResultsItemsCount) continue;
 
-				/* Create actor for result item and add to this container */
-				actor=_esdashboard_search_result_container_result_item_actor_new(self, resultItem);
+				/* Reuse actor of a removed result item or create actor for
+				 * result item and add to this container. Take a reference on
+				 * newly created actor so both are owned the same way.
+				 */
+				actor=_esdashboard_search_result_container_result_item_actor_reuse(self, resultItem);
+				if(!actor)
+				{
+					actor=_esdashboard_search_result_container_result_item_actor_new(self, resultItem);
+					if(actor) g_object_ref_sink(actor);
+				}
+
 				if(actor)
 				{
 					/* Add newly created actor to container of provider */
@@ -642,6 +803,9 @@ static void _esdashboard_search_result_container_update_result_items(Esdashboard
 
 					/* Add actor to mapping hash table for result item */
 					g_hash_table_insert(priv->mapping, g_variant_ref(resultItem), g_object_ref(actor));
+
+					/* Release reference taken on actor */
+					g_object_unref(actor);
 				}
 			}
 
@@ -651,6 +815,9 @@ static void _esdashboard_search_result_container_update_result_items(Esdashboard
 			if(actor) lastActor=actor;
 		}
 
+		/* Release allocated resources */
+		if(items) g_list_free_full(items, (GDestroyNotify)g_variant_unref);
+
 		/* If we tried to create at least one more actore than maximum allowed
 		 * then set text at "more"-label otherwise set empty text to "hide" it
 		 */
@@ -698,48 +865,6 @@ static void _esdashboard_search_result_container_update_result_items(Esdashboard
 			}
 	}
 
-	/* Remove the actor for each item in remove list */
-	if(removeList)
-	{
-		/* Iterate through list of items to remove and for each one remove actor
-		 * and its entry in mapping hash table.
-		 */
-		for(iter=removeList; iter; iter=g_list_next(iter))
-		{
-			/* Get result item to remove */
-			resultItem=(GVariant*)iter->data;
-
-			/* Get actor to remove */
-			if(g_hash_table_lookup_extended(priv->mapping, resultItem, NULL, (gpointer*)&actor))
-			{
-				/* Check if item has really an actor */
-				if(!CLUTTER_IS_ACTOR(actor))
-				{
-					gchar		*resultItemText;
-
-					resultItemText=g_variant_print(resultItem, TRUE);
-					g_critical("Failed to remove actor for result item %s of provider %s: Actor of type %s is not derived from class %s",
-								resultItemText,
-								G_OBJECT_TYPE_NAME(priv->provider),
-								G_IS_OBJECT(actor) ? G_OBJECT_TYPE_NAME(actor) : "<unknown>",
-								g_type_name(CLUTTER_TYPE_ACTOR));
-					g_free(resultItemText);
-
-					continue;
-				}
-
-				/* First disconnect signal handlers from actor before modifying mapping hash table */
-				g_signal_handlers_disconnect_by_data(actor, self);
-
-				/* Remove actor from mapping hash table before destroying it */
-				g_hash_table_remove(priv->mapping, resultItem);
-
-				/* Destroy actor and remove from hash table */
-				esdashboard_actor_destroy(actor);
-			}
-		}
-	}
-
 	/* Remember new result set for search provider */
 	if(priv->lastResultSet)
 	{
@@ -751,7 +876,6 @@ static void _esdashboard_search_result_container_update_result_items(Esdashboard
 
 	/* Release allocated resources */
 	if(removeList) g_list_free_full(removeList, (GDestroyNotify)g_variant_unref);
-	if(allList) g_list_free_full(allList, (GDestroyNotify)g_variant_unref);
 
 	/* Release extra reference we took at begin of this function */
 	g_object_unref(inResultSet);
@@ -1137,6 +1261,13 @@ static void _esdashboard_search_result_container_dispose(GObject *inObject)
 		priv->lastResultSet=NULL;
 	}
 
+	if(priv->recycledActors)
+	{
+		_esdashboard_search_result_container_clear_recycled_actors(self);
+		g_queue_free(priv->recycledActors);
+		priv->recycledActors=NULL;
+	}
+
 	/* Call parent's class dispose method */
 	G_OBJECT_CLASS(esdashboard_search_result_container_parent_class)->dispose(inObject);
 }
@@ -1370,6 +1501,7 @@ static void esdashboard_search_result_container_init(EsdashboardSearchResultCont
 										(GDestroyNotify)g_variant_unref,
 										(GDestroyNotify)g_object_unref);
 	priv->lastResultSet=NULL;
+	priv->recycledActors=g_queue_new();
 	priv->initialResultsCount=DEFAULT_INITIAL_RESULT_SIZE;
 	priv->moreResultsCount=DEFAULT_MORE_RESULT_SIZE;
 	priv->maxResultsItemsCountSet=FALSE;
@@ -1532,6 +1664,7 @@ void esdashboard_search_result_container_set_view_mode(EsdashboardSearchResultCo
 	EsdashboardSearchResultContainerPrivate		*priv;
 	ClutterActorIter							iter;
 	ClutterActor								*child;
+	GList										*recycledIter;
 	const gchar									*removeClass;
 	const gchar									*addClass;
 
@@ -1582,6 +1715,15 @@ void esdashboard_search_result_container_set_view_mode(EsdashboardSearchResultCo
 			esdashboard_stylable_add_class(ESDASHBOARD_STYLABLE(child), addClass);
 		}
 
+		/* Also update style class of actors kept for reuse */
+		for(recycledIter=priv->recycledActors->head; recycledIter; recycledIter=g_list_next(recycledIter))
+		{
+			if(!ESDASHBOARD_IS_STYLABLE(recycledIter->data)) continue;
+
+			esdashboard_stylable_remove_class(ESDASHBOARD_STYLABLE(recycledIter->data), removeClass);
+			esdashboard_stylable_add_class(ESDASHBOARD_STYLABLE(recycledIter->data), addClass);
+		}
+
 		/* Notify about property change */
 		g_object_notify_by_pspec(G_OBJECT(self), EsdashboardSearchResultContainerProperties[PROP_VIEW_MODE]);
 	}
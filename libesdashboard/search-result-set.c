@@ -33,10 +33,17 @@
 
 
 /* Define this class in GObject system */
+typedef struct _EsdashboardSearchResultSetItemData		EsdashboardSearchResultSetItemData;
+
 struct _EsdashboardSearchResultSetPrivate
 {
 	/* Instance related */
-	GHashTable								*set;
+	GPtrArray								*items;
+	GHashTable								*index;
+
+	GPtrArray								*sorted;
+	gboolean								sortedValid;
+	guint									sortedCount;
 
 	EsdashboardSearchResultSetCompareFunc	sortCallback;
 	gpointer								sortUserData;
@@ -48,26 +55,28 @@ G_DEFINE_TYPE_WITH_PRIVATE(EsdashboardSearchResultSet,
 							G_TYPE_OBJECT)
 
 /* IMPLEMENTATION: Private variables and methods */
-typedef struct _EsdashboardSearchResultSetItemData		EsdashboardSearchResultSetItemData;
+#define ESDASHBOARD_SEARCH_RESULT_SET_MIN_SELECTION_SIZE		16
+
 struct _EsdashboardSearchResultSetItemData
 {
-	gint									refCount;
-
 	/* Item related */
+	GVariant								*item;
 	gfloat									score;
 };
 
-/* Create, destroy, ref and unref item data for an item */
-static EsdashboardSearchResultSetItemData* _esdashboard_search_result_set_item_data_new(void)
+/* Create and destroy item data for an item */
+static EsdashboardSearchResultSetItemData* _esdashboard_search_result_set_item_data_new(GVariant *inItem)
 {
 	EsdashboardSearchResultSetItemData	*data;
 
-	/* Create statistics data */
+	g_return_val_if_fail(inItem, NULL);
+
+	/* Create item data */
 	data=g_new0(EsdashboardSearchResultSetItemData, 1);
 	if(!data) return(NULL);
 
-	/* Set up statistics data */
-	data->refCount=1;
+	/* Set up item data */
+	data->item=g_variant_ref_sink(inItem);
 
 	return(data);
 }
@@ -77,46 +86,26 @@ static void _esdashboard_search_result_set_item_data_free(EsdashboardSearchResul
 	g_return_if_fail(inData);
 
 	/* Release common allocated resources */
+	if(inData->item) g_variant_unref(inData->item);
 	g_free(inData);
 }
 
-static EsdashboardSearchResultSetItemData* _esdashboard_search_result_set_item_data_ref(EsdashboardSearchResultSetItemData *inData)
-{
-	g_return_val_if_fail(inData, NULL);
-
-	inData->refCount++;
-	return(inData);
-}
-
-static void _esdashboard_search_result_set_item_data_unref(EsdashboardSearchResultSetItemData *inData)
-{
-	g_return_if_fail(inData);
-
-	inData->refCount--;
-	if(inData->refCount==0) _esdashboard_search_result_set_item_data_free(inData);
-}
-
+/* Get item data for an item. The returned item data is owned by result set. */
 static EsdashboardSearchResultSetItemData* _esdashboard_search_result_set_item_data_get(EsdashboardSearchResultSet *self, GVariant *inItem)
 {
-	EsdashboardSearchResultSetPrivate		*priv;
-	EsdashboardSearchResultSetItemData		*itemData;
-
 	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(self), NULL);
 	g_return_val_if_fail(inItem, NULL);
 
-	priv=self->priv;
-	itemData=NULL;
+	/* Return item data found for item in result set if any */
+	return((EsdashboardSearchResultSetItemData*)g_hash_table_lookup(self->priv->index, inItem));
+}
 
-	/* Lookup item in result and take reference on item data if found
-	 * before returning it,
-	 */
-	if(g_hash_table_lookup_extended(priv->set, inItem, NULL, (gpointer*)&itemData))
-	{
-		_esdashboard_search_result_set_item_data_ref(itemData);
-	}
+/* Mark sorted order of items as outdated */
+static void _esdashboard_search_result_set_invalidate_sorted(EsdashboardSearchResultSet *self)
+{
+	g_return_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(self));
 
-	/* Return item data found for item in result set if any */
-	return(itemData);
+	self->priv->sortedValid=FALSE;
 }
 
 /* Internal callback function for calling callback functions for sorting */
@@ -126,39 +115,152 @@ static gint _esdashboard_search_result_set_sort_internal(gconstpointer inLeft,
 {
 	EsdashboardSearchResultSet				*self=ESDASHBOARD_SEARCH_RESULT_SET(inUserData);
 	EsdashboardSearchResultSetPrivate		*priv=self->priv;
-	GVariant								*left;
 	EsdashboardSearchResultSetItemData		*leftData;
-	GVariant								*right;
 	EsdashboardSearchResultSetItemData		*rightData;
-	gint									result;
-
-	result=0;
 
 	/* Get items to compare */
-	left=(GVariant*)inLeft;
-	right=(GVariant*)inRight;
+	leftData=*((EsdashboardSearchResultSetItemData**)inLeft);
+	rightData=*((EsdashboardSearchResultSetItemData**)inRight);
+
+	/* If both items do not have the same score the item with higher score
+	 * is sorted before the other one.
+	 */
+	if(leftData->score < rightData->score) return(1);
+	if(leftData->score > rightData->score) return(-1);
+
+	/* Call sorting callback function now if both have the same score */
+	return((priv->sortCallback)(leftData->item, rightData->item, priv->sortUserData));
+}
+
+/* Internal callback function for calling callback functions for sorting
+ * items which are not part of this result set and therefore have no score.
+ */
+static gint _esdashboard_search_result_set_sort_foreign_internal(gconstpointer inLeft,
+																	gconstpointer inRight,
+																	gpointer inUserData)
+{
+	EsdashboardSearchResultSet				*self=ESDASHBOARD_SEARCH_RESULT_SET(inUserData);
+	EsdashboardSearchResultSetPrivate		*priv=self->priv;
 
-	/* Get score for each item to compare for sorting if for both items available */
-	leftData=_esdashboard_search_result_set_item_data_get(self, left);
-	rightData=_esdashboard_search_result_set_item_data_get(self, right);
-	if(leftData && rightData)
+	return((priv->sortCallback)(*((GVariant**)inLeft), *((GVariant**)inRight), priv->sortUserData));
+}
+
+/* Move item in max-heap down until heap property is restored again. The heap
+ * root is the item which is sorted last among all items in heap.
+ */
+static void _esdashboard_search_result_set_heap_sift_down(EsdashboardSearchResultSet *self,
+															gpointer *ioHeap,
+															guint inHeapSize,
+															guint inPosition)
+{
+	guint									largest;
+	guint									child;
+	gpointer								swap;
+
+	while(TRUE)
 	{
-		/* Set result to corresponding value and other than null if the
-		 * scores are not equal.
-		 */
-		if(leftData->score < rightData->score) result=1;
-		if(leftData->score > rightData->score) result=-1;
+		largest=inPosition;
+
+		child=(2*inPosition)+1;
+		if(child<inHeapSize &&
+			_esdashboard_search_result_set_sort_internal(&ioHeap[child], &ioHeap[largest], self)>0)
+		{
+			largest=child;
+		}
+
+		child++;
+		if(child<inHeapSize &&
+			_esdashboard_search_result_set_sort_internal(&ioHeap[child], &ioHeap[largest], self)>0)
+		{
+			largest=child;
+		}
+
+		if(largest==inPosition) break;
+
+		swap=ioHeap[inPosition];
+		ioHeap[inPosition]=ioHeap[largest];
+		ioHeap[largest]=swap;
+
+		inPosition=largest;
 	}
-	if(leftData) _esdashboard_search_result_set_item_data_unref(leftData);
-	if(rightData) _esdashboard_search_result_set_item_data_unref(rightData);
+}
+
+/* Ensure at least the requested number of items at the beginning of sorted order
+ * are in their final position. The sorted order is cached until result set or
+ * its sort function changes and further items are selected only when requested.
+ * If no sort function is set the items are kept in the order they were added.
+ * As functions only reading items of a result set may modify its cached sorted
+ * order, a result set is not thread-safe and must only be used by one thread.
+ * Searches running in worker threads get their own copy of a result set used
+ * in main thread.
+ */
+static void _esdashboard_search_result_set_ensure_sorted(EsdashboardSearchResultSet *self, guint inCount)
+{
+	EsdashboardSearchResultSetPrivate		*priv;
+	gpointer								*remaining;
+	guint									remainingCount;
+	guint									selectCount;
+	guint									i;
 
-	/* If both items do not have the same score the result is set to value
-	 * other than zero. So return it now.
+	g_return_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(self));
+
+	priv=self->priv;
+
+	/* Copy items to sorted order if cached sorted order is outdated */
+	if(!priv->sortedValid)
+	{
+		g_ptr_array_set_size(priv->sorted, 0);
+		for(i=0; i<priv->items->len; i++)
+		{
+			g_ptr_array_add(priv->sorted, g_ptr_array_index(priv->items, i));
+		}
+
+		priv->sortedCount=(priv->sortCallback ? 0 : priv->sorted->len);
+		priv->sortedValid=TRUE;
+	}
+
+	/* Do nothing if requested number of items is in sorted order already */
+	if(inCount>priv->sorted->len) inCount=priv->sorted->len;
+	if(inCount<=priv->sortedCount) return;
+
+	/* Get items not in final position yet and number of items to select from them */
+	remaining=priv->sorted->pdata+priv->sortedCount;
+	remainingCount=priv->sorted->len-priv->sortedCount;
+	selectCount=inCount-priv->sortedCount;
+
+	/* If a large part of remaining items is requested, sort all of them */
+	if(selectCount>=remainingCount/2)
+	{
+		g_qsort_with_data(remaining, remainingCount, sizeof(gpointer), _esdashboard_search_result_set_sort_internal, self);
+		priv->sortedCount=priv->sorted->len;
+		return;
+	}
+
+	/* Otherwise build a max-heap from the first items to select and replace its
+	 * root by each other remaining item sorted before it. Afterwards the heap
+	 * contains the items to select which are sorted then.
 	 */
-	if(result!=0) return(result);
+	for(i=selectCount/2; i>0; i--)
+	{
+		_esdashboard_search_result_set_heap_sift_down(self, remaining, selectCount, i-1);
+	}
 
-	/* Call sorting callback function now if both have the same score */
-	return((priv->sortCallback)(left, right, priv->sortUserData));
+	for(i=selectCount; i<remainingCount; i++)
+	{
+		if(_esdashboard_search_result_set_sort_internal(&remaining[i], &remaining[0], self)<0)
+		{
+			gpointer						swap;
+
+			swap=remaining[0];
+			remaining[0]=remaining[i];
+			remaining[i]=swap;
+
+			_esdashboard_search_result_set_heap_sift_down(self, remaining, selectCount, 0);
+		}
+	}
+
+	g_qsort_with_data(remaining, selectCount, sizeof(gpointer), _esdashboard_search_result_set_sort_internal, self);
+	priv->sortedCount+=selectCount;
 }
 
 /* IMPLEMENTATION: GObject */
@@ -187,10 +289,22 @@ static void _esdashboard_search_result_set_dispose(GObject *inObject)
 
 	priv->sortCallback=NULL;
 
-	if(priv->set)
+	if(priv->sorted)
+	{
+		g_ptr_array_unref(priv->sorted);
+		priv->sorted=NULL;
+	}
+
+	if(priv->index)
+	{
+		g_hash_table_unref(priv->index);
+		priv->index=NULL;
+	}
+
+	if(priv->items)
 	{
-		g_hash_table_unref(priv->set);
-		priv->set=NULL;
+		g_ptr_array_unref(priv->items);
+		priv->items=NULL;
 	}
 
 	/* Call parent's class dispose method */
@@ -219,10 +333,11 @@ static void esdashboard_search_result_set_init(EsdashboardSearchResultSet *self)
 	priv=self->priv=esdashboard_search_result_set_get_instance_private(self);
 
 	/* Set default values */
-	priv->set=g_hash_table_new_full(g_variant_hash,
-									g_variant_equal,
-									(GDestroyNotify)g_variant_unref,
-									(GDestroyNotify)_esdashboard_search_result_set_item_data_unref);
+	priv->items=g_ptr_array_new_with_free_func((GDestroyNotify)_esdashboard_search_result_set_item_data_free);
+	priv->index=g_hash_table_new(g_variant_hash, g_variant_equal);
+	priv->sorted=g_ptr_array_new();
+	priv->sortedValid=FALSE;
+	priv->sortedCount=0;
 }
 
 /* IMPLEMENTATION: Public API */
@@ -238,7 +353,7 @@ guint esdashboard_search_result_set_get_size(EsdashboardSearchResultSet *self)
 {
 	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(self), 0);
 
-	return(g_hash_table_size(self->priv->set));
+	return(self->priv->items->len);
 }
 
 /* Add a result item to result set */
@@ -252,59 +367,122 @@ void esdashboard_search_result_set_add_item(EsdashboardSearchResultSet *self, GV
 
 	priv=self->priv;
 
-	/* Add or replace item in hash table */
-	if(!g_hash_table_lookup_extended(priv->set, inItem, NULL, (gpointer*)&itemData))
+	/* Add item if it does not exist in result set */
+	if(!g_hash_table_contains(priv->index, inItem))
 	{
 		/* Create data for item to add */
-		itemData=_esdashboard_search_result_set_item_data_new();
+		itemData=_esdashboard_search_result_set_item_data_new(inItem);
 
 		/* Add new item to result set */
-		g_hash_table_insert(priv->set, g_variant_ref_sink(inItem), itemData);
+		g_ptr_array_add(priv->items, itemData);
+		g_hash_table_insert(priv->index, itemData->item, itemData);
+
+		/* Sorted order is outdated now */
+		_esdashboard_search_result_set_invalidate_sorted(self);
 	}
 }
 
 /* Check if a result item exists already in result set */
 gboolean esdashboard_search_result_set_has_item(EsdashboardSearchResultSet *self, GVariant *inItem)
 {
-	EsdashboardSearchResultSetPrivate		*priv;
-
 	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(self), FALSE);
 	g_return_val_if_fail(inItem, FALSE);
 
+	/* Return result indicating existence of item in this result set */
+	return(g_hash_table_contains(self->priv->index, inItem));
+}
+
+/* Get item at requested position in sorted order of result set.
+ * The returned item is owned by result set and must not be freed. It is only
+ * valid as long as the result set is alive.
+ */
+GVariant* esdashboard_search_result_set_get_item_at(EsdashboardSearchResultSet *self, guint inIndex)
+{
+	EsdashboardSearchResultSetPrivate		*priv;
+	EsdashboardSearchResultSetItemData		*itemData;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(self), NULL);
+
 	priv=self->priv;
 
-	/* Return result indicating existence of item in this result set */
-	return(g_hash_table_lookup_extended(priv->set, inItem, NULL, NULL));
+	/* Check if index is in range */
+	if(inIndex>=priv->items->len) return(NULL);
+
+	/* Get item at position from sorted order. If item is not in its final
+	 * position yet select at least twice as many items as before, so iterating
+	 * through items by their position selects items in a few steps only.
+	 */
+	if(inIndex>=priv->sortedCount || !priv->sortedValid)
+	{
+		guint								count;
+
+		count=MAX(inIndex+1, ESDASHBOARD_SEARCH_RESULT_SET_MIN_SELECTION_SIZE);
+		if(priv->sortedValid) count=MAX(count, priv->sortedCount*2);
+
+		_esdashboard_search_result_set_ensure_sorted(self, count);
+	}
+	itemData=(EsdashboardSearchResultSetItemData*)g_ptr_array_index(priv->sorted, inIndex);
+
+	return(itemData->item);
 }
 
-/* Get list of all items in this result sets.
+/* Get list of items with highest rank in sorted order of this result set but
+ * not more than requested. Only the requested items get sorted and requesting
+ * more items later on sorts only the additional ones.
  * Returned list should be freed with g_list_free_full(result, g_variant_unref)
  */
-GList* esdashboard_search_result_set_get_all(EsdashboardSearchResultSet *self)
+GList* esdashboard_search_result_set_get_top(EsdashboardSearchResultSet *self, guint inMaxItems)
 {
 	EsdashboardSearchResultSetPrivate		*priv;
-	GHashTableIter							iter;
+	EsdashboardSearchResultSetItemData		*itemData;
 	GList									*list;
-	GVariant								*key;
+	guint									i;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(self), NULL);
 
 	priv=self->priv;
 
-	/* Iterate through hash table of this result set, take a reference of
-	 * key of this result set's hash table item and add list to result list.
+	/* Select requested number of items */
+	_esdashboard_search_result_set_ensure_sorted(self, inMaxItems);
+
+	/* Iterate backwards through selected items, take a reference of each item
+	 * and prepend it to result list.
 	 */
 	list=NULL;
-	g_hash_table_iter_init(&iter, priv->set);
-	while(g_hash_table_iter_next(&iter, (gpointer*)&key, NULL))
+	for(i=MIN(inMaxItems, priv->sorted->len); i>0; i--)
 	{
-		list=g_list_prepend(list, g_variant_ref(key));
+		itemData=(EsdashboardSearchResultSetItemData*)g_ptr_array_index(priv->sorted, i-1);
+		list=g_list_prepend(list, g_variant_ref(itemData->item));
 	}
 
-	/* If a sorting function was set then sort result list */
-	if(list && priv->sortCallback)
+	/* Return result */
+	return(list);
+}
+
+/* Get list of all items in this result sets.
+ * Returned list should be freed with g_list_free_full(result, g_variant_unref)
+ */
+GList* esdashboard_search_result_set_get_all(EsdashboardSearchResultSet *self)
+{
+	EsdashboardSearchResultSetPrivate		*priv;
+	EsdashboardSearchResultSetItemData		*itemData;
+	GList									*list;
+	guint									i;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(self), NULL);
+
+	priv=self->priv;
+
+	/* Iterate backwards through sorted order of items of this result set,
+	 * take a reference of each item and prepend it to result list.
+	 */
+	_esdashboard_search_result_set_ensure_sorted(self, G_MAXUINT);
+
+	list=NULL;
+	for(i=priv->sorted->len; i>0; i--)
 	{
-		list=g_list_sort_with_data(list, _esdashboard_search_result_set_sort_internal, self);
+		itemData=(EsdashboardSearchResultSetItemData*)g_ptr_array_index(priv->sorted, i-1);
+		list=g_list_prepend(list, g_variant_ref(itemData->item));
 	}
 
 	/* Return result */
@@ -317,36 +495,31 @@ GList* esdashboard_search_result_set_get_all(EsdashboardSearchResultSet *self)
 GList* esdashboard_search_result_set_intersect(EsdashboardSearchResultSet *self, EsdashboardSearchResultSet *inOtherSet)
 {
 	EsdashboardSearchResultSetPrivate		*priv;
-	GHashTableIter							iter;
+	EsdashboardSearchResultSetItemData		*itemData;
 	GList									*list;
-	GVariant								*key;
+	guint									i;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(self), NULL);
 	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(inOtherSet), NULL);
 
 	priv=self->priv;
 
-	/* Iterate through hash table of this result set and lookup its keys
-	 * at other result set's hash table. If it exists take a reference of
-	 * key of this result set's hash table item and add list to result list.
+	/* Iterate backwards through sorted order of items of this result set and
+	 * lookup each item at other result set. If it exists take a reference of
+	 * item and prepend it to result list which keeps the sorted order.
 	 */
+	_esdashboard_search_result_set_ensure_sorted(self, G_MAXUINT);
+
 	list=NULL;
-	g_hash_table_iter_init(&iter, priv->set);
-	while(g_hash_table_iter_next(&iter, (gpointer*)&key, NULL))
+	for(i=priv->sorted->len; i>0; i--)
 	{
-		/* Lookup key in other result set's hash table */
-		if(g_hash_table_lookup_extended(inOtherSet->priv->set, key, NULL, NULL))
+		itemData=(EsdashboardSearchResultSetItemData*)g_ptr_array_index(priv->sorted, i-1);
+		if(g_hash_table_contains(inOtherSet->priv->index, itemData->item))
 		{
-			list=g_list_prepend(list, g_variant_ref(key));
+			list=g_list_prepend(list, g_variant_ref(itemData->item));
 		}
 	}
 
-	/* If a sorting function was set then sort result list */
-	if(list && priv->sortCallback)
-	{
-		list=g_list_sort_with_data(list, _esdashboard_search_result_set_sort_internal, self);
-	}
-
 	/* Return result */
 	return(list);
 }
@@ -357,38 +530,47 @@ GList* esdashboard_search_result_set_intersect(EsdashboardSearchResultSet *self,
 GList* esdashboard_search_result_set_complement(EsdashboardSearchResultSet *self, EsdashboardSearchResultSet *inOtherSet)
 {
 	EsdashboardSearchResultSetPrivate		*priv;
-	GHashTableIter							iter;
+	EsdashboardSearchResultSetItemData		*itemData;
+	GPtrArray								*complement;
 	GList									*list;
-	GVariant								*key;
+	guint									i;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(self), NULL);
 	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(inOtherSet), NULL);
 
 	priv=self->priv;
 
-	/* Iterate through hash table of other result set and lookup its keys
-	 * at this result set's hash table. If it does not exists take a reference
-	 * of key of this result set's hash table item and add list to result list.
+	/* Iterate through items of other result set and lookup each item at this
+	 * result set. If it does not exist then remember it.
 	 */
-	list=NULL;
-	g_hash_table_iter_init(&iter, inOtherSet->priv->set);
-	while(g_hash_table_iter_next(&iter, (gpointer*)&key, NULL))
+	complement=g_ptr_array_new();
+	for(i=0; i<inOtherSet->priv->items->len; i++)
 	{
-		/* Lookup key in other result set's hash table and in case it does not
-		 * exist then add a reference of the key to result.
-		 */
-		if(!g_hash_table_lookup_extended(priv->set, key, NULL, NULL))
+		itemData=(EsdashboardSearchResultSetItemData*)g_ptr_array_index(inOtherSet->priv->items, i);
+		if(!g_hash_table_contains(priv->index, itemData->item))
 		{
-			list=g_list_prepend(list, g_variant_ref(key));
+			g_ptr_array_add(complement, itemData->item);
 		}
 	}
 
-	/* If a sorting function was set then sort result list */
-	if(list && priv->sortCallback)
+	/* If a sorting function was set then sort remembered items. These items
+	 * have no score in this result set so only the sort function decides.
+	 */
+	if(priv->sortCallback && complement->len>1)
+	{
+		g_ptr_array_sort_with_data(complement, _esdashboard_search_result_set_sort_foreign_internal, self);
+	}
+
+	/* Build result list by taking a reference of each remembered item */
+	list=NULL;
+	for(i=complement->len; i>0; i--)
 	{
-		list=g_list_sort_with_data(list, _esdashboard_search_result_set_sort_internal, self);
+		list=g_list_prepend(list, g_variant_ref((GVariant*)g_ptr_array_index(complement, i-1)));
 	}
 
+	/* Release allocated resources */
+	g_ptr_array_unref(complement);
+
 	/* Return result */
 	return(list);
 }
@@ -436,6 +618,9 @@ void esdashboard_search_result_set_set_sort_func_full(EsdashboardSearchResultSet
 		priv->sortUserData=inUserData;
 		priv->sortUserDataDestroyFunc=inUserDataDestroyFunc;
 	}
+
+	/* Sorted order is outdated now */
+	_esdashboard_search_result_set_invalidate_sorted(self);
 }
 
 /* Get/set score for a result item in result set */
@@ -451,13 +636,7 @@ gfloat esdashboard_search_result_set_get_item_score(EsdashboardSearchResultSet *
 
 	/* Check if requested item exists and get its score from item data */
 	itemData=_esdashboard_search_result_set_item_data_get(self, inItem);
-	if(itemData)
-	{
-		score=itemData->score;
-
-		/* Release allocated resources */
-		_esdashboard_search_result_set_item_data_unref(itemData);
-	}
+	if(itemData) score=itemData->score;
 
 	/* Return score of item */
 	return(score);
@@ -478,11 +657,12 @@ gboolean esdashboard_search_result_set_set_item_score(EsdashboardSearchResultSet
 	itemData=_esdashboard_search_result_set_item_data_get(self, inItem);
 	if(itemData)
 	{
-		/* Set score */
-		itemData->score=inScore;
-
-		/* Release allocated resources */
-		_esdashboard_search_result_set_item_data_unref(itemData);
+		/* Set score and mark sorted order as outdated if score changed */
+		if(itemData->score!=inScore)
+		{
+			itemData->score=inScore;
+			_esdashboard_search_result_set_invalidate_sorted(self);
+		}
 
 		/* Set flag that item exists in result set and data could be set */
 		success=TRUE;
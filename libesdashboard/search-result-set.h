@@ -72,7 +72,9 @@ guint esdashboard_search_result_set_get_size(EsdashboardSearchResultSet *self);
 
 void esdashboard_search_result_set_add_item(EsdashboardSearchResultSet *self, GVariant *inItem);
 gboolean esdashboard_search_result_set_has_item(EsdashboardSearchResultSet *self, GVariant *inItem);
+GVariant* esdashboard_search_result_set_get_item_at(EsdashboardSearchResultSet *self, guint inIndex);
 GList* esdashboard_search_result_set_get_all(EsdashboardSearchResultSet *self);
+GList* esdashboard_search_result_set_get_top(EsdashboardSearchResultSet *self, guint inMaxItems);
 
 GList* esdashboard_search_result_set_intersect(EsdashboardSearchResultSet *self, EsdashboardSearchResultSet *inOtherSet);
 GList* esdashboard_search_result_set_complement(EsdashboardSearchResultSet *self, EsdashboardSearchResultSet *inOtherSet);
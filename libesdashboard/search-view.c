@@ -32,6 +32,19 @@
  * each item in the result set this view will requests an actor at the associated
  * search provider to display that result item.
  *
+ * The result sets are requested asynchronously from the search providers and
+ * the results of each search provider are shown as soon as it returns them, so
+ * a slow search provider does not delay the results of the other ones. A search
+ * which is still running is cancelled when the search terms change.
+ *
+ * The time each search provider needs to return its result set is measured and
+ * its average is available at the #EsdashboardSearchProvider:latency property of
+ * the search provider. Search providers which are usually faster than the value
+ * of the Esconf property "/components/search-view/adaptive-search-latency" are
+ * asked on every change of the search terms. The search at slower search providers
+ * is delayed until the search terms have not changed for about the time they need,
+ * so keystrokes typed in quick succession are coalesced into one search.
+ *
  * To clear the results and to stop further searches the function
  * esdashboard_search_view_reset_search() should be called. Usually the application
  * will also switch back to active view before the search was started.
@@ -65,6 +78,10 @@
 /* Forward declarations */
 typedef struct _EsdashboardSearchViewProviderData	EsdashboardSearchViewProviderData;
 typedef struct _EsdashboardSearchViewSearchTerms	EsdashboardSearchViewSearchTerms;
+typedef struct _EsdashboardSearchViewSearch			EsdashboardSearchViewSearch;
+typedef struct _EsdashboardSearchViewProviderSearch	EsdashboardSearchViewProviderSearch;
+
+static void _esdashboard_search_view_provider_data_cancel_deferred_search(EsdashboardSearchViewProviderData *inData);
 
 /* Define this class in GObject system */
 static void _esdashboard_search_view_focusable_iface_init(EsdashboardFocusableInterface *iface);
@@ -76,6 +93,7 @@ struct _EsdashboardSearchViewPrivate
 	GList								*providers;
 
 	EsdashboardSearchViewSearchTerms	*lastTerms;
+	EsdashboardSearchViewSearch			*currentSearch;
 
 	EsconfChannel						*esconfChannel;
 	gboolean							delaySearch;
@@ -109,6 +127,10 @@ static guint EsdashboardSearchViewSignals[SIGNAL_LAST]={ 0, };
 #define DELAY_SEARCH_TIMEOUT_ESCONF_PROP		"/components/search-view/delay-search-timeout"
 #define DEFAULT_DELAY_SEARCH_TIMEOUT			0
 
+#define ADAPTIVE_SEARCH_LATENCY_ESCONF_PROP		"/components/search-view/adaptive-search-latency"
+#define DEFAULT_ADAPTIVE_SEARCH_LATENCY			50
+#define MAX_DEFERRED_SEARCH_DELAY				500
+
 struct _EsdashboardSearchViewProviderData
 {
 	gint								refCount;
@@ -120,6 +142,9 @@ struct _EsdashboardSearchViewProviderData
 	EsdashboardSearchResultSet			*lastResultSet;
 
 	ClutterActor						*container;
+
+	EsdashboardSearchViewProviderSearch	*deferredSearch;
+	guint								deferredSearchID;
 };
 
 struct _EsdashboardSearchViewSearchTerms
@@ -130,6 +155,35 @@ struct _EsdashboardSearchViewSearchTerms
 	gchar								**termList;
 };
 
+struct _EsdashboardSearchViewSearch
+{
+	gint								refCount;
+
+	EsdashboardSearchView				*view;
+	EsdashboardSearchViewSearchTerms	*terms;
+	GCancellable						*cancellable;
+
+	guint								pendingProviders;
+	guint								numberResults;
+	gboolean							notifyNoResults;
+
+	ClutterActor						*reselectOldSelection;
+	EsdashboardSearchViewProviderData	*reselectProvider;
+	EsdashboardSelectionTarget			reselectDirection;
+
+#ifdef DEBUG
+	GTimer								*timer;
+#endif
+};
+
+struct _EsdashboardSearchViewProviderSearch
+{
+	EsdashboardSearchViewSearch			*search;
+	EsdashboardSearchViewProviderData	*providerData;
+	gboolean							isIncrementalSearch;
+	gint64								startTime;
+};
+
 /* Callback to ensure current selection is visible after search results were updated */
 static gboolean _esdashboard_search_view_on_repaint_after_update_callback(gpointer inUserData)
 {
@@ -231,6 +285,8 @@ static EsdashboardSearchViewProviderData* _esdashboard_search_view_provider_data
 	data->lastTerms=NULL;
 	data->lastResultSet=NULL;
 	data->container=NULL;
+	data->deferredSearch=NULL;
+	data->deferredSearchID=0;
 
 	return(data);
 }
@@ -429,6 +485,9 @@ static void _esdashboard_search_view_on_search_provider_unregistered(Esdashboard
 		iter=g_list_find(priv->providers, data);
 		if(iter) priv->providers=g_list_delete_link(priv->providers, iter);
 
+		/* Do not start a delayed search at unregistered search provider */
+		_esdashboard_search_view_provider_data_cancel_deferred_search(data);
+
 		/* Free provider data */
 		_esdashboard_search_view_provider_data_unref(data);
 	}
@@ -715,14 +774,16 @@ static gboolean _esdashboard_search_view_can_do_incremental_search(EsdashboardSe
 	/* Check for incremental search. An incremental search can be done
 	 * if the last search terms for a search provider is given, the order
 	 * in last search terms of search provider and the current search terms
-	 * has not changed and each term in both search terms is a case-sensitive
-	 * prefix of the term previously used.
+	 * has not changed and each term previously used is a case-sensitive
+	 * prefix of the term at same position in current search terms. Only
+	 * then each result item of current search must also be a result item
+	 * of last search, so search providers can narrow their last result set.
 	 */
 	iterProvider=inProviderLastTerms->termList;
 	iterCurrent=inCurrentSearchTerms->termList;
 	while(*iterProvider && *iterCurrent)
 	{
-		if(g_strcmp0(*iterProvider, *iterCurrent)>0) return(FALSE);
+		if(!g_str_has_prefix(*iterCurrent, *iterProvider)) return(FALSE);
 
 		iterProvider++;
 		iterCurrent++;
@@ -740,156 +801,165 @@ static gboolean _esdashboard_search_view_can_do_incremental_search(EsdashboardSe
 	return(FALSE);
 }
 
-/* Perform search */
-static guint _esdashboard_search_view_perform_search(EsdashboardSearchView *self, EsdashboardSearchViewSearchTerms *inSearchTerms)
+/* Create data for a search running at search providers */
+static EsdashboardSearchViewSearch* _esdashboard_search_view_search_new(EsdashboardSearchView *self,
+																		EsdashboardSearchViewSearchTerms *inSearchTerms)
 {
-	EsdashboardSearchViewPrivate				*priv;
-	GList										*providers;
-	GList										*iter;
-	guint										numberResults;
-	ClutterActor								*reselectOldSelection;
-	EsdashboardSearchViewProviderData			*reselectProvider;
-	EsdashboardSelectionTarget					reselectDirection;
+	EsdashboardSearchViewSearch			*data;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_VIEW(self), NULL);
+	g_return_val_if_fail(inSearchTerms, NULL);
+
+	/* Create data for search */
+	data=g_new0(EsdashboardSearchViewSearch, 1);
+	data->refCount=1;
+	data->view=self;
+	data->terms=_esdashboard_search_view_search_terms_ref(inSearchTerms);
+	data->cancellable=g_cancellable_new();
+	data->pendingProviders=0;
+	data->numberResults=0;
+	data->notifyNoResults=FALSE;
+	data->reselectOldSelection=NULL;
+	data->reselectProvider=NULL;
+	data->reselectDirection=ESDASHBOARD_SELECTION_TARGET_NEXT;
 #ifdef DEBUG
-	GTimer										*timer=NULL;
+	data->timer=g_timer_new();
 #endif
 
-	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_VIEW(self), 0);
-	g_return_val_if_fail(inSearchTerms, 0);
+	return(data);
+}
 
-	priv=self->priv;
-	numberResults=0;
+/* Free data of search */
+static void _esdashboard_search_view_search_free(EsdashboardSearchViewSearch *inData)
+{
+	g_return_if_fail(inData);
 
+#if DEBUG
+	/* Print a critical warning if more than one references to this object exist.
+	 * This is a debug message and should not be translated.
+	 */
+	if(inData->refCount>1)
+	{
+		g_critical("Freeing EsdashboardSearchViewSearch at %p with %d references",
+					inData,
+					inData->refCount);
+	}
+#endif
+
+	/* Release allocated resources */
 #ifdef DEBUG
-	/* Start timer for debug search performance */
-	timer=g_timer_new();
+	if(inData->timer) g_timer_destroy(inData->timer);
 #endif
+	if(inData->reselectProvider) _esdashboard_search_view_provider_data_unref(inData->reselectProvider);
+	if(inData->cancellable) g_object_unref(inData->cancellable);
+	if(inData->terms) _esdashboard_search_view_search_terms_unref(inData->terms);
+	g_free(inData);
+}
 
-	/* Check if this view has a selection and this one is the first item at
-	 * provider's container so we have to reselect the first item at that
-	 * result container if selection gets lost while updating results for
-	 * this search.
-	 */
-	reselectProvider=NULL;
-	reselectDirection=ESDASHBOARD_SELECTION_TARGET_NEXT;
-	reselectOldSelection=esdashboard_focusable_get_selection(ESDASHBOARD_FOCUSABLE(self));
-	if(reselectOldSelection)
-	{
-		EsdashboardSearchViewProviderData	*providerData;
+/* Increase/decrease reference count for data of search */
+static EsdashboardSearchViewSearch* _esdashboard_search_view_search_ref(EsdashboardSearchViewSearch *inData)
+{
+	g_return_val_if_fail(inData, NULL);
 
-		/* Find data of provider for requested selection and check if current
-		 * selection is the first item at provider's result container.
-		 */
-		providerData=_esdashboard_search_view_get_provider_data_by_actor(self, reselectOldSelection);
-		if(providerData)
-		{
-			ClutterActor					*item;
+	inData->refCount++;
 
-			/* Get last item of provider's result container */
-			item=esdashboard_search_result_container_find_selection(ESDASHBOARD_SEARCH_RESULT_CONTAINER(providerData->container),
-																	NULL,
-																	ESDASHBOARD_SELECTION_TARGET_LAST,
-																	ESDASHBOARD_VIEW(self),
-																	FALSE);
+	return(inData);
+}
 
-			/* Check if it the same as the current selection then remember
-			 * the provider to reselect last item if selection changes
-			 * while updating search results.
-			 */
-			if(reselectOldSelection==item)
-			{
-				reselectProvider=providerData;
-				reselectDirection=ESDASHBOARD_SELECTION_TARGET_LAST;
-			}
+static void _esdashboard_search_view_search_unref(EsdashboardSearchViewSearch *inData)
+{
+	g_return_if_fail(inData);
+	g_return_if_fail(inData->refCount>0);
 
-			/* Get first item of provider's result container */
-			item=esdashboard_search_result_container_find_selection(ESDASHBOARD_SEARCH_RESULT_CONTAINER(providerData->container),
-																	NULL,
-																	ESDASHBOARD_SELECTION_TARGET_FIRST,
-																	ESDASHBOARD_VIEW(self),
-																	FALSE);
+	inData->refCount--;
+	if(inData->refCount==0) _esdashboard_search_view_search_free(inData);
+}
 
-			/* Check if it the same as the current selection then remember
-			 * the provider to reselect first item if selection changes
-			 * while updating search results.
-			 */
-			if(reselectOldSelection==item)
-			{
-				reselectProvider=providerData;
-				reselectDirection=ESDASHBOARD_SELECTION_TARGET_FIRST;
-			}
-		}
-	}
+/* Create data for search at a provider */
+static EsdashboardSearchViewProviderSearch* _esdashboard_search_view_provider_search_new(EsdashboardSearchViewSearch *inSearch,
+																							EsdashboardSearchViewProviderData *inProviderData)
+{
+	EsdashboardSearchViewProviderSearch	*data;
 
-	/* Perform a search at all registered search providers */
-	providers=g_list_copy(priv->providers);
-	g_list_foreach(providers, (GFunc)(void*)_esdashboard_search_view_provider_data_ref, NULL);
-	for(iter=providers; iter; iter=g_list_next(iter))
-	{
-		EsdashboardSearchViewProviderData		*providerData;
-		gboolean								canDoIncrementalSearch;
-		EsdashboardSearchResultSet				*providerNewResultSet;
-		EsdashboardSearchResultSet				*providerLastResultSet;
+	g_return_val_if_fail(inSearch, NULL);
+	g_return_val_if_fail(inProviderData, NULL);
 
-		/* Get data for provider to perform search at */
-		providerData=((EsdashboardSearchViewProviderData*)(iter->data));
+	/* Create data for search at provider */
+	data=g_new0(EsdashboardSearchViewProviderSearch, 1);
+	data->search=_esdashboard_search_view_search_ref(inSearch);
+	data->providerData=_esdashboard_search_view_provider_data_ref(inProviderData);
+	data->isIncrementalSearch=FALSE;
+	data->startTime=0;
 
-		/* Check if we can do an incremental search based on previous
-		 * results or if we have to do a full search.
-		 */
-		canDoIncrementalSearch=FALSE;
-		providerLastResultSet=NULL;
-		if(providerData->lastTerms &&
-			_esdashboard_search_view_can_do_incremental_search(providerData->lastTerms, inSearchTerms))
-		{
-			canDoIncrementalSearch=TRUE;
-			if(providerData->lastResultSet) providerLastResultSet=g_object_ref(providerData->lastResultSet);
-		}
+	return(data);
+}
 
-		/* Perform search */
-		providerNewResultSet=esdashboard_search_provider_get_result_set(providerData->provider,
-																		(const gchar**)inSearchTerms->termList,
-																		providerLastResultSet);
-		ESDASHBOARD_DEBUG(self, MISC,
-							"Performed %s search at search provider %s and got %u result items",
-							canDoIncrementalSearch==TRUE ? "incremental" : "full",
-							G_OBJECT_TYPE_NAME(providerData->provider),
-							providerNewResultSet ? esdashboard_search_result_set_get_size(providerNewResultSet) : 0);
+/* Free data for search at a provider */
+static void _esdashboard_search_view_provider_search_free(EsdashboardSearchViewProviderSearch *inData)
+{
+	g_return_if_fail(inData);
+
+	/* Release allocated resources */
+	if(inData->providerData) _esdashboard_search_view_provider_data_unref(inData->providerData);
+	if(inData->search) _esdashboard_search_view_search_unref(inData->search);
+	g_free(inData);
+}
+
+/* Cancel current search if any is running */
+static void _esdashboard_search_view_cancel_search(EsdashboardSearchView *self)
+{
+	EsdashboardSearchViewPrivate				*priv;
 
-		/* Count number of results */
-		if(providerNewResultSet) numberResults+=esdashboard_search_result_set_get_size(providerNewResultSet);
+	g_return_if_fail(ESDASHBOARD_IS_SEARCH_VIEW(self));
 
-		/* Remember new search term as last one at search provider */
-		if(providerData->lastTerms) _esdashboard_search_view_search_terms_unref(providerData->lastTerms);
-		providerData->lastTerms=_esdashboard_search_view_search_terms_ref(inSearchTerms);
+	priv=self->priv;
 
-		/* Update view of search provider for new result set */
-		_esdashboard_search_view_update_provider_container(self, providerData, providerNewResultSet);
+	/* Cancel current search. Search providers which have not returned their
+	 * result set yet will complete with an error which will be ignored.
+	 */
+	if(priv->currentSearch)
+	{
+		if(priv->currentSearch->pendingProviders>0)
+		{
+			ESDASHBOARD_DEBUG(self, MISC,
+								"Cancelling search for '%s' with %u pending search providers",
+								priv->currentSearch->terms->termString,
+								priv->currentSearch->pendingProviders);
+		}
 
-		/* Release allocated resources */
-		if(providerLastResultSet) g_object_unref(providerLastResultSet);
-		if(providerNewResultSet) g_object_unref(providerNewResultSet);
+		g_cancellable_cancel(priv->currentSearch->cancellable);
+		g_list_foreach(priv->providers, (GFunc)(void*)_esdashboard_search_view_provider_data_cancel_deferred_search, NULL);
+
+		_esdashboard_search_view_search_unref(priv->currentSearch);
+		priv->currentSearch=NULL;
 	}
-	g_list_free_full(providers, (GDestroyNotify)_esdashboard_search_view_provider_data_unref);
+}
 
-	/* Remember new search terms as last one */
-	if(priv->lastTerms) _esdashboard_search_view_search_terms_unref(priv->lastTerms);
-	priv->lastTerms=_esdashboard_search_view_search_terms_ref(inSearchTerms);
+/* All search providers have returned their result sets for a search */
+static void _esdashboard_search_view_search_finished(EsdashboardSearchViewSearch *inSearch)
+{
+	EsdashboardSearchView						*self;
+	EsdashboardSearchViewPrivate				*priv;
+
+	g_return_if_fail(inSearch);
+	g_return_if_fail(ESDASHBOARD_IS_SEARCH_VIEW(inSearch->view));
+
+	self=inSearch->view;
+	priv=self->priv;
 
 #ifdef DEBUG
 	/* Get time for this search for debug performance */
 	ESDASHBOARD_DEBUG(self, MISC,
 						"Updating search for '%s' took %f seconds",
-						inSearchTerms->termString,
-						g_timer_elapsed(timer, NULL));
-	g_timer_destroy(timer);
+						inSearch->terms->termString,
+						g_timer_elapsed(inSearch->timer, NULL));
 #endif
 
 	/* Reselect first or last item at provider if we remembered the provider where
 	 * the item should be reselected and if selection has changed while updating results.
 	 */
-	if(reselectProvider &&
-		reselectProvider->container)
+	if(inSearch->reselectProvider &&
+		inSearch->reselectProvider->container)
 	{
 		ClutterActor							*selection;
 
@@ -899,14 +969,14 @@ static guint _esdashboard_search_view_perform_search(EsdashboardSearchView *self
 		selection=esdashboard_focusable_get_selection(ESDASHBOARD_FOCUSABLE(self));
 
 		/* If selection has changed then re-select first or last item of provider */
-		if(selection!=reselectOldSelection)
+		if(selection!=inSearch->reselectOldSelection)
 		{
 			/* Get new selection which is the first or last item of provider's
 			 * result container.
 			 */
-			selection=esdashboard_search_result_container_find_selection(ESDASHBOARD_SEARCH_RESULT_CONTAINER(reselectProvider->container),
+			selection=esdashboard_search_result_container_find_selection(ESDASHBOARD_SEARCH_RESULT_CONTAINER(inSearch->reselectProvider->container),
 																			NULL,
-																			reselectDirection,
+																			inSearch->reselectDirection,
 																			ESDASHBOARD_VIEW(self),
 																			FALSE);
 
@@ -914,8 +984,8 @@ static guint _esdashboard_search_view_perform_search(EsdashboardSearchView *self
 			esdashboard_focusable_set_selection(ESDASHBOARD_FOCUSABLE(self), selection);
 			ESDASHBOARD_DEBUG(self, ACTOR,
 								"Reselecting selectable item in direction %d at provider %s as old selection vanished",
-								reselectDirection,
-								esdashboard_search_provider_get_name(reselectProvider->provider));
+								inSearch->reselectDirection,
+								esdashboard_search_provider_get_name(inSearch->reselectProvider->provider));
 		}
 	}
 
@@ -951,11 +1021,363 @@ static guint _esdashboard_search_view_perform_search(EsdashboardSearchView *self
 		}
 	}
 
+	/* Notify user if no search provider found any result */
+	if(inSearch->notifyNoResults &&
+		inSearch->numberResults==0)
+	{
+		esdashboard_notify(CLUTTER_ACTOR(self),
+							esdashboard_view_get_icon(ESDASHBOARD_VIEW(self)),
+							_("No results found for '%s'"),
+							inSearch->terms->termString);
+	}
+
+	/* Search is complete so it is not the current one anymore */
+	if(priv->currentSearch==inSearch)
+	{
+		_esdashboard_search_view_search_unref(priv->currentSearch);
+		priv->currentSearch=NULL;
+	}
+
 	/* Emit signal that search was updated */
 	g_signal_emit(self, EsdashboardSearchViewSignals[SIGNAL_SEARCH_UPDATED], 0);
+}
 
-	/* Return number of results */
-	return(numberResults);
+/* A search provider has returned its result set or failed. If it was the last
+ * pending one of a search which was not cancelled then the search has finished.
+ */
+static void _esdashboard_search_view_search_provider_done(EsdashboardSearchViewSearch *inSearch)
+{
+	g_return_if_fail(inSearch);
+	g_return_if_fail(inSearch->pendingProviders>0);
+
+	inSearch->pendingProviders--;
+	if(inSearch->pendingProviders==0 &&
+		!g_cancellable_is_cancelled(inSearch->cancellable))
+	{
+		_esdashboard_search_view_search_finished(inSearch);
+	}
+}
+
+/* A search provider has returned its result set asynchronously */
+static void _esdashboard_search_view_on_provider_result_set_ready(GObject *inSource,
+																	GAsyncResult *inResult,
+																	gpointer inUserData)
+{
+	EsdashboardSearchViewProviderSearch			*providerSearch;
+	EsdashboardSearchViewSearch					*search;
+	EsdashboardSearchViewProviderData			*providerData;
+	EsdashboardSearchView						*self;
+	EsdashboardSearchResultSet					*providerNewResultSet;
+	GError										*error;
+
+	g_return_if_fail(ESDASHBOARD_IS_SEARCH_PROVIDER(inSource));
+	g_return_if_fail(inUserData);
+
+	providerSearch=(EsdashboardSearchViewProviderSearch*)inUserData;
+	search=providerSearch->search;
+	providerData=providerSearch->providerData;
+	error=NULL;
+
+	/* Get result set of search provider */
+	providerNewResultSet=esdashboard_search_provider_get_result_set_finish(ESDASHBOARD_SEARCH_PROVIDER(inSource),
+																			inResult,
+																			&error);
+
+	/* If search was cancelled in the meantime then a newer search was started
+	 * or the search view was reset. Do not touch the search view anymore as
+	 * the result set belongs to an outdated search.
+	 */
+	if(g_cancellable_is_cancelled(search->cancellable))
+	{
+		/* Release allocated resources */
+		if(error) g_error_free(error);
+		if(providerNewResultSet) g_object_unref(providerNewResultSet);
+		_esdashboard_search_view_search_provider_done(search);
+		_esdashboard_search_view_provider_search_free(providerSearch);
+		return;
+	}
+
+	self=search->view;
+
+	/* Add time the search provider needed to return its result set to its
+	 * average latency if search succeeded.
+	 */
+	if(!error)
+	{
+		gdouble								latency;
+
+		latency=(g_get_monotonic_time()-providerSearch->startTime)/1000.0;
+		esdashboard_search_provider_add_latency_sample(providerData->provider, latency);
+	}
+
+	/* Show warning if search at provider failed but continue as if
+	 * search provider returned an empty result set.
+	 */
+	if(error)
+	{
+		g_warning("Search provider %s failed to search for '%s': %s",
+					esdashboard_search_provider_get_name(providerData->provider),
+					search->terms->termString,
+					error->message);
+		g_error_free(error);
+	}
+
+	ESDASHBOARD_DEBUG(self, MISC,
+						"Performed %s search at search provider %s and got %u result items",
+						providerSearch->isIncrementalSearch==TRUE ? "incremental" : "full",
+						G_OBJECT_TYPE_NAME(providerData->provider),
+						providerNewResultSet ? esdashboard_search_result_set_get_size(providerNewResultSet) : 0);
+
+	/* Count number of results */
+	if(providerNewResultSet) search->numberResults+=esdashboard_search_result_set_get_size(providerNewResultSet);
+
+	/* Remember new search term as last one at search provider */
+	if(providerData->lastTerms) _esdashboard_search_view_search_terms_unref(providerData->lastTerms);
+	providerData->lastTerms=_esdashboard_search_view_search_terms_ref(search->terms);
+
+	/* Update view of search provider for new result set as soon as it arrives */
+	_esdashboard_search_view_update_provider_container(self, providerData, providerNewResultSet);
+
+	/* Release allocated resources */
+	if(providerNewResultSet) g_object_unref(providerNewResultSet);
+
+	/* Check if this was the last search provider of this search */
+	_esdashboard_search_view_search_provider_done(search);
+	_esdashboard_search_view_provider_search_free(providerSearch);
+}
+
+/* Start search at a search provider */
+static void _esdashboard_search_view_provider_search_start(EsdashboardSearchViewProviderSearch *inProviderSearch)
+{
+	EsdashboardSearchViewSearch					*search;
+	EsdashboardSearchViewProviderData			*providerData;
+	EsdashboardSearchResultSet					*providerLastResultSet;
+
+	g_return_if_fail(inProviderSearch);
+
+	search=inProviderSearch->search;
+	providerData=inProviderSearch->providerData;
+
+	/* Check if we can do an incremental search based on previous
+	 * results or if we have to do a full search.
+	 */
+	providerLastResultSet=NULL;
+	if(providerData->lastTerms &&
+		_esdashboard_search_view_can_do_incremental_search(providerData->lastTerms, search->terms))
+	{
+		inProviderSearch->isIncrementalSearch=TRUE;
+		providerLastResultSet=providerData->lastResultSet;
+	}
+
+	/* Start search at provider */
+	inProviderSearch->startTime=g_get_monotonic_time();
+	esdashboard_search_provider_get_result_set_async(providerData->provider,
+														(const gchar**)search->terms->termList,
+														providerLastResultSet,
+														search->cancellable,
+														_esdashboard_search_view_on_provider_result_set_ready,
+														inProviderSearch);
+}
+
+/* Delay for search at slow search provider has elapsed without the search
+ * terms being changed, so start the search now.
+ */
+static gboolean _esdashboard_search_view_on_deferred_search_timeout(gpointer inUserData)
+{
+	EsdashboardSearchViewProviderData			*providerData;
+	EsdashboardSearchViewProviderSearch			*providerSearch;
+
+	g_return_val_if_fail(inUserData, G_SOURCE_REMOVE);
+
+	providerData=(EsdashboardSearchViewProviderData*)inUserData;
+
+	/* This source will be removed so unset source ID and take deferred search */
+	providerSearch=providerData->deferredSearch;
+	providerData->deferredSearch=NULL;
+	providerData->deferredSearchID=0;
+
+	/* Start search at provider */
+	if(providerSearch) _esdashboard_search_view_provider_search_start(providerSearch);
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* Drop search which is delayed at search provider, e.g. because the search
+ * terms changed and a new search will be started.
+ */
+static void _esdashboard_search_view_provider_data_cancel_deferred_search(EsdashboardSearchViewProviderData *inData)
+{
+	EsdashboardSearchViewProviderSearch			*providerSearch;
+
+	g_return_if_fail(inData);
+
+	/* Do nothing if no search is delayed */
+	if(!inData->deferredSearchID) return;
+
+	/* Remove timeout source and take deferred search */
+	g_source_remove(inData->deferredSearchID);
+	inData->deferredSearchID=0;
+
+	providerSearch=inData->deferredSearch;
+	inData->deferredSearch=NULL;
+
+	/* The search provider will not return a result set for this search */
+	if(providerSearch)
+	{
+		_esdashboard_search_view_search_provider_done(providerSearch->search);
+		_esdashboard_search_view_provider_search_free(providerSearch);
+	}
+}
+
+/* Perform search. Each search provider is asked asynchronously for its result
+ * set and its container is updated when it returns the result set. A search
+ * still running is cancelled before.
+ */
+static void _esdashboard_search_view_perform_search(EsdashboardSearchView *self,
+													EsdashboardSearchViewSearchTerms *inSearchTerms,
+													gboolean inNotifyNoResults)
+{
+	EsdashboardSearchViewPrivate				*priv;
+	EsdashboardSearchViewSearch					*search;
+	GList										*providers;
+	GList										*iter;
+	ClutterActor								*reselectOldSelection;
+	guint										adaptiveSearchLatency;
+
+	g_return_if_fail(ESDASHBOARD_IS_SEARCH_VIEW(self));
+	g_return_if_fail(inSearchTerms);
+
+	priv=self->priv;
+
+	/* Cancel search still running as its results are outdated now */
+	_esdashboard_search_view_cancel_search(self);
+
+	/* Create data for new search and make it the current one */
+	search=_esdashboard_search_view_search_new(self, inSearchTerms);
+	search->notifyNoResults=inNotifyNoResults;
+	priv->currentSearch=search;
+
+	/* Check if this view has a selection and this one is the first item at
+	 * provider's container so we have to reselect the first item at that
+	 * result container if selection gets lost while updating results for
+	 * this search.
+	 */
+	reselectOldSelection=esdashboard_focusable_get_selection(ESDASHBOARD_FOCUSABLE(self));
+	search->reselectOldSelection=reselectOldSelection;
+	if(reselectOldSelection)
+	{
+		EsdashboardSearchViewProviderData	*providerData;
+
+		/* Find data of provider for requested selection and check if current
+		 * selection is the first item at provider's result container.
+		 */
+		providerData=_esdashboard_search_view_get_provider_data_by_actor(self, reselectOldSelection);
+		if(providerData)
+		{
+			ClutterActor					*item;
+
+			/* Get last item of provider's result container */
+			item=esdashboard_search_result_container_find_selection(ESDASHBOARD_SEARCH_RESULT_CONTAINER(providerData->container),
+																	NULL,
+																	ESDASHBOARD_SELECTION_TARGET_LAST,
+																	ESDASHBOARD_VIEW(self),
+																	FALSE);
+
+			/* Check if it the same as the current selection then remember
+			 * the provider to reselect last item if selection changes
+			 * while updating search results.
+			 */
+			if(reselectOldSelection==item)
+			{
+				search->reselectDirection=ESDASHBOARD_SELECTION_TARGET_LAST;
+				if(!search->reselectProvider) search->reselectProvider=_esdashboard_search_view_provider_data_ref(providerData);
+			}
+
+			/* Get first item of provider's result container */
+			item=esdashboard_search_result_container_find_selection(ESDASHBOARD_SEARCH_RESULT_CONTAINER(providerData->container),
+																	NULL,
+																	ESDASHBOARD_SELECTION_TARGET_FIRST,
+																	ESDASHBOARD_VIEW(self),
+																	FALSE);
+
+			/* Check if it the same as the current selection then remember
+			 * the provider to reselect first item if selection changes
+			 * while updating search results.
+			 */
+			if(reselectOldSelection==item)
+			{
+				search->reselectDirection=ESDASHBOARD_SELECTION_TARGET_FIRST;
+				if(!search->reselectProvider) search->reselectProvider=_esdashboard_search_view_provider_data_ref(providerData);
+			}
+
+			/* Release allocated resources */
+			_esdashboard_search_view_provider_data_unref(providerData);
+		}
+	}
+
+	/* Remember new search terms as last one */
+	if(priv->lastTerms) _esdashboard_search_view_search_terms_unref(priv->lastTerms);
+	priv->lastTerms=_esdashboard_search_view_search_terms_ref(inSearchTerms);
+
+	/* Hold an extra pending provider while starting the searches at all
+	 * search providers, so the search cannot finish before all search
+	 * providers were asked even if they return their result sets immediately.
+	 */
+	search->pendingProviders++;
+
+	/* Get latency up to which search providers are considered fast */
+	adaptiveSearchLatency=esconf_channel_get_uint(priv->esconfChannel,
+													ADAPTIVE_SEARCH_LATENCY_ESCONF_PROP,
+													DEFAULT_ADAPTIVE_SEARCH_LATENCY);
+
+	/* Start a search at all registered search providers */
+	providers=g_list_copy(priv->providers);
+	g_list_foreach(providers, (GFunc)(void*)_esdashboard_search_view_provider_data_ref, NULL);
+	for(iter=providers; iter; iter=g_list_next(iter))
+	{
+		EsdashboardSearchViewProviderData		*providerData;
+		EsdashboardSearchViewProviderSearch		*providerSearch;
+		gdouble									latency;
+
+		/* Get data for provider to perform search at */
+		providerData=((EsdashboardSearchViewProviderData*)(iter->data));
+
+		/* Create data for search at provider */
+		providerSearch=_esdashboard_search_view_provider_search_new(search, providerData);
+		search->pendingProviders++;
+
+		/* Start search at fast search providers immediately. At slow search
+		 * providers delay the search for about the time they usually need and
+		 * restart this delay if search terms change in the meantime.
+		 */
+		latency=esdashboard_search_provider_get_latency(providerData->provider);
+		if(adaptiveSearchLatency==0 || latency<=adaptiveSearchLatency)
+		{
+			_esdashboard_search_view_provider_search_start(providerSearch);
+		}
+			else
+			{
+				guint							delay;
+
+				delay=(guint)CLAMP(latency, adaptiveSearchLatency, MAX_DEFERRED_SEARCH_DELAY);
+
+				ESDASHBOARD_DEBUG(self, MISC,
+									"Delaying search at slow search provider %s with latency of %.2fms by %ums",
+									G_OBJECT_TYPE_NAME(providerData->provider),
+									latency,
+									delay);
+
+				_esdashboard_search_view_provider_data_cancel_deferred_search(providerData);
+				providerData->deferredSearch=providerSearch;
+				providerData->deferredSearchID=g_timeout_add(delay,
+																_esdashboard_search_view_on_deferred_search_timeout,
+																providerData);
+			}
+	}
+	g_list_free_full(providers, (GDestroyNotify)_esdashboard_search_view_provider_data_unref);
+
+	/* All search providers were asked so release extra pending provider */
+	_esdashboard_search_view_search_provider_done(search);
 }
 
 /* Delay timeout was reached so perform initial search now */
@@ -963,22 +1385,14 @@ static gboolean _esdashboard_search_view_on_perform_search_delayed_timeout(gpoin
 {
 	EsdashboardSearchView						*self;
 	EsdashboardSearchViewPrivate				*priv;
-	guint										numberResults;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_VIEW(inUserData), G_SOURCE_REMOVE);
 
 	self=ESDASHBOARD_SEARCH_VIEW(inUserData);
 	priv=self->priv;
 
-	/* Perform search */
-	numberResults=_esdashboard_search_view_perform_search(self, priv->delaySearchTerms);
-	if(numberResults==0)
-	{
-		esdashboard_notify(CLUTTER_ACTOR(self),
-							esdashboard_view_get_icon(ESDASHBOARD_VIEW(self)),
-							_("No results found for '%s'"),
-							priv->delaySearchTerms->termString);
-	}
+	/* Perform search and notify if no results were found */
+	_esdashboard_search_view_perform_search(self, priv->delaySearchTerms, TRUE);
 
 	/* Release allocated resources */
 	if(priv->delaySearchTerms)
@@ -1604,6 +2018,8 @@ static void _esdashboard_search_view_dispose(GObject *inObject)
 		priv->delaySearchTerms=NULL;
 	}
 
+	_esdashboard_search_view_cancel_search(self);
+
 	if(priv->searchManager)
 	{
 		g_signal_handlers_disconnect_by_data(priv->searchManager, self);
@@ -1703,6 +2119,7 @@ static void esdashboard_search_view_init(EsdashboardSearchView *self)
 	priv->searchManager=esdashboard_search_manager_get_default();
 	priv->providers=NULL;
 	priv->lastTerms=NULL;
+	priv->currentSearch=NULL;
 	priv->delaySearch=TRUE;
 	priv->delaySearchTerms=NULL;
 	priv->delaySearchTimeoutID=0;
@@ -1774,6 +2191,9 @@ void esdashboard_search_view_reset_search(EsdashboardSearchView *self)
 		priv->delaySearchTimeoutID=0;
 	}
 
+	/* Cancel search still running */
+	_esdashboard_search_view_cancel_search(self);
+
 	/* Reset all search providers by destroying actors, destroying containers,
 	 * clearing mappings and release all other allocated resources used.
 	 */
@@ -1898,7 +2318,7 @@ void esdashboard_search_view_update_search(EsdashboardSearchView *self, const gc
 		/* ... otherwise perform search immediately */
 		else
 		{
-			_esdashboard_search_view_perform_search(self, searchTerms);
+			_esdashboard_search_view_perform_search(self, searchTerms, FALSE);
 		}
 
 	/* Release allocated resources */
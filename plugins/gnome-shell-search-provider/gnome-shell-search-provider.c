@@ -47,6 +47,17 @@ struct _EsdashboardGnomeShellSearchProviderPrivate
 
 	gchar			*providerName;
 	gchar			*providerIcon;
+
+	GDBusProxy		*proxy;
+	GCancellable	*proxyCancellable;
+	GQueue			*pendingCalls;
+	GHashTable		*metaCache;
+	GQueue			*metaCacheOrder;
+
+	GHashTable		*pendingMetaIdentifiers;
+	GPtrArray		*pendingMetaActors;
+	guint			pendingMetaSourceID;
+	GCancellable	*metaCancellable;
 };
 
 G_DEFINE_DYNAMIC_TYPE_EXTENDED(EsdashboardGnomeShellSearchProvider,
@@ -60,6 +71,63 @@ ESDASHBOARD_DEFINE_PLUGIN_TYPE(esdashboard_gnome_shell_search_provider);
 
 /* IMPLEMENTATION: Private variables and methods */
 #define ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_KEYFILE_GROUP		"Shell Search Provider"
+#define ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_DBUS_INTERFACE		"org.gnome.Shell.SearchProvider2"
+#define ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_META_CACHE_SIZE		256
+#define ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_META_PREFETCH_SIZE	32
+#define ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_ACTOR_IDENTIFIER	"esdashboard-gnome-shell-search-provider-identifier"
+
+typedef struct _EsdashboardGnomeShellSearchProviderPendingCall		EsdashboardGnomeShellSearchProviderPendingCall;
+struct _EsdashboardGnomeShellSearchProviderPendingCall
+{
+	GTask			*task;
+	const gchar		*methodName;
+	GVariant		*parameters;
+};
+
+typedef struct _EsdashboardGnomeShellSearchProviderMetaCacheEntry	EsdashboardGnomeShellSearchProviderMetaCacheEntry;
+struct _EsdashboardGnomeShellSearchProviderMetaCacheEntry
+{
+	gchar			*identifier;
+	GVariant		*metaData;
+};
+
+typedef struct _EsdashboardGnomeShellSearchProviderMetaFetch		EsdashboardGnomeShellSearchProviderMetaFetch;
+struct _EsdashboardGnomeShellSearchProviderMetaFetch
+{
+	EsdashboardGnomeShellSearchProvider		*provider;
+	GPtrArray								*actors;
+};
+
+/* Forward declarations */
+static void _esdashboard_gnome_shell_search_provider_create_proxy_async(EsdashboardGnomeShellSearchProvider *self);
+
+/* Free entry of meta data cache */
+static void _esdashboard_gnome_shell_search_provider_meta_cache_entry_free(EsdashboardGnomeShellSearchProviderMetaCacheEntry *inEntry)
+{
+	g_return_if_fail(inEntry);
+
+	/* Release allocated resources */
+	if(inEntry->metaData) g_variant_unref(inEntry->metaData);
+	if(inEntry->identifier) g_free(inEntry->identifier);
+	g_free(inEntry);
+}
+
+/* Remove all meta data from cache */
+static void _esdashboard_gnome_shell_search_provider_meta_cache_clear(EsdashboardGnomeShellSearchProvider *self)
+{
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+
+	g_return_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self));
+
+	priv=self->priv;
+
+	if(priv->metaCache) g_hash_table_remove_all(priv->metaCache);
+	if(priv->metaCacheOrder)
+	{
+		g_queue_foreach(priv->metaCacheOrder, (GFunc)(void*)_esdashboard_gnome_shell_search_provider_meta_cache_entry_free, NULL);
+		g_queue_clear(priv->metaCacheOrder);
+	}
+}
 
 
 /* IMPLEMENTATION: EsdashboardSearchProvider */
@@ -227,6 +295,26 @@ static gboolean _esdashboard_gnome_shell_search_provider_update_from_file(Esdash
 
 	priv->searchProviderVersion=searchProviderVersion;
 
+	/* Bus name or object path may have changed, so drop connection to search
+	 * provider and cached meta data of result items. If a connection is being
+	 * created, create it again for the new bus name and object path.
+	 */
+	if(priv->proxy)
+	{
+		g_object_unref(priv->proxy);
+		priv->proxy=NULL;
+	}
+
+	if(priv->proxyCancellable)
+	{
+		g_cancellable_cancel(priv->proxyCancellable);
+		g_clear_object(&priv->proxyCancellable);
+
+		_esdashboard_gnome_shell_search_provider_create_proxy_async(self);
+	}
+
+	_esdashboard_gnome_shell_search_provider_meta_cache_clear(self);
+
 	if(priv->providerName) g_free(priv->providerName);
 	if(providerName) priv->providerName=g_strdup(providerName);
 		else priv->providerName=g_strdup(priv->gnomeShellID);
@@ -436,130 +524,266 @@ static const gchar* _esdashboard_gnome_shell_search_provider_get_icon(Esdashboar
 	return(priv->providerIcon);
 }
 
-/* Get result set for requested search terms */
-static EsdashboardSearchResultSet* _esdashboard_gnome_shell_search_provider_get_result_set(EsdashboardSearchProvider *inProvider,
-																							const gchar **inSearchTerms,
-																							EsdashboardSearchResultSet *inPreviousResultSet)
+/* Get D-Bus proxy to Gnome-Shell search provider. The proxy is created once and
+ * kept until the data file of search provider changes. The returned proxy is
+ * owned by search provider and must not be freed.
+ * This function creates the proxy synchronously if it does not exist yet, so
+ * searches create it asynchronously with _create_proxy_async() instead.
+ */
+static GDBusProxy* _esdashboard_gnome_shell_search_provider_get_proxy(EsdashboardGnomeShellSearchProvider *self,
+																		GError **outError)
 {
-	EsdashboardGnomeShellSearchProvider				*self;
 	EsdashboardGnomeShellSearchProviderPrivate		*priv;
-	GError											*error;
-	EsdashboardSearchResultSet						*resultSet;
-	GVariant										*resultItem;
-	GDBusProxy										*proxy;
-	GVariant										*proxyResult;
-	gchar											**proxyResultSet;
-	gchar											**iter;
 
-	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(inProvider), NULL);
+	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self), NULL);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, NULL);
 
-	self=ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(inProvider);
 	priv=self->priv;
-	error=NULL;
-	resultSet=NULL;
 
-	/* Connect to search provider via DBUS */
-	proxy=g_dbus_proxy_new_for_bus_sync(G_BUS_TYPE_SESSION,
-										G_DBUS_PROXY_FLAGS_NONE,
-										NULL,
-										priv->dbusBusName,
-										priv->dbusObjectPath,
-										"org.gnome.Shell.SearchProvider2",
-										NULL,
-										&error);
-	if(!proxy)
+	/* Create proxy if it does not exist yet. The search provider interface
+	 * has neither properties nor signals so do not request them.
+	 */
+	if(!priv->proxy)
 	{
-		/* Show error message */
-		g_warning("Could not create dbus connection for Gnome-Shell search provider '%s': %s",
-					priv->gnomeShellID,
-					(error && error->message) ? error->message : "Unknown error");
+		priv->proxy=g_dbus_proxy_new_for_bus_sync(G_BUS_TYPE_SESSION,
+													G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES | G_DBUS_PROXY_FLAGS_DO_NOT_CONNECT_SIGNALS,
+													NULL,
+													priv->dbusBusName,
+													priv->dbusObjectPath,
+													ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_DBUS_INTERFACE,
+													NULL,
+													outError);
+		if(priv->proxy)
+		{
+			g_debug("Created dbus proxy for Gnome-Shell search provider '%s' using DBUS name '%s' and object path '%s'",
+						priv->gnomeShellID,
+						priv->dbusBusName,
+						priv->dbusObjectPath);
+		}
+	}
 
-		/* Release allocated resources */
-		if(error) g_error_free(error);
+	return(priv->proxy);
+}
 
-		/* Return NULL to indicate error */
-		return(NULL);
+/* Lookup meta data for result item identifier in cache and mark it as most
+ * recently used. The returned meta data is owned by cache.
+ */
+static GVariant* _esdashboard_gnome_shell_search_provider_meta_cache_lookup(EsdashboardGnomeShellSearchProvider *self,
+																			const gchar *inIdentifier)
+{
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+	GList											*link;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self), NULL);
+	g_return_val_if_fail(inIdentifier, NULL);
+
+	priv=self->priv;
+
+	/* Lookup identifier */
+	link=(GList*)g_hash_table_lookup(priv->metaCache, inIdentifier);
+	if(!link) return(NULL);
+
+	/* Move entry to head of queue as it is the most recently used one now */
+	g_queue_unlink(priv->metaCacheOrder, link);
+	g_queue_push_head_link(priv->metaCacheOrder, link);
+
+	return(((EsdashboardGnomeShellSearchProviderMetaCacheEntry*)link->data)->metaData);
+}
+
+/* Store meta data for result item identifier in cache and remove the least
+ * recently used entries if cache is full.
+ */
+static void _esdashboard_gnome_shell_search_provider_meta_cache_insert(EsdashboardGnomeShellSearchProvider *self,
+																		const gchar *inIdentifier,
+																		GVariant *inMetaData)
+{
+	EsdashboardGnomeShellSearchProviderPrivate			*priv;
+	EsdashboardGnomeShellSearchProviderMetaCacheEntry	*entry;
+	GList												*link;
+
+	g_return_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self));
+	g_return_if_fail(inIdentifier);
+	g_return_if_fail(inMetaData);
+
+	priv=self->priv;
+
+	/* Do nothing if cache was destroyed already while meta data was fetched */
+	if(!priv->metaCache) return;
+
+	/* Replace meta data if identifier is cached already */
+	link=(GList*)g_hash_table_lookup(priv->metaCache, inIdentifier);
+	if(link)
+	{
+		entry=(EsdashboardGnomeShellSearchProviderMetaCacheEntry*)link->data;
+		g_variant_unref(entry->metaData);
+		entry->metaData=g_variant_ref(inMetaData);
+
+		g_queue_unlink(priv->metaCacheOrder, link);
+		g_queue_push_head_link(priv->metaCacheOrder, link);
+		return;
 	}
 
-	/* Call search method at search provider depending on if a initial
-	 * result set is requested or an update for a previous result set.
-	 */
-	if(!inPreviousResultSet)
+	/* Add new entry as most recently used one */
+	entry=g_new0(EsdashboardGnomeShellSearchProviderMetaCacheEntry, 1);
+	entry->identifier=g_strdup(inIdentifier);
+	entry->metaData=g_variant_ref(inMetaData);
+
+	g_queue_push_head(priv->metaCacheOrder, entry);
+	g_hash_table_insert(priv->metaCache, entry->identifier, priv->metaCacheOrder->head);
+
+	/* Remove least recently used entries if cache is full */
+	while(g_queue_get_length(priv->metaCacheOrder)>ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_META_CACHE_SIZE)
 	{
-		/* Call search method at search provider to get initial result set */
-		proxyResult=g_dbus_proxy_call_sync(proxy,
-											"GetInitialResultSet",
-											g_variant_new("(^as)", inSearchTerms),
-											G_DBUS_CALL_FLAGS_NONE,
-											-1,
-											NULL,
-											&error);
-		g_debug("Fetched initial result set at %p for Gnome Shell search provider '%s' of type %s",
-					proxyResult,
-					priv->gnomeShellID,
-					G_OBJECT_TYPE_NAME(self));
+		entry=(EsdashboardGnomeShellSearchProviderMetaCacheEntry*)g_queue_pop_tail(priv->metaCacheOrder);
+		g_hash_table_remove(priv->metaCache, entry->identifier);
+		_esdashboard_gnome_shell_search_provider_meta_cache_entry_free(entry);
 	}
-		else
+}
+
+/* Store all meta data returned by a call to 'GetResultMetas' in cache */
+static void _esdashboard_gnome_shell_search_provider_meta_cache_insert_result(EsdashboardGnomeShellSearchProvider *self,
+																				GVariant *inProxyResult)
+{
+	GVariantIter									*resultIter;
+	GVariant										*metaData;
+
+	g_return_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self));
+	g_return_if_fail(inProxyResult);
+
+	resultIter=NULL;
+	g_variant_get(inProxyResult, "(aa{sv})", &resultIter);
+	if(!resultIter) return;
+
+	while((metaData=g_variant_iter_next_value(resultIter)))
+	{
+		const gchar									*resultID;
+
+		/* Store meta data by its ID */
+		if(g_variant_lookup(metaData, "id", "&s", &resultID))
 		{
-			GVariantBuilder						builder;
-			GList								*allPrevResults;
-			GList								*allPrevIter;
-
-			/* Initialize GVariant builder to get a GVariant with an array
-			 * of strings for previous result set.
-			 */
-			g_variant_builder_init(&builder, G_VARIANT_TYPE_STRING_ARRAY);
-
-			/* For each result item in previous result set add a string
-			 * to GVariant builder.
-			 */
-			allPrevResults=esdashboard_search_result_set_get_all(inPreviousResultSet);
-			for(allPrevIter=allPrevResults; allPrevIter; allPrevIter=g_list_next(allPrevIter))
-			{
-				g_variant_builder_add(&builder, "s", g_variant_get_string((GVariant*)allPrevIter->data, NULL));
-			}
-			g_debug("Built previous result set with %d entries for Gnome Shell search provider '%s' of type %s",
-						g_list_length(allPrevResults),
-						priv->gnomeShellID,
-						G_OBJECT_TYPE_NAME(self));
-			g_list_free_full(allPrevResults, (GDestroyNotify)g_variant_unref);
-
-			/* Call search method at search provider to get an update
-			 * for previous result set.
-			 */
-			proxyResult=g_dbus_proxy_call_sync(proxy,
-												"GetSubsearchResultSet",
-												g_variant_new("(as^as)", &builder, inSearchTerms),
-												G_DBUS_CALL_FLAGS_NONE,
-												-1,
-												NULL,
-												&error);
-			g_debug("Fetched subset result set at %p for Gnome Shell search provider '%s' of type %s",
-						proxyResult,
-						priv->gnomeShellID,
-						G_OBJECT_TYPE_NAME(self));
+			_esdashboard_gnome_shell_search_provider_meta_cache_insert(self, resultID, metaData);
 		}
 
-	if(!proxyResult)
+		/* Release allocated resources */
+		g_variant_unref(metaData);
+	}
+
+	/* Release allocated resources */
+	g_variant_iter_free(resultIter);
+}
+
+/* Get list of identifiers of result items in result set which are likely to be
+ * shown and whose meta data is not cached yet. The returned list must be freed
+ * with g_ptr_array_unref().
+ */
+static GPtrArray* _esdashboard_gnome_shell_search_provider_get_uncached_identifiers(EsdashboardGnomeShellSearchProvider *self,
+																					EsdashboardSearchResultSet *inResultSet)
+{
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+	GPtrArray										*identifiers;
+	GVariant										*resultItem;
+	guint											i;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self), NULL);
+	g_return_val_if_fail(ESDASHBOARD_IS_SEARCH_RESULT_SET(inResultSet), NULL);
+
+	priv=self->priv;
+	identifiers=g_ptr_array_new_with_free_func(g_free);
+
+	/* Iterate through result items in the order they will be shown */
+	for(i=0; i<ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_META_PREFETCH_SIZE; i++)
 	{
-		/* Show error message */
-		g_warning("Could get result set from dbus connection for Gnome-Shell search provider '%s': %s",
-					priv->gnomeShellID,
-					(error && error->message) ? error->message : "Unknown error");
+		const gchar									*identifier;
 
-		/* Release allocated resources */
-		if(error) g_error_free(error);
-		if(proxy) g_object_unref(proxy);
+		resultItem=esdashboard_search_result_set_get_item_at(inResultSet, i);
+		if(!resultItem) break;
 
-		/* Return NULL to indicate error */
-		return(NULL);
+		identifier=g_variant_get_string(resultItem, NULL);
+		if(!g_hash_table_contains(priv->metaCache, identifier))
+		{
+			g_ptr_array_add(identifiers, g_strdup(identifier));
+		}
+	}
+
+	/* Terminate list with NULL so it can be used as string vector */
+	g_ptr_array_add(identifiers, NULL);
+
+	return(identifiers);
+}
+
+/* Build parameters for D-Bus call to get a result set. If a previous result set
+ * is given an update for it is requested, otherwise an initial result set.
+ */
+static GVariant* _esdashboard_gnome_shell_search_provider_build_result_set_call(EsdashboardGnomeShellSearchProvider *self,
+																				const gchar **inSearchTerms,
+																				EsdashboardSearchResultSet *inPreviousResultSet,
+																				const gchar **outMethodName)
+{
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+	GVariantBuilder									builder;
+	GList											*allPrevResults;
+	GList											*allPrevIter;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self), NULL);
+	g_return_val_if_fail(inSearchTerms, NULL);
+	g_return_val_if_fail(outMethodName, NULL);
+
+	priv=self->priv;
+
+	/* Call search method at search provider to get initial result set */
+	if(!inPreviousResultSet)
+	{
+		*outMethodName="GetInitialResultSet";
+		return(g_variant_new("(^as)", inSearchTerms));
+	}
+
+	/* Initialize GVariant builder to get a GVariant with an array
+	 * of strings for previous result set.
+	 */
+	g_variant_builder_init(&builder, G_VARIANT_TYPE_STRING_ARRAY);
+
+	/* For each result item in previous result set add a string
+	 * to GVariant builder.
+	 */
+	allPrevResults=esdashboard_search_result_set_get_all(inPreviousResultSet);
+	for(allPrevIter=allPrevResults; allPrevIter; allPrevIter=g_list_next(allPrevIter))
+	{
+		g_variant_builder_add(&builder, "s", g_variant_get_string((GVariant*)allPrevIter->data, NULL));
 	}
+	g_debug("Built previous result set with %d entries for Gnome Shell search provider '%s' of type %s",
+				g_list_length(allPrevResults),
+				priv->gnomeShellID,
+				G_OBJECT_TYPE_NAME(self));
+	g_list_free_full(allPrevResults, (GDestroyNotify)g_variant_unref);
+
+	/* Call search method at search provider to get an update
+	 * for previous result set.
+	 */
+	*outMethodName="GetSubsearchResultSet";
+	return(g_variant_new("(as^as)", &builder, inSearchTerms));
+}
+
+/* Create result set from result of D-Bus call to get a result set */
+static EsdashboardSearchResultSet* _esdashboard_gnome_shell_search_provider_create_result_set(EsdashboardGnomeShellSearchProvider *self,
+																								GVariant *inProxyResult)
+{
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+	EsdashboardSearchResultSet						*resultSet;
+	GVariant										*resultItem;
+	gchar											**proxyResultSet;
+	gchar											**iter;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self), NULL);
+	g_return_val_if_fail(inProxyResult, NULL);
+
+	priv=self->priv;
+	resultSet=NULL;
 
 	/* Retrieve result set for this application from returned result set of
 	 * search provider.
 	 */
 	proxyResultSet=NULL;
-	g_variant_get(proxyResult, "(^as)", &proxyResultSet);
+	g_variant_get(inProxyResult, "(^as)", &proxyResultSet);
 
 	if(proxyResultSet)
 	{
@@ -589,51 +813,39 @@ static EsdashboardSearchResultSet* _esdashboard_gnome_shell_search_provider_get_
 
 	/* Release allocated resources */
 	if(proxyResultSet) g_strfreev(proxyResultSet);
-	if(proxyResult) g_variant_unref(proxyResult);
-	if(proxy) g_object_unref(proxy);
 
 	/* Return result set */
 	return(resultSet);
 }
 
-/* Create actor for a result item of the result set returned from a search request */
-static ClutterActor* _esdashboard_gnome_shell_search_provider_create_result_actor(EsdashboardSearchProvider *inProvider,
-																					GVariant *inResultItem)
+/* Get result set for requested search terms */
+static EsdashboardSearchResultSet* _esdashboard_gnome_shell_search_provider_get_result_set(EsdashboardSearchProvider *inProvider,
+																							const gchar **inSearchTerms,
+																							EsdashboardSearchResultSet *inPreviousResultSet)
 {
 	EsdashboardGnomeShellSearchProvider				*self;
 	EsdashboardGnomeShellSearchProviderPrivate		*priv;
 	GError											*error;
-	const gchar										*identifier[2];
-	ClutterActor									*actor;
+	EsdashboardSearchResultSet						*resultSet;
 	GDBusProxy										*proxy;
 	GVariant										*proxyResult;
-	GVariantIter									*resultIter;
-	gchar											*name;
-	gchar											*description;
-	GIcon											*icon;
-	ClutterContent									*iconImage;
+	const gchar										*methodName;
+	GVariant										*parameters;
 
 	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(inProvider), NULL);
-	g_return_val_if_fail(inResultItem, NULL);
 
 	self=ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(inProvider);
 	priv=self->priv;
-	actor=NULL;
-	name=NULL;
-	description=NULL;
-	icon=NULL;
-	iconImage=NULL;
 	error=NULL;
 
-	/* Get meta data of result item */
-	proxy=g_dbus_proxy_new_for_bus_sync(G_BUS_TYPE_SESSION,
-										G_DBUS_PROXY_FLAGS_NONE,
-										NULL,
-										priv->dbusBusName,
-										priv->dbusObjectPath,
-										"org.gnome.Shell.SearchProvider2",
-										NULL,
-										&error);
+	/* A refined search cannot find anything if previous result set is empty */
+	if(inPreviousResultSet && esdashboard_search_result_set_get_size(inPreviousResultSet)==0)
+	{
+		return(esdashboard_search_result_set_new());
+	}
+
+	/* Get connection to search provider via DBUS */
+	proxy=_esdashboard_gnome_shell_search_provider_get_proxy(self, &error);
 	if(!proxy)
 	{
 		/* Show error message */
@@ -648,193 +860,828 @@ static ClutterActor* _esdashboard_gnome_shell_search_provider_create_result_acto
 		return(NULL);
 	}
 
-	identifier[0]=g_variant_get_string(inResultItem, NULL);
-	identifier[1]=NULL;
+	/* Call search method at search provider depending on if a initial
+	 * result set is requested or an update for a previous result set.
+	 */
+	parameters=_esdashboard_gnome_shell_search_provider_build_result_set_call(self, inSearchTerms, inPreviousResultSet, &methodName);
 	proxyResult=g_dbus_proxy_call_sync(proxy,
-										"GetResultMetas",
-										g_variant_new("(^as)", identifier),
+										methodName,
+										parameters,
 										G_DBUS_CALL_FLAGS_NONE,
 										-1,
 										NULL,
 										&error);
+
+	/* If updating previous result set failed, e.g. because search provider
+	 * has forgotten about it, request an initial result set instead.
+	 */
+	if(!proxyResult && inPreviousResultSet)
+	{
+		g_debug("Could not update previous result set for Gnome-Shell search provider '%s', requesting initial result set: %s",
+					priv->gnomeShellID,
+					(error && error->message) ? error->message : "Unknown error");
+		g_clear_error(&error);
+
+		parameters=_esdashboard_gnome_shell_search_provider_build_result_set_call(self, inSearchTerms, NULL, &methodName);
+		proxyResult=g_dbus_proxy_call_sync(proxy,
+											methodName,
+											parameters,
+											G_DBUS_CALL_FLAGS_NONE,
+											-1,
+											NULL,
+											&error);
+	}
+
 	if(!proxyResult)
 	{
 		/* Show error message */
-		g_warning("Could get meta data for '%s' from dbus connection for Gnome-Shell search provider '%s': %s",
-					identifier[0],
+		g_warning("Could get result set from dbus connection for Gnome-Shell search provider '%s': %s",
 					priv->gnomeShellID,
 					(error && error->message) ? error->message : "Unknown error");
 
 		/* Release allocated resources */
 		if(error) g_error_free(error);
-		if(proxy) g_object_unref(proxy);
 
 		/* Return NULL to indicate error */
 		return(NULL);
 	}
 
-	/* Extract meta data from result we got from dbus call */
-	resultIter=NULL;
-
-	g_variant_get(proxyResult, "(aa{sv})", &resultIter);
-	if(resultIter)
-	{
-		GVariant									*metaData;
+	g_debug("Fetched result set at %p via %s for Gnome Shell search provider '%s' of type %s",
+				proxyResult,
+				methodName,
+				priv->gnomeShellID,
+				G_OBJECT_TYPE_NAME(self));
 
-		while((metaData=g_variant_iter_next_value(resultIter)))
-		{
-			GVariant								*iconVariant;
-			gchar									*iconString;
-			gint32									iconWidth;
-			gint32									iconHeight;
-			gint32									iconRowstride;
-			gboolean								iconHasAlpha;
-			gint32									iconBits;
-			gint32									iconChannels;
-			guchar									*iconData;
-			gchar									*resultID;
-
-			/* Get ID from meta data and check if it matches the ID requested.
-			 * If not try next meta data item in result.
-			 */
-			resultID=NULL;
-			if(!g_variant_lookup(metaData, "id", "s", &resultID) ||
-				g_strcmp0(resultID, identifier[0])!=0)
-			{
-				if(resultID) g_free(resultID);
-				continue;
-			}
+	/* Create result set from result of search provider */
+	resultSet=_esdashboard_gnome_shell_search_provider_create_result_set(self, proxyResult);
 
-			g_free(resultID);
+	/* Release allocated resources */
+	if(proxyResult) g_variant_unref(proxyResult);
 
-			/* Get name from meta data */
-			g_variant_lookup(metaData, "name", "s", &name);
+	/* Return result set */
+	return(resultSet);
+}
 
-			/* Get description from meta data */
-			g_variant_lookup(metaData, "description", "s", &description);
+/* Meta data of result items likely to be shown were fetched asynchronously */
+static void _esdashboard_gnome_shell_search_provider_on_get_result_metas_done(GObject *inSource,
+																				GAsyncResult *inResult,
+																				gpointer inUserData)
+{
+	GTask											*task;
+	EsdashboardGnomeShellSearchProvider				*self;
+	EsdashboardSearchResultSet						*resultSet;
+	GVariant										*proxyResult;
+	GError											*error;
 
-			/* Get icon from meta data.
-			 * Try first to deserialize "icon" if available and supported,
-			 * then try to decode "gicon" if available and at last try
-			 * raw bytes from "icon-data".
-			 */
-#if GLIB_CHECK_VERSION(2, 38, 0)
-			if(!icon && g_variant_lookup(metaData, "icon", "v", &iconVariant))
-			{
-				/* Try deserializing icon from variant extracted from meta data */
-				icon=g_icon_deserialize(iconVariant);
-				if(!icon)
-				{
-					/* Show error message */
-					g_warning("Could get icon for '%s' of key '%s' for Gnome-Shell search provider '%s': %s",
-								identifier[0],
-								"icon",
-								priv->gnomeShellID,
-								"Deserialization failed");
-				}
+	g_return_if_fail(G_IS_TASK(inUserData));
 
-				/* Release data extracted for icon */
-				g_variant_unref(iconVariant);
-			}
-#endif
+	task=G_TASK(inUserData);
+	self=ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(g_task_get_source_object(task));
+	resultSet=ESDASHBOARD_SEARCH_RESULT_SET(g_task_get_task_data(task));
+	error=NULL;
 
-			if(!icon && g_variant_lookup(metaData, "gicon", "s", &iconString))
+	/* Store fetched meta data in cache. If fetching failed the meta data will
+	 * be fetched when creating the actor for a result item.
+	 */
+	proxyResult=g_dbus_proxy_call_finish(G_DBUS_PROXY(inSource), inResult, &error);
+	if(proxyResult)
+	{
+		_esdashboard_gnome_shell_search_provider_meta_cache_insert_result(self, proxyResult);
+		g_variant_unref(proxyResult);
+	}
+		else
+		{
+			if(!g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
 			{
-				/* Try decoding icon from string extracted from meta data */
-				icon=g_icon_new_for_string(iconString, &error);
-				if(!icon)
-				{
-					/* Show error message */
-					g_warning("Could get icon for '%s' of key '%s' for Gnome-Shell search provider '%s': %s",
-								identifier[0],
-								"gicon",
-								priv->gnomeShellID,
-								(error && error->message) ? error->message : "Unknown error");
-
-					/* Release allocated resources */
-					if(error)
-					{
-						g_error_free(error);
-						error=NULL;
-					}
-				}
-
-				/* Release data extracted for icon */
-				g_free(iconString);
+				g_warning("Could not prefetch meta data from dbus connection for Gnome-Shell search provider '%s': %s",
+							self->priv->gnomeShellID,
+							(error && error->message) ? error->message : "Unknown error");
 			}
+			g_error_free(error);
+		}
 
-			if(g_variant_lookup(metaData, "icon-data", "(iiibiiay)", &iconWidth, &iconHeight, &iconRowstride, &iconHasAlpha, &iconBits, &iconChannels, &iconData))
-			{
-				/* Create image from icon data */
-				iconImage=clutter_image_new();
-				if(!clutter_image_set_data(CLUTTER_IMAGE(iconImage), iconData, iconHasAlpha ? COGL_PIXEL_FORMAT_RGBA_8888 : COGL_PIXEL_FORMAT_RGB_888, iconWidth, iconHeight, iconRowstride, &error))
-				{
-					/* Show error message */
-					g_warning("Could get icon for '%s' of key '%s' for Gnome-Shell search provider '%s': %s",
-								identifier[0],
-								"icon-data",
-								priv->gnomeShellID,
-								(error && error->message) ? error->message : "Unknown error");
-
-					/* Release allocated resources */
-					if(error)
-					{
-						g_error_free(error);
-						error=NULL;
-					}
-				}
-
-				/* Release data extracted for icon */
-				g_free(iconData);
-			}
+	/* Return result set */
+	g_task_return_pointer(task, g_object_ref(resultSet), g_object_unref);
+
+	/* Release allocated resources */
+	g_object_unref(task);
+}
+
+/* Result set was fetched asynchronously */
+static void _esdashboard_gnome_shell_search_provider_on_get_result_set_done(GObject *inSource,
+																				GAsyncResult *inResult,
+																				gpointer inUserData)
+{
+	GTask											*task;
+	EsdashboardGnomeShellSearchProvider				*self;
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+	EsdashboardSearchResultSet						*resultSet;
+	GVariant										*proxyResult;
+	GPtrArray										*identifiers;
+	GError											*error;
+
+	g_return_if_fail(G_IS_TASK(inUserData));
+
+	task=G_TASK(inUserData);
+	self=ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(g_task_get_source_object(task));
+	priv=self->priv;
+	error=NULL;
+
+	/* Get result of D-Bus call */
+	proxyResult=g_dbus_proxy_call_finish(G_DBUS_PROXY(inSource), inResult, &error);
+
+	/* If updating previous result set failed, e.g. because search provider
+	 * has forgotten about it, request an initial result set instead. The search
+	 * terms are only stored at task if an update was requested.
+	 */
+	if(!proxyResult &&
+		g_task_get_task_data(task) &&
+		!g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+	{
+		const gchar								*methodName;
+		GVariant								*parameters;
+
+		g_debug("Could not update previous result set for Gnome-Shell search provider '%s', requesting initial result set: %s",
+					priv->gnomeShellID,
+					(error && error->message) ? error->message : "Unknown error");
+		g_clear_error(&error);
+
+		parameters=_esdashboard_gnome_shell_search_provider_build_result_set_call(self, (const gchar**)g_task_get_task_data(task), NULL, &methodName);
+		g_task_set_task_data(task, NULL, NULL);
+
+		g_dbus_proxy_call(G_DBUS_PROXY(inSource),
+							methodName,
+							parameters,
+							G_DBUS_CALL_FLAGS_NONE,
+							-1,
+							g_task_get_cancellable(task),
+							_esdashboard_gnome_shell_search_provider_on_get_result_set_done,
+							task);
+		return;
+	}
+
+	if(!proxyResult)
+	{
+		/* Return error */
+		g_task_return_error(task, error);
+
+		/* Release allocated resources */
+		g_object_unref(task);
+
+		return;
+	}
+
+	/* Create result set from result of search provider */
+	resultSet=_esdashboard_gnome_shell_search_provider_create_result_set(self, proxyResult);
+	g_variant_unref(proxyResult);
+
+	if(!resultSet)
+	{
+		g_task_return_pointer(task, NULL, NULL);
+		g_object_unref(task);
+		return;
+	}
+
+	/* Fetch meta data of all result items likely to be shown and not cached
+	 * yet in one call before returning result set. So creating actors for
+	 * these result items will not block on a D-Bus call for each item.
+	 */
+	identifiers=NULL;
+	if(priv->proxy) identifiers=_esdashboard_gnome_shell_search_provider_get_uncached_identifiers(self, resultSet);
+
+	if(identifiers && identifiers->len>1)
+	{
+		g_debug("Fetching meta data of %u result items for Gnome Shell search provider '%s' of type %s",
+					identifiers->len-1,
+					priv->gnomeShellID,
+					G_OBJECT_TYPE_NAME(self));
+
+		g_task_set_task_data(task, resultSet, g_object_unref);
+		g_dbus_proxy_call(priv->proxy,
+							"GetResultMetas",
+							g_variant_new("(^as)", (gchar**)identifiers->pdata),
+							G_DBUS_CALL_FLAGS_NONE,
+							-1,
+							g_task_get_cancellable(task),
+							_esdashboard_gnome_shell_search_provider_on_get_result_metas_done,
+							task);
+	}
+		else
+		{
+			/* Return result set */
+			g_task_return_pointer(task, resultSet, g_object_unref);
 
 			/* Release allocated resources */
-			g_variant_unref(metaData);
+			g_object_unref(task);
 		}
+
+	/* Release allocated resources */
+	if(identifiers) g_ptr_array_unref(identifiers);
+}
+
+/* Free a search call waiting for D-Bus proxy to be created */
+static void _esdashboard_gnome_shell_search_provider_pending_call_free(EsdashboardGnomeShellSearchProviderPendingCall *inCall)
+{
+	g_return_if_fail(inCall);
+
+	/* Release allocated resources */
+	if(inCall->task) g_object_unref(inCall->task);
+	if(inCall->parameters) g_variant_unref(inCall->parameters);
+	g_free(inCall);
+}
+
+/* Call search method at search provider via D-Bus proxy which must exist */
+static void _esdashboard_gnome_shell_search_provider_call_result_set(EsdashboardGnomeShellSearchProvider *self,
+																		GTask *inTask,
+																		const gchar *inMethodName,
+																		GVariant *inParameters)
+{
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+
+	g_return_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self));
+	g_return_if_fail(G_IS_TASK(inTask));
+	g_return_if_fail(inMethodName && *inMethodName);
+	g_return_if_fail(inParameters);
+
+	priv=self->priv;
+
+	g_return_if_fail(priv->proxy);
+
+	/* The task is passed to callback and released by it */
+	g_dbus_proxy_call(priv->proxy,
+						inMethodName,
+						inParameters,
+						G_DBUS_CALL_FLAGS_NONE,
+						-1,
+						g_task_get_cancellable(inTask),
+						_esdashboard_gnome_shell_search_provider_on_get_result_set_done,
+						inTask);
+}
+
+/* D-Bus proxy to Gnome-Shell search provider was created asynchronously */
+static void _esdashboard_gnome_shell_search_provider_on_proxy_created(GObject *inSource,
+																		GAsyncResult *inResult,
+																		gpointer inUserData)
+{
+	EsdashboardGnomeShellSearchProvider				*self;
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+	GDBusProxy										*proxy;
+	EsdashboardGnomeShellSearchProviderPendingCall	*call;
+	GError											*error;
+
+	g_return_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(inUserData));
+
+	self=ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(inUserData);
+	priv=self->priv;
+	error=NULL;
+
+	proxy=g_dbus_proxy_new_for_bus_finish(inResult, &error);
+
+	/* If creating proxy was cancelled the search provider was either disposed
+	 * or a new proxy for another bus name or object path is being created.
+	 * In both cases the pending calls were taken care of already.
+	 */
+	if(g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+	{
+		/* Release allocated resources */
+		g_error_free(error);
+		g_object_unref(self);
+
+		return;
 	}
 
-	/* Create actor for result item */
-	if(name)
+	g_clear_object(&priv->proxyCancellable);
+
+	if(proxy)
 	{
-		gchar										*buttonText;
+		g_debug("Created dbus proxy for Gnome-Shell search provider '%s' using DBUS name '%s' and object path '%s'",
+					priv->gnomeShellID,
+					priv->dbusBusName,
+					priv->dbusObjectPath);
 
-		/* Build text to show at button */
-		if(description) buttonText=g_markup_printf_escaped("<b>%s</b>\n\n%s", name, description);
-			else buttonText=g_markup_printf_escaped("<b>%s</b>", name);
+		/* A proxy may have been created synchronously meanwhile, so keep that one */
+		if(!priv->proxy) priv->proxy=proxy;
+			else g_object_unref(proxy);
+	}
+		else
+		{
+			g_warning("Could not create dbus connection for Gnome-Shell search provider '%s': %s",
+						priv->gnomeShellID,
+						(error && error->message) ? error->message : "Unknown error");
+		}
 
-		/* Create actor and set icon if available */
-		actor=esdashboard_button_new_with_text(buttonText);
+	/* Start all searches waiting for proxy or let them fail */
+	while((call=g_queue_pop_head(priv->pendingCalls)))
+	{
+		if(priv->proxy)
+		{
+			_esdashboard_gnome_shell_search_provider_call_result_set(self, call->task, call->methodName, call->parameters);
+
+			/* Task was passed to callback of call which releases it */
+			call->task=NULL;
+		}
+			else g_task_return_error(call->task, g_error_copy(error));
+
+		_esdashboard_gnome_shell_search_provider_pending_call_free(call);
+	}
+
+	/* Release allocated resources */
+	if(error) g_error_free(error);
+	g_object_unref(self);
+}
+
+/* Create D-Bus proxy to Gnome-Shell search provider asynchronously if it
+ * does not exist yet and is not being created already. The search provider
+ * interface has neither properties nor signals so do not request them.
+ */
+static void _esdashboard_gnome_shell_search_provider_create_proxy_async(EsdashboardGnomeShellSearchProvider *self)
+{
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+
+	g_return_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self));
+
+	priv=self->priv;
+
+	if(priv->proxy || priv->proxyCancellable) return;
+
+	priv->proxyCancellable=g_cancellable_new();
+	g_dbus_proxy_new_for_bus(G_BUS_TYPE_SESSION,
+								G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES | G_DBUS_PROXY_FLAGS_DO_NOT_CONNECT_SIGNALS,
+								NULL,
+								priv->dbusBusName,
+								priv->dbusObjectPath,
+								ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_DBUS_INTERFACE,
+								priv->proxyCancellable,
+								_esdashboard_gnome_shell_search_provider_on_proxy_created,
+								g_object_ref(self));
+}
+
+/* Get result set for requested search terms asynchronously */
+static void _esdashboard_gnome_shell_search_provider_get_result_set_async(EsdashboardSearchProvider *inProvider,
+																			const gchar **inSearchTerms,
+																			EsdashboardSearchResultSet *inPreviousResultSet,
+																			GCancellable *inCancellable,
+																			GAsyncReadyCallback inCallback,
+																			gpointer inUserData)
+{
+	EsdashboardGnomeShellSearchProvider				*self;
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+	GTask											*task;
+	const gchar										*methodName;
+	GVariant										*parameters;
+
+	g_return_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(inProvider));
+
+	self=ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(inProvider);
+	priv=self->priv;
 
-		if(icon)
+	task=g_task_new(self, inCancellable, inCallback, inUserData);
+	g_task_set_source_tag(task, _esdashboard_gnome_shell_search_provider_get_result_set_async);
+
+	/* A refined search cannot find anything if previous result set is empty */
+	if(inPreviousResultSet && esdashboard_search_result_set_get_size(inPreviousResultSet)==0)
+	{
+		/* Return empty result set */
+		g_task_return_pointer(task, esdashboard_search_result_set_new(), g_object_unref);
+
+		/* Release allocated resources */
+		g_object_unref(task);
+
+		return;
+	}
+
+	/* Call search method at search provider depending on if a initial
+	 * result set is requested or an update for a previous result set.
+	 */
+	parameters=_esdashboard_gnome_shell_search_provider_build_result_set_call(self, inSearchTerms, inPreviousResultSet, &methodName);
+
+	/* Keep search terms to request an initial result set if updating
+	 * previous result set fails.
+	 */
+	if(inPreviousResultSet)
+	{
+		g_task_set_task_data(task, g_strdupv((gchar**)inSearchTerms), (GDestroyNotify)g_strfreev);
+	}
+
+	/* Call search method now if connection to search provider via DBUS exists.
+	 * Otherwise create connection asynchronously, as the search provider may
+	 * need to be activated first, and queue this call until it is created.
+	 */
+	if(priv->proxy)
+	{
+		_esdashboard_gnome_shell_search_provider_call_result_set(self, task, methodName, parameters);
+	}
+		else
+		{
+			EsdashboardGnomeShellSearchProviderPendingCall	*call;
+
+			call=g_new0(EsdashboardGnomeShellSearchProviderPendingCall, 1);
+			call->task=task;
+			call->methodName=methodName;
+			call->parameters=g_variant_ref_sink(parameters);
+			g_queue_push_tail(priv->pendingCalls, call);
+
+			_esdashboard_gnome_shell_search_provider_create_proxy_async(self);
+		}
+}
+
+static EsdashboardSearchResultSet* _esdashboard_gnome_shell_search_provider_get_result_set_finish(EsdashboardSearchProvider *inProvider,
+																									GAsyncResult *inResult,
+																									GError **outError)
+{
+	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(inProvider), NULL);
+	g_return_val_if_fail(g_task_is_valid(inResult, inProvider), NULL);
+
+	return(g_task_propagate_pointer(G_TASK(inResult), outError));
+}
+
+/* Set up actor for result item from its meta data.
+ * Returns FALSE if meta data does not provide a name to show.
+ */
+static gboolean _esdashboard_gnome_shell_search_provider_set_actor_meta(EsdashboardGnomeShellSearchProvider *self,
+																		ClutterActor *inActor,
+																		const gchar *inIdentifier,
+																		GVariant *inMetaData)
+{
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+	GError											*error;
+	gchar											*name;
+	gchar											*description;
+	GIcon											*icon;
+	ClutterContent									*iconImage;
+	GVariant										*iconVariant;
+	gchar											*iconString;
+	gint32											iconWidth;
+	gint32											iconHeight;
+	gint32											iconRowstride;
+	gboolean										iconHasAlpha;
+	gint32											iconBits;
+	gint32											iconChannels;
+	guchar											*iconData;
+	gchar											*buttonText;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self), FALSE);
+	g_return_val_if_fail(ESDASHBOARD_IS_BUTTON(inActor), FALSE);
+	g_return_val_if_fail(inIdentifier, FALSE);
+	g_return_val_if_fail(inMetaData, FALSE);
+
+	priv=self->priv;
+	name=NULL;
+	description=NULL;
+	icon=NULL;
+	iconImage=NULL;
+	error=NULL;
+
+	/* Get name from meta data */
+	g_variant_lookup(inMetaData, "name", "s", &name);
+	if(!name) return(FALSE);
+
+	/* Get description from meta data */
+	g_variant_lookup(inMetaData, "description", "s", &description);
+
+	/* Get icon from meta data.
+	 * Try first to deserialize "icon" if available and supported,
+	 * then try to decode "gicon" if available and at last try
+	 * raw bytes from "icon-data".
+	 */
+#if GLIB_CHECK_VERSION(2, 38, 0)
+	if(!icon && g_variant_lookup(inMetaData, "icon", "v", &iconVariant))
+	{
+		/* Try deserializing icon from variant extracted from meta data */
+		icon=g_icon_deserialize(iconVariant);
+		if(!icon)
+		{
+			/* Show error message */
+			g_warning("Could get icon for '%s' of key '%s' for Gnome-Shell search provider '%s': %s",
+						inIdentifier,
+						"icon",
+						priv->gnomeShellID,
+						"Deserialization failed");
+		}
+
+		/* Release data extracted for icon */
+		g_variant_unref(iconVariant);
+	}
+#endif
+
+	if(!icon && g_variant_lookup(inMetaData, "gicon", "s", &iconString))
+	{
+		/* Try decoding icon from string extracted from meta data */
+		icon=g_icon_new_for_string(iconString, &error);
+		if(!icon)
 		{
-			esdashboard_label_set_style(ESDASHBOARD_LABEL(actor), ESDASHBOARD_LABEL_STYLE_BOTH);
-			esdashboard_label_set_gicon(ESDASHBOARD_LABEL(actor), icon);
+			/* Show error message */
+			g_warning("Could get icon for '%s' of key '%s' for Gnome-Shell search provider '%s': %s",
+						inIdentifier,
+						"gicon",
+						priv->gnomeShellID,
+						(error && error->message) ? error->message : "Unknown error");
+
+			/* Release allocated resources */
+			if(error)
+			{
+				g_error_free(error);
+				error=NULL;
+			}
 		}
-			else if(iconImage)
+
+		/* Release data extracted for icon */
+		g_free(iconString);
+	}
+
+	if(g_variant_lookup(inMetaData, "icon-data", "(iiibiiay)", &iconWidth, &iconHeight, &iconRowstride, &iconHasAlpha, &iconBits, &iconChannels, &iconData))
+	{
+		/* Create image from icon data */
+		iconImage=clutter_image_new();
+		if(!clutter_image_set_data(CLUTTER_IMAGE(iconImage), iconData, iconHasAlpha ? COGL_PIXEL_FORMAT_RGBA_8888 : COGL_PIXEL_FORMAT_RGB_888, iconWidth, iconHeight, iconRowstride, &error))
+		{
+			/* Show error message */
+			g_warning("Could get icon for '%s' of key '%s' for Gnome-Shell search provider '%s': %s",
+						inIdentifier,
+						"icon-data",
+						priv->gnomeShellID,
+						(error && error->message) ? error->message : "Unknown error");
+
+			/* Release allocated resources */
+			if(error)
 			{
-				esdashboard_label_set_style(ESDASHBOARD_LABEL(actor), ESDASHBOARD_LABEL_STYLE_BOTH);
-				esdashboard_label_set_icon_image(ESDASHBOARD_LABEL(actor), CLUTTER_IMAGE(iconImage));
+				g_error_free(error);
+				error=NULL;
 			}
+		}
 
-		clutter_actor_show(actor);
+		/* Release data extracted for icon */
+		g_free(iconData);
+	}
 
-		/* Release allocated resources */
-		g_free(buttonText);
+	/* Build text to show at button */
+	if(description) buttonText=g_markup_printf_escaped("<b>%s</b>\n\n%s", name, description);
+		else buttonText=g_markup_printf_escaped("<b>%s</b>", name);
+
+	/* Set text and icon if available at actor */
+	esdashboard_label_set_text(ESDASHBOARD_LABEL(inActor), buttonText);
+
+	if(icon)
+	{
+		esdashboard_label_set_style(ESDASHBOARD_LABEL(inActor), ESDASHBOARD_LABEL_STYLE_BOTH);
+		esdashboard_label_set_gicon(ESDASHBOARD_LABEL(inActor), icon);
 	}
+		else if(iconImage)
+		{
+			esdashboard_label_set_style(ESDASHBOARD_LABEL(inActor), ESDASHBOARD_LABEL_STYLE_BOTH);
+			esdashboard_label_set_icon_image(ESDASHBOARD_LABEL(inActor), CLUTTER_IMAGE(iconImage));
+		}
+		else
+		{
+			esdashboard_label_set_style(ESDASHBOARD_LABEL(inActor), ESDASHBOARD_LABEL_STYLE_TEXT);
+		}
 
 	/* Release allocated resources */
+	g_free(buttonText);
 	if(iconImage) g_object_unref(iconImage);
 	if(icon) g_object_unref(icon);
 	if(description) g_free(description);
 	if(name) g_free(name);
-	if(resultIter) g_variant_iter_free(resultIter);
-	if(proxyResult) g_variant_unref(proxyResult);
-	if(proxy) g_object_unref(proxy);
+
+	/* Actor was set up successfully */
+	return(TRUE);
+}
+
+/* Meta data of result items waiting for it was fetched asynchronously */
+static void _esdashboard_gnome_shell_search_provider_on_fetch_metas_done(GObject *inSource,
+																			GAsyncResult *inResult,
+																			gpointer inUserData)
+{
+	EsdashboardGnomeShellSearchProviderMetaFetch	*fetch;
+	EsdashboardGnomeShellSearchProvider				*self;
+	GVariant										*proxyResult;
+	GError											*error;
+	guint											i;
+
+	fetch=(EsdashboardGnomeShellSearchProviderMetaFetch*)inUserData;
+	self=fetch->provider;
+	error=NULL;
+
+	/* Store fetched meta data in cache and update all actors which are still
+	 * bound to a result item whose meta data is available now. Actors whose
+	 * meta data could not be fetched keep showing their placeholder.
+	 */
+	proxyResult=g_dbus_proxy_call_finish(G_DBUS_PROXY(inSource), inResult, &error);
+	if(proxyResult)
+	{
+		_esdashboard_gnome_shell_search_provider_meta_cache_insert_result(self, proxyResult);
+		g_variant_unref(proxyResult);
+
+		for(i=0; self->priv->metaCache && i<fetch->actors->len; i++)
+		{
+			ClutterActor							*actor;
+			const gchar								*identifier;
+			GVariant								*metaData;
+
+			actor=CLUTTER_ACTOR(g_ptr_array_index(fetch->actors, i));
+			identifier=(const gchar*)g_object_get_data(G_OBJECT(actor), ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_ACTOR_IDENTIFIER);
+			if(!identifier) continue;
+
+			metaData=_esdashboard_gnome_shell_search_provider_meta_cache_lookup(self, identifier);
+			if(metaData) _esdashboard_gnome_shell_search_provider_set_actor_meta(self, actor, identifier, metaData);
+		}
+	}
+		else
+		{
+			if(!g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+			{
+				g_warning("Could not get meta data from dbus connection for Gnome-Shell search provider '%s': %s",
+							self->priv->gnomeShellID,
+							(error && error->message) ? error->message : "Unknown error");
+			}
+			g_error_free(error);
+		}
+
+	/* Release allocated resources */
+	g_ptr_array_unref(fetch->actors);
+	g_object_unref(fetch->provider);
+	g_free(fetch);
+}
+
+/* Fetch meta data of all result items waiting for it in one call */
+static gboolean _esdashboard_gnome_shell_search_provider_on_fetch_pending_metas(gpointer inUserData)
+{
+	EsdashboardGnomeShellSearchProvider				*self;
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+	EsdashboardGnomeShellSearchProviderMetaFetch	*fetch;
+	GPtrArray										*identifiers;
+	GHashTableIter									iter;
+	gpointer										identifier;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(inUserData), G_SOURCE_REMOVE);
+
+	self=ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(inUserData);
+	priv=self->priv;
+
+	/* This source will be removed so forget its ID */
+	priv->pendingMetaSourceID=0;
+
+	/* Take over identifiers and actors waiting for meta data */
+	identifiers=g_ptr_array_new_with_free_func(g_free);
+	g_hash_table_iter_init(&iter, priv->pendingMetaIdentifiers);
+	while(g_hash_table_iter_next(&iter, &identifier, NULL))
+	{
+		g_ptr_array_add(identifiers, identifier);
+		g_hash_table_iter_steal(&iter);
+	}
+	g_ptr_array_add(identifiers, NULL);
+
+	fetch=g_new0(EsdashboardGnomeShellSearchProviderMetaFetch, 1);
+	fetch->provider=ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(g_object_ref(self));
+	fetch->actors=priv->pendingMetaActors;
+	priv->pendingMetaActors=g_ptr_array_new_with_free_func(g_object_unref);
+
+	/* The proxy exists as searches created it before result items were shown.
+	 * If it was dropped meanwhile, e.g. because data file of search provider
+	 * changed, the actors keep showing their placeholders.
+	 */
+	if(!priv->proxy || identifiers->len<=1)
+	{
+		g_ptr_array_unref(fetch->actors);
+		g_object_unref(fetch->provider);
+		g_free(fetch);
+		g_ptr_array_unref(identifiers);
+		return(G_SOURCE_REMOVE);
+	}
+
+	g_debug("Fetching meta data of %u result items for Gnome Shell search provider '%s' of type %s",
+				identifiers->len-1,
+				priv->gnomeShellID,
+				G_OBJECT_TYPE_NAME(self));
+
+	g_dbus_proxy_call(priv->proxy,
+						"GetResultMetas",
+						g_variant_new("(^as)", (gchar**)identifiers->pdata),
+						G_DBUS_CALL_FLAGS_NONE,
+						-1,
+						priv->metaCancellable,
+						_esdashboard_gnome_shell_search_provider_on_fetch_metas_done,
+						fetch);
+
+	/* Release allocated resources */
+	g_ptr_array_unref(identifiers);
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* Bind actor to result item. If meta data of result item is cached the actor
+ * is set up immediately, otherwise it shows a placeholder and the meta data is
+ * fetched asynchronously. All result items realized in the same main loop
+ * iteration, e.g. when all result items of a container are shown, are fetched
+ * in one call.
+ */
+static gboolean _esdashboard_gnome_shell_search_provider_bind_actor(EsdashboardGnomeShellSearchProvider *self,
+																	ClutterActor *inActor,
+																	GVariant *inResultItem)
+{
+	EsdashboardGnomeShellSearchProviderPrivate		*priv;
+	const gchar										*identifier;
+	GVariant										*metaData;
+	guint											i;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self), FALSE);
+	g_return_val_if_fail(ESDASHBOARD_IS_BUTTON(inActor), FALSE);
+	g_return_val_if_fail(inResultItem, FALSE);
+
+	priv=self->priv;
+
+	/* Remember result item the actor is bound to */
+	identifier=g_variant_get_string(inResultItem, NULL);
+	g_object_set_data_full(G_OBJECT(inActor),
+							ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_ACTOR_IDENTIFIER,
+							g_strdup(identifier),
+							g_free);
+
+	/* Set up actor from cached meta data if available */
+	metaData=_esdashboard_gnome_shell_search_provider_meta_cache_lookup(self, identifier);
+	if(metaData)
+	{
+		return(_esdashboard_gnome_shell_search_provider_set_actor_meta(self, inActor, identifier, metaData));
+	}
+
+	/* Show placeholder and queue result item to fetch its meta data */
+	esdashboard_label_set_style(ESDASHBOARD_LABEL(inActor), ESDASHBOARD_LABEL_STYLE_TEXT);
+	esdashboard_label_set_text(ESDASHBOARD_LABEL(inActor), "...");
+
+	if(!g_hash_table_contains(priv->pendingMetaIdentifiers, identifier))
+	{
+		g_hash_table_add(priv->pendingMetaIdentifiers, g_strdup(identifier));
+	}
+
+	for(i=0; i<priv->pendingMetaActors->len; i++)
+	{
+		if(g_ptr_array_index(priv->pendingMetaActors, i)==inActor) break;
+	}
+	if(i==priv->pendingMetaActors->len) g_ptr_array_add(priv->pendingMetaActors, g_object_ref(inActor));
+
+	if(!priv->pendingMetaSourceID)
+	{
+		priv->pendingMetaSourceID=g_idle_add(_esdashboard_gnome_shell_search_provider_on_fetch_pending_metas, self);
+	}
+
+	return(TRUE);
+}
+
+/* Actor for result item was destroyed so do not update it when its meta data arrives */
+static void _esdashboard_gnome_shell_search_provider_on_result_actor_destroyed(ClutterActor *inActor,
+																				gpointer inUserData)
+{
+	g_object_set_data(G_OBJECT(inActor), ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_ACTOR_IDENTIFIER, NULL);
+}
+
+/* Create actor for a result item of the result set returned from a search request */
+static ClutterActor* _esdashboard_gnome_shell_search_provider_create_result_actor(EsdashboardSearchProvider *inProvider,
+																					GVariant *inResultItem)
+{
+	EsdashboardGnomeShellSearchProvider				*self;
+	ClutterActor									*actor;
+
+	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(inProvider), NULL);
+	g_return_val_if_fail(inResultItem, NULL);
+
+	self=ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(inProvider);
+
+	/* Create actor for result item */
+	actor=esdashboard_button_new();
+	g_signal_connect(actor, "destroy", G_CALLBACK(_esdashboard_gnome_shell_search_provider_on_result_actor_destroyed), NULL);
+
+	if(!_esdashboard_gnome_shell_search_provider_bind_actor(self, actor, inResultItem))
+	{
+		g_object_ref_sink(actor);
+		clutter_actor_destroy(actor);
+		g_object_unref(actor);
+		return(NULL);
+	}
+
+	clutter_actor_show(actor);
 
 	/* Return created actor */
 	return(actor);
 }
 
+/* Rebind actor created before to another result item */
+static gboolean _esdashboard_gnome_shell_search_provider_update_result_actor(EsdashboardSearchProvider *inProvider,
+																				GVariant *inResultItem,
+																				ClutterActor *inActor)
+{
+	g_return_val_if_fail(ESDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(inProvider), FALSE);
+	g_return_val_if_fail(inResultItem, FALSE);
+
+	/* Only actors created by this provider can be updated */
+	if(!ESDASHBOARD_IS_BUTTON(inActor) ||
+		!g_object_get_data(G_OBJECT(inActor), ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_ACTOR_IDENTIFIER))
+	{
+		return(FALSE);
+	}
+
+	return(_esdashboard_gnome_shell_search_provider_bind_actor(ESDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(inProvider), inActor, inResultItem));
+}
+
 /* Activate result item */
 static gboolean _esdashboard_gnome_shell_search_provider_activate_result(EsdashboardSearchProvider* inProvider,
 																			GVariant *inResultItem,
@@ -859,14 +1706,7 @@ static gboolean _esdashboard_gnome_shell_search_provider_activate_result(Esdashb
 	identifier=g_variant_get_string(inResultItem, NULL);
 
 	/* Call 'ActivateResult' over DBUS at Gnome-Shell search provider */
-	proxy=g_dbus_proxy_new_for_bus_sync(G_BUS_TYPE_SESSION,
-										G_DBUS_PROXY_FLAGS_NONE,
-										NULL,
-										priv->dbusBusName,
-										priv->dbusObjectPath,
-										"org.gnome.Shell.SearchProvider2",
-										NULL,
-										&error);
+	proxy=_esdashboard_gnome_shell_search_provider_get_proxy(self, &error);
 	if(!proxy)
 	{
 		/* Show error message */
@@ -901,7 +1741,6 @@ static gboolean _esdashboard_gnome_shell_search_provider_activate_result(Esdashb
 
 		/* Release allocated resources */
 		if(error) g_error_free(error);
-		if(proxy) g_object_unref(proxy);
 
 		/* Return FALSE to indicate error */
 		return(FALSE);
@@ -909,7 +1748,6 @@ static gboolean _esdashboard_gnome_shell_search_provider_activate_result(Esdashb
 
 	/* Release allocated resources */
 	if(proxyResult) g_variant_unref(proxyResult);
-	if(proxy) g_object_unref(proxy);
 
 	/* If we get here activating result item was successful, so return TRUE */
 	return(TRUE);
@@ -933,14 +1771,7 @@ static gboolean _esdashboard_gnome_shell_search_provider_launch_search(Esdashboa
 	error=NULL;
 
 	/* Call 'LaunchSearch' over DBUS at Gnome-Shell search provider */
-	proxy=g_dbus_proxy_new_for_bus_sync(G_BUS_TYPE_SESSION,
-										G_DBUS_PROXY_FLAGS_NONE,
-										NULL,
-										priv->dbusBusName,
-										priv->dbusObjectPath,
-										"org.gnome.Shell.SearchProvider2",
-										NULL,
-										&error);
+	proxy=_esdashboard_gnome_shell_search_provider_get_proxy(self, &error);
 	if(!proxy)
 	{
 		/* Show error message */
@@ -973,7 +1804,6 @@ static gboolean _esdashboard_gnome_shell_search_provider_launch_search(Esdashboa
 
 		/* Release allocated resources */
 		if(error) g_error_free(error);
-		if(proxy) g_object_unref(proxy);
 
 		/* Return FALSE to indicate error */
 		return(FALSE);
@@ -981,7 +1811,6 @@ static gboolean _esdashboard_gnome_shell_search_provider_launch_search(Esdashboa
 
 	/* Release allocated resources */
 	if(proxyResult) g_variant_unref(proxyResult);
-	if(proxy) g_object_unref(proxy);
 
 	/* If we get here launching search was successful, so return TRUE */
 	return(TRUE);
@@ -996,6 +1825,76 @@ static void _esdashboard_gnome_shell_search_provider_dispose(GObject *inObject)
 	EsdashboardGnomeShellSearchProviderPrivate	*priv=self->priv;
 
 	/* Release allocated resources */
+	if(priv->proxyCancellable)
+	{
+		g_cancellable_cancel(priv->proxyCancellable);
+		g_object_unref(priv->proxyCancellable);
+		priv->proxyCancellable=NULL;
+	}
+
+	if(priv->pendingCalls)
+	{
+		EsdashboardGnomeShellSearchProviderPendingCall	*call;
+
+		/* Let all searches waiting for connection to search provider fail */
+		while((call=g_queue_pop_head(priv->pendingCalls)))
+		{
+			g_task_return_new_error(call->task,
+									G_IO_ERROR,
+									G_IO_ERROR_CANCELLED,
+									"Gnome-Shell search provider '%s' was disposed",
+									priv->gnomeShellID);
+			_esdashboard_gnome_shell_search_provider_pending_call_free(call);
+		}
+
+		g_queue_free(priv->pendingCalls);
+		priv->pendingCalls=NULL;
+	}
+
+	if(priv->proxy)
+	{
+		g_object_unref(priv->proxy);
+		priv->proxy=NULL;
+	}
+
+	if(priv->pendingMetaSourceID)
+	{
+		g_source_remove(priv->pendingMetaSourceID);
+		priv->pendingMetaSourceID=0;
+	}
+
+	if(priv->metaCancellable)
+	{
+		g_cancellable_cancel(priv->metaCancellable);
+		g_object_unref(priv->metaCancellable);
+		priv->metaCancellable=NULL;
+	}
+
+	if(priv->pendingMetaActors)
+	{
+		g_ptr_array_unref(priv->pendingMetaActors);
+		priv->pendingMetaActors=NULL;
+	}
+
+	if(priv->pendingMetaIdentifiers)
+	{
+		g_hash_table_destroy(priv->pendingMetaIdentifiers);
+		priv->pendingMetaIdentifiers=NULL;
+	}
+
+	if(priv->metaCache)
+	{
+		_esdashboard_gnome_shell_search_provider_meta_cache_clear(self);
+		g_hash_table_destroy(priv->metaCache);
+		priv->metaCache=NULL;
+	}
+
+	if(priv->metaCacheOrder)
+	{
+		g_queue_free(priv->metaCacheOrder);
+		priv->metaCacheOrder=NULL;
+	}
+
 	if(priv->gnomeShellID)
 	{
 		g_free(priv->gnomeShellID);
@@ -1064,7 +1963,10 @@ void esdashboard_gnome_shell_search_provider_class_init(EsdashboardGnomeShellSea
 	providerClass->get_icon=_esdashboard_gnome_shell_search_provider_get_icon;
 	providerClass->get_name=_esdashboard_gnome_shell_search_provider_get_name;
 	providerClass->get_result_set=_esdashboard_gnome_shell_search_provider_get_result_set;
+	providerClass->get_result_set_async=_esdashboard_gnome_shell_search_provider_get_result_set_async;
+	providerClass->get_result_set_finish=_esdashboard_gnome_shell_search_provider_get_result_set_finish;
 	providerClass->create_result_actor=_esdashboard_gnome_shell_search_provider_create_result_actor;
+	providerClass->update_result_actor=_esdashboard_gnome_shell_search_provider_update_result_actor;
 	providerClass->activate_result=_esdashboard_gnome_shell_search_provider_activate_result;
 	providerClass->launch_search=_esdashboard_gnome_shell_search_provider_launch_search;
 }
@@ -1092,4 +1994,13 @@ void esdashboard_gnome_shell_search_provider_init(EsdashboardGnomeShellSearchPro
 	priv->dbusObjectPath=NULL;
 	priv->providerName=NULL;
 	priv->providerIcon=NULL;
+	priv->proxy=NULL;
+	priv->proxyCancellable=NULL;
+	priv->pendingCalls=g_queue_new();
+	priv->metaCache=g_hash_table_new(g_str_hash, g_str_equal);
+	priv->metaCacheOrder=g_queue_new();
+	priv->pendingMetaIdentifiers=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	priv->pendingMetaActors=g_ptr_array_new_with_free_func(g_object_unref);
+	priv->pendingMetaSourceID=0;
+	priv->metaCancellable=g_cancellable_new();
 }
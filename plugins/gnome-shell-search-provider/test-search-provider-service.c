@@ -0,0 +1,277 @@
+/*
+ * test-search-provider-service: A stand-in Gnome-Shell search provider
+ *                               to test the 'gnome-shell-search-provider'
+ *                               plugin against
+ *
+ * Copyright 2012-2020 Stephan Haller <nomad@froevel.de>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ *
+ *
+ * This program exports the org.gnome.Shell.SearchProvider2 interface on the
+ * session bus and answers every search with a synthetic result set. Each
+ * call to GetResultMetas is logged with the number of identifiers requested
+ * so it can be verified that the plugin fetches meta data of all result
+ * items shown at once in one call instead of one call per result item.
+ *
+ * Run it in a private session bus together with esdashboard, e.g.:
+ *
+ *   dbus-run-session -- sh -c './test-search-provider-service --results=500 & esdashboard'
+ *
+ * and install test-search-provider-service.ini into the Gnome-Shell search
+ * providers path. The DesktopId in that file must name an installed
+ * application.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <gio/gio.h>
+#include <stdlib.h>
+
+
+/* Definitions */
+#define TEST_SEARCH_PROVIDER_BUS_NAME		"org.expidus.esdashboard.TestSearchProvider"
+#define TEST_SEARCH_PROVIDER_OBJECT_PATH	"/org/expidus/esdashboard/TestSearchProvider"
+
+static const gchar	_test_search_provider_introspection[]=
+	"<node>"
+	"  <interface name='org.gnome.Shell.SearchProvider2'>"
+	"    <method name='GetInitialResultSet'>"
+	"      <arg type='as' name='terms' direction='in' />"
+	"      <arg type='as' name='results' direction='out' />"
+	"    </method>"
+	"    <method name='GetSubsearchResultSet'>"
+	"      <arg type='as' name='previous_results' direction='in' />"
+	"      <arg type='as' name='terms' direction='in' />"
+	"      <arg type='as' name='results' direction='out' />"
+	"    </method>"
+	"    <method name='GetResultMetas'>"
+	"      <arg type='as' name='identifiers' direction='in' />"
+	"      <arg type='aa{sv}' name='metas' direction='out' />"
+	"    </method>"
+	"    <method name='ActivateResult'>"
+	"      <arg type='s' name='identifier' direction='in' />"
+	"      <arg type='as' name='terms' direction='in' />"
+	"      <arg type='u' name='timestamp' direction='in' />"
+	"    </method>"
+	"    <method name='LaunchSearch'>"
+	"      <arg type='as' name='terms' direction='in' />"
+	"      <arg type='u' name='timestamp' direction='in' />"
+	"    </method>"
+	"  </interface>"
+	"</node>";
+
+static gint			_test_search_provider_results=100;
+static gint			_test_search_provider_delay=0;
+static guint		_test_search_provider_meta_calls=0;
+static guint		_test_search_provider_meta_items=0;
+
+static GOptionEntry	_test_search_provider_options[]=
+{
+	{ "results", 'r', 0, G_OPTION_ARG_INT, &_test_search_provider_results, "Number of result items returned for each search", "N" },
+	{ "delay", 'd', 0, G_OPTION_ARG_INT, &_test_search_provider_delay, "Milliseconds to wait before replying to GetResultMetas", "MS" },
+	{ NULL }
+};
+
+/* Build result set for search terms */
+static GVariant* _test_search_provider_build_result_set(void)
+{
+	GVariantBuilder		builder;
+	gint				i;
+
+	g_variant_builder_init(&builder, G_VARIANT_TYPE("as"));
+	for(i=0; i<_test_search_provider_results; i++)
+	{
+		gchar			*identifier;
+
+		identifier=g_strdup_printf("item-%d", i);
+		g_variant_builder_add(&builder, "s", identifier);
+		g_free(identifier);
+	}
+
+	return(g_variant_new("(as)", &builder));
+}
+
+/* Build meta data for requested identifiers */
+static GVariant* _test_search_provider_build_metas(GVariant *inParameters)
+{
+	GVariantBuilder		builder;
+	GVariantIter		*iter;
+	const gchar			*identifier;
+	guint				count;
+
+	count=0;
+	g_variant_builder_init(&builder, G_VARIANT_TYPE("aa{sv}"));
+
+	g_variant_get(inParameters, "(as)", &iter);
+	while(g_variant_iter_next(iter, "&s", &identifier))
+	{
+		GVariantBuilder	meta;
+		gchar			*name;
+
+		name=g_strdup_printf("Result %s", identifier);
+
+		g_variant_builder_init(&meta, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&meta, "{sv}", "id", g_variant_new_string(identifier));
+		g_variant_builder_add(&meta, "{sv}", "name", g_variant_new_string(name));
+		g_variant_builder_add(&meta, "{sv}", "description", g_variant_new_string("Synthetic result of test search provider"));
+		g_variant_builder_add(&meta, "{sv}", "gicon", g_variant_new_string("system-search"));
+		g_variant_builder_add_value(&builder, g_variant_builder_end(&meta));
+
+		g_free(name);
+		count++;
+	}
+	g_variant_iter_free(iter);
+
+	/* Record and log call */
+	_test_search_provider_meta_calls++;
+	_test_search_provider_meta_items+=count;
+	g_print("GetResultMetas: call %u requested %u identifiers (%u identifiers in total)\n",
+			_test_search_provider_meta_calls,
+			count,
+			_test_search_provider_meta_items);
+
+	return(g_variant_new("(aa{sv})", &builder));
+}
+
+/* Reply to GetResultMetas after configured delay */
+static gboolean _test_search_provider_on_delayed_reply(gpointer inUserData)
+{
+	GDBusMethodInvocation	*invocation;
+
+	invocation=G_DBUS_METHOD_INVOCATION(inUserData);
+	g_dbus_method_invocation_return_value(invocation,
+											_test_search_provider_build_metas(g_dbus_method_invocation_get_parameters(invocation)));
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* A method of search provider interface was called */
+static void _test_search_provider_on_method_call(GDBusConnection *inConnection,
+													const gchar *inSender,
+													const gchar *inObjectPath,
+													const gchar *inInterfaceName,
+													const gchar *inMethodName,
+													GVariant *inParameters,
+													GDBusMethodInvocation *inInvocation,
+													gpointer inUserData)
+{
+	if(g_strcmp0(inMethodName, "GetInitialResultSet")==0 ||
+		g_strcmp0(inMethodName, "GetSubsearchResultSet")==0)
+	{
+		g_dbus_method_invocation_return_value(inInvocation, _test_search_provider_build_result_set());
+	}
+		else if(g_strcmp0(inMethodName, "GetResultMetas")==0)
+		{
+			if(_test_search_provider_delay>0)
+			{
+				g_timeout_add(_test_search_provider_delay, _test_search_provider_on_delayed_reply, inInvocation);
+			}
+				else _test_search_provider_on_delayed_reply(inInvocation);
+		}
+		else
+		{
+			g_print("%s called\n", inMethodName);
+			g_dbus_method_invocation_return_value(inInvocation, NULL);
+		}
+}
+
+static const GDBusInterfaceVTable	_test_search_provider_vtable=
+{
+	_test_search_provider_on_method_call,
+	NULL,
+	NULL
+};
+
+/* Bus was acquired so export search provider */
+static void _test_search_provider_on_bus_acquired(GDBusConnection *inConnection,
+													const gchar *inName,
+													gpointer inUserData)
+{
+	GDBusNodeInfo		*nodeInfo;
+	GError				*error;
+
+	error=NULL;
+
+	nodeInfo=g_dbus_node_info_new_for_xml(_test_search_provider_introspection, &error);
+	if(!nodeInfo ||
+		!g_dbus_connection_register_object(inConnection,
+											TEST_SEARCH_PROVIDER_OBJECT_PATH,
+											nodeInfo->interfaces[0],
+											&_test_search_provider_vtable,
+											NULL,
+											NULL,
+											&error))
+	{
+		g_printerr("Could not export search provider: %s\n",
+					(error && error->message) ? error->message : "Unknown error");
+		exit(EXIT_FAILURE);
+	}
+
+	g_dbus_node_info_unref(nodeInfo);
+}
+
+/* Bus name was lost or could not be acquired */
+static void _test_search_provider_on_name_lost(GDBusConnection *inConnection,
+												const gchar *inName,
+												gpointer inUserData)
+{
+	g_printerr("Could not own bus name '%s'\n", inName);
+	g_main_loop_quit((GMainLoop*)inUserData);
+}
+
+/* Main entry point */
+int main(int argc, char **argv)
+{
+	GOptionContext		*context;
+	GMainLoop			*mainLoop;
+	GError				*error;
+	guint				ownerID;
+
+	error=NULL;
+
+	context=g_option_context_new("- stand-in Gnome-Shell search provider");
+	g_option_context_add_main_entries(context, _test_search_provider_options, NULL);
+	if(!g_option_context_parse(context, &argc, &argv, &error))
+	{
+		g_printerr("%s\n", (error && error->message) ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		g_option_context_free(context);
+		return(EXIT_FAILURE);
+	}
+	g_option_context_free(context);
+
+	mainLoop=g_main_loop_new(NULL, FALSE);
+
+	ownerID=g_bus_own_name(G_BUS_TYPE_SESSION,
+							TEST_SEARCH_PROVIDER_BUS_NAME,
+							G_BUS_NAME_OWNER_FLAGS_NONE,
+							_test_search_provider_on_bus_acquired,
+							NULL,
+							_test_search_provider_on_name_lost,
+							mainLoop,
+							NULL);
+
+	g_main_loop_run(mainLoop);
+
+	/* Release allocated resources */
+	g_bus_unown_name(ownerID);
+	g_main_loop_unref(mainLoop);
+
+	return(EXIT_SUCCESS);
+}
@@ -27,6 +27,7 @@
 
 #include "general.h"
 
+#include <libesdashboard/applications-search-provider.h>
 #include <glib/gi18n-lib.h>
 #include <esconf/esconf.h>
 #include <math.h>
@@ -50,6 +51,7 @@ struct _EsdashboardSettingsGeneralPrivate
 	GtkWidget		*widgetShowAllApps;
 	GtkWidget		*widgetScrollEventChangesWorkspace;
 	GtkWidget		*widgetDelaySearchTimeout;
+	GtkWidget		*widgetEnableFuzzySearch;
 	GtkWidget		*widgetAllowSubwindows;
 	GtkWidget		*widgetEnableAnimations;
 };
@@ -98,6 +100,9 @@ static GParamSpec* EsdashboardSettingsGeneralProperties[PROP_LAST]={ 0, };
 #define DELAY_SEARCH_TIMEOUT_ESCONF_PROP					"/components/search-view/delay-search-timeout"
 #define DEFAULT_DELAY_SEARCH_TIMEOUT						0
 
+#define APPLICATIONS_SEARCH_SORT_MODE_ESCONF_PROP			"/components/applications-search-provider/sort-mode"
+#define DEFAULT_APPLICATIONS_SEARCH_SORT_MODE				ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_NONE
+
 #define WINDOW_CONTENT_CREATION_PRIORITY_ESCONF_PROP		"/window-content-creation-priority"
 #define DEFAULT_WINDOW_CONTENT_CREATION_PRIORITY			"immediate"
 
@@ -386,6 +391,53 @@ static gchar* _esdashboard_settings_general_on_format_delay_search_timeout_value
 	return(text);
 }
 
+/* Setting '/components/applications-search-provider/sort-mode' changed either at
+ * widget or at esconf property. The widget only toggles the fuzzy flag and keeps
+ * all other sort mode flags untouched.
+ */
+static void _esdashboard_settings_general_enable_fuzzy_search_changed_by_widget(EsdashboardSettingsGeneral *self,
+																					GtkToggleButton *inButton)
+{
+	EsdashboardSettingsGeneralPrivate		*priv;
+	guint									value;
+
+	g_return_if_fail(ESDASHBOARD_IS_SETTINGS_GENERAL(self));
+	g_return_if_fail(GTK_IS_TOGGLE_BUTTON(inButton));
+
+	priv=self->priv;
+
+	/* Get current value from esconf property and set or unset fuzzy flag */
+	value=esconf_channel_get_uint(priv->esconfChannel, APPLICATIONS_SEARCH_SORT_MODE_ESCONF_PROP, DEFAULT_APPLICATIONS_SEARCH_SORT_MODE);
+	if(gtk_toggle_button_get_active(inButton)) value|=ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_FUZZY;
+		else value&=~ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_FUZZY;
+
+	/* Set value at esconf property */
+	esconf_channel_set_uint(priv->esconfChannel, APPLICATIONS_SEARCH_SORT_MODE_ESCONF_PROP, value);
+}
+
+static void _esdashboard_settings_general_enable_fuzzy_search_changed_by_esconf(EsdashboardSettingsGeneral *self,
+																					const gchar *inProperty,
+																					const GValue *inValue,
+																					EsconfChannel *inChannel)
+{
+	EsdashboardSettingsGeneralPrivate		*priv;
+	guint									newValue;
+
+	g_return_if_fail(ESDASHBOARD_IS_SETTINGS_GENERAL(self));
+	g_return_if_fail(inValue);
+	g_return_if_fail(ESCONF_IS_CHANNEL(inChannel));
+
+	priv=self->priv;
+
+	/* Get new value to set at widget */
+	if(G_UNLIKELY(G_VALUE_TYPE(inValue)!=G_TYPE_UINT)) newValue=DEFAULT_APPLICATIONS_SEARCH_SORT_MODE;
+		else newValue=g_value_get_uint(inValue);
+
+	/* Set new value at widget */
+	gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(priv->widgetEnableFuzzySearch),
+									(newValue & ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_FUZZY) ? TRUE : FALSE);
+}
+
 /* Create and set up GtkBuilder */
 static void _esdashboard_settings_general_set_builder(EsdashboardSettingsGeneral *self,
 														GtkBuilder *inBuilder)
@@ -564,6 +616,29 @@ static void _esdashboard_settings_general_set_builder(EsdashboardSettingsGeneral
 									self);
 	}
 
+	priv->widgetEnableFuzzySearch=GTK_WIDGET(gtk_builder_get_object(priv->builder, "enable-fuzzy-search"));
+	if(priv->widgetEnableFuzzySearch)
+	{
+		guint										defaultValue;
+
+		/* Get default value */
+		defaultValue=esconf_channel_get_uint(priv->esconfChannel, APPLICATIONS_SEARCH_SORT_MODE_ESCONF_PROP, DEFAULT_APPLICATIONS_SEARCH_SORT_MODE);
+
+		/* Set up default value */
+		gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(priv->widgetEnableFuzzySearch),
+										(defaultValue & ESDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_FUZZY) ? TRUE : FALSE);
+
+		/* Connect signals */
+		g_signal_connect_swapped(priv->widgetEnableFuzzySearch,
+									"toggled",
+									G_CALLBACK(_esdashboard_settings_general_enable_fuzzy_search_changed_by_widget),
+									self);
+		g_signal_connect_swapped(priv->esconfChannel,
+									"property-changed::"APPLICATIONS_SEARCH_SORT_MODE_ESCONF_PROP,
+									G_CALLBACK(_esdashboard_settings_general_enable_fuzzy_search_changed_by_esconf),
+									self);
+	}
+
 	priv->widgetWindowCreationPriority=GTK_WIDGET(gtk_builder_get_object(priv->builder, "window-creation-priority"));
 	if(priv->widgetWindowCreationPriority)
 	{
@@ -657,6 +732,7 @@ static void _esdashboard_settings_general_dispose(GObject *inObject)
 	priv->widgetAlwaysLaunchNewInstance=NULL;
 	priv->widgetScrollEventChangesWorkspace=NULL;
 	priv->widgetDelaySearchTimeout=NULL;
+	priv->widgetEnableFuzzySearch=NULL;
 
 	if(priv->builder)
 	{